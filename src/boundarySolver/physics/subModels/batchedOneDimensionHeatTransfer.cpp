@@ -0,0 +1,231 @@
+#include "batchedOneDimensionHeatTransfer.hpp"
+#include <petscviewerhdf5.h>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::BatchedOneDimensionHeatTransfer(PetscInt numberFaces, const std::shared_ptr<ablate::parameters::Parameters>& properties,
+                                                                                                             const std::shared_ptr<ablate::mathFunctions::MathFunction>& initializationIn,
+                                                                                                             const std::shared_ptr<ablate::parameters::Parameters>& options,
+                                                                                                             PetscReal maxSurfaceTemperature)
+    : numberFaces(numberFaces),
+      numberElements(options ? options->Get<PetscInt>("dm_plex_box_faces", 15) : 15),
+      length(options ? options->Get<PetscReal>("dm_plex_box_upper", 0.1) : 0.1),
+      maximumStep(options ? options->Get<PetscReal>("ts_dt", -1.0) : -1.0),
+      maximumSurfaceTemperature(maxSurfaceTemperature),
+      initialization(initializationIn),
+      temperature(numberFaces * (numberElements + 1)),
+      time(numberFaces, 0.0),
+      rhs(numberElements + 1) {
+    if (numberElements < 1) {
+        throw std::invalid_argument("The BatchedOneDimensionHeatTransfer requires at least one element.");
+    }
+
+    // the solid model is no longer a petsc solver, so any other option would be silently ignored
+    if (options) {
+        const std::set<std::string> supportedOptions = {"dm_plex_box_faces", "dm_plex_box_upper", "ts_dt"};
+        for (const auto& key : options->GetKeys()) {
+            if (!supportedOptions.count(key)) {
+                throw std::invalid_argument("The BatchedOneDimensionHeatTransfer does not support the option " + key + ".  Only dm_plex_box_faces, dm_plex_box_upper, and ts_dt are supported.");
+            }
+        }
+    }
+
+    // Get the properties
+    heatCapacity = properties->GetExpect<PetscReal>("density") * properties->GetExpect<PetscReal>("specificHeat");
+    conductivity = properties->GetExpect<PetscReal>("conductivity");
+
+    // Set the initial conditions at each node using the math function, the same profile is used for every face
+    const auto numberNodes = numberElements + 1;
+    for (PetscInt n = 0; n < numberNodes; ++n) {
+        PetscReal x = GetNodeLocation(n);
+        temperature[n] = initialization->Eval(&x, 1, 0.0);
+    }
+    for (PetscInt f = 1; f < numberFaces; ++f) {
+        std::copy_n(temperature.begin(), numberNodes, temperature.begin() + f * numberNodes);
+    }
+}
+
+const ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Factorization&
+ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetFactorization(SurfaceCondition condition, PetscReal dt) {
+    auto& factorization = factorizations[condition == SurfaceCondition::heatFlux ? 0 : 1];
+    if (factorization.dt == dt) {
+        return factorization;
+    }
+
+    // The (M + dt*K) system for linear elements with a consistent mass matrix
+    const auto numberNodes = numberElements + 1;
+    const PetscReal h = length / numberElements;
+    const PetscReal mass = heatCapacity * h / 6.0;
+    const PetscReal stiffness = dt * conductivity / h;
+
+    factorization.dt = dt;
+    factorization.lower.assign(numberNodes, mass - stiffness);
+    factorization.upper.assign(numberNodes, mass - stiffness);
+    factorization.inversePivot.resize(numberNodes);
+
+    // the far field is always a fixed temperature
+    std::vector<PetscReal> diagonal(numberNodes, 4.0 * mass + 2.0 * stiffness);
+    diagonal[numberElements] = 1.0;
+    factorization.lower[numberElements] = 0.0;
+    factorization.upper[numberElements] = 0.0;
+
+    if (condition == SurfaceCondition::heatFlux) {
+        diagonal[0] = 2.0 * mass + stiffness;
+    } else {
+        diagonal[0] = 1.0;
+        factorization.upper[0] = 0.0;
+    }
+    factorization.lower[0] = 0.0;
+
+    // forward elimination, the upper coefficients are replaced by the normalized values
+    factorization.inversePivot[0] = 1.0 / diagonal[0];
+    factorization.upper[0] *= factorization.inversePivot[0];
+    for (PetscInt n = 1; n < numberNodes; ++n) {
+        factorization.inversePivot[n] = 1.0 / (diagonal[n] - factorization.lower[n] * factorization.upper[n - 1]);
+        factorization.upper[n] *= factorization.inversePivot[n];
+    }
+    return factorization;
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Step(PetscInt face, PetscReal heatFluxToSurface, PetscReal dt) {
+    const auto numberNodes = numberElements + 1;
+    PetscReal* faceTemperature = temperature.data() + face * numberNodes;
+
+    // Determine what kind of surface boundary condition is needed
+    auto condition = SurfaceCondition::heatFlux;
+    if (maximumSurfaceTemperature >= 0) {
+        PetscReal surfaceTemperature, heatFlux;
+        GetSurfaceInformation(face, surfaceTemperature, heatFlux);
+        if (surfaceTemperature >= maximumSurfaceTemperature && heatFluxToSurface >= heatFlux) {
+            condition = SurfaceCondition::temperature;
+        }
+    }
+    const auto& factorization = GetFactorization(condition, dt);
+
+    // Compute the right hand side, M*T + dt*b
+    const PetscReal mass = heatCapacity * length / (6.0 * numberElements);
+    if (condition == SurfaceCondition::heatFlux) {
+        rhs[0] = mass * (2.0 * faceTemperature[0] + faceTemperature[1]) + dt * heatFluxToSurface;
+    } else {
+        rhs[0] = maximumSurfaceTemperature;
+    }
+    for (PetscInt n = 1; n < numberElements; ++n) {
+        rhs[n] = mass * (faceTemperature[n - 1] + 4.0 * faceTemperature[n] + faceTemperature[n + 1]);
+    }
+    PetscReal farFieldLocation = length;
+    rhs[numberElements] = initialization->Eval(&farFieldLocation, 1, time[face] + dt);
+
+    // forward and back substitution
+    rhs[0] *= factorization.inversePivot[0];
+    for (PetscInt n = 1; n < numberNodes; ++n) {
+        rhs[n] = (rhs[n] - factorization.lower[n] * rhs[n - 1]) * factorization.inversePivot[n];
+    }
+    faceTemperature[numberElements] = rhs[numberElements];
+    for (PetscInt n = numberElements - 1; n >= 0; --n) {
+        faceTemperature[n] = rhs[n] - factorization.upper[n] * faceTemperature[n + 1];
+    }
+    time[face] += dt;
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Solve(PetscInt face, PetscReal heatFluxToSurface, PetscReal dt, PetscReal& surfaceTemperature, PetscReal& heatFlux) {
+    // Use equal sub steps so that the shared factorization is reused for each sub step
+    PetscInt numberSteps = 1;
+    if (maximumStep > 0 && dt > maximumStep) {
+        numberSteps = (PetscInt)PetscCeilReal(dt / maximumStep - PETSC_SMALL);
+    }
+    const PetscReal subDt = dt / numberSteps;
+    for (PetscInt s = 0; s < numberSteps; ++s) {
+        Step(face, heatFluxToSurface, subDt);
+    }
+    GetSurfaceInformation(face, surfaceTemperature, heatFlux);
+}
+
+void ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::GetSurfaceInformation(PetscInt face, PetscReal& surfaceTemperature, PetscReal& heatFlux) const {
+    const PetscReal* faceTemperature = GetTemperature(face);
+    surfaceTemperature = faceTemperature[0];
+    heatFlux = -conductivity * (faceTemperature[1] - faceTemperature[0]) * numberElements / length;
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Save(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& faceIds) {
+    PetscFunctionBegin;
+    PetscCheck((PetscInt)faceIds.size() == numberFaces, PETSC_COMM_SELF, PETSC_ERR_ARG_SIZ, "The number of face ids (%" PetscInt_FMT ") must match the number of faces (%" PetscInt_FMT ")",
+               (PetscInt)faceIds.size(), numberFaces);
+
+    // the profiles are stored as a single vector outside any timestepping
+    PetscBool isTimestepping;
+    PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isTimestepping));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+
+    // store the face ids so that a restart can check that the faces match
+    IS faceIs;
+    const auto faceIdsName = name + "FaceIds";
+    PetscCall(ISCreateGeneral(PETSC_COMM_SELF, numberFaces, faceIds.data(), PETSC_USE_POINTER, &faceIs));
+    PetscCall(PetscObjectSetName((PetscObject)faceIs, faceIdsName.c_str()));
+    PetscCall(ISView(faceIs, viewer));
+    PetscCall(ISDestroy(&faceIs));
+
+    Vec profiles;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)temperature.size(), temperature.data(), &profiles));
+    PetscCall(PetscObjectSetName((PetscObject)profiles, name.c_str()));
+    PetscCall(VecView(profiles, viewer));
+    PetscCall(VecDestroy(&profiles));
+
+    // the time of each face is needed to continue evaluating the far field condition
+    Vec faceTimes;
+    const auto timeName = name + "Time";
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numberFaces, time.data(), &faceTimes));
+    PetscCall(PetscObjectSetName((PetscObject)faceTimes, timeName.c_str()));
+    PetscCall(VecView(faceTimes, viewer));
+    PetscCall(VecDestroy(&faceTimes));
+
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer::Restore(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& faceIds) {
+    PetscFunctionBegin;
+    PetscBool isTimestepping;
+    PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isTimestepping));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+
+    // the saved profiles can only be used if they were saved for the same faces in the same order
+    IS faceIs;
+    const auto faceIdsName = name + "FaceIds";
+    PetscCall(ISCreate(PETSC_COMM_SELF, &faceIs));
+    PetscCall(ISSetType(faceIs, ISGENERAL));
+    PetscCall(PetscObjectSetName((PetscObject)faceIs, faceIdsName.c_str()));
+    PetscCall(ISLoad(faceIs, viewer));
+    PetscInt savedNumberFaces;
+    const PetscInt* savedFaceIds;
+    PetscCall(ISGetLocalSize(faceIs, &savedNumberFaces));
+    PetscCall(ISGetIndices(faceIs, &savedFaceIds));
+    PetscBool match = savedNumberFaces == (PetscInt)faceIds.size() && std::equal(faceIds.begin(), faceIds.end(), savedFaceIds) ? PETSC_TRUE : PETSC_FALSE;
+    PetscCall(ISRestoreIndices(faceIs, &savedFaceIds));
+    PetscCall(ISDestroy(&faceIs));
+    PetscCheck(match, PETSC_COMM_SELF, PETSC_ERR_FILE_UNEXPECTED, "The saved %s faces do not match the current boundary faces, the solid temperature cannot be restored", name.c_str());
+
+    Vec profiles;
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, (PetscInt)temperature.size(), temperature.data(), &profiles));
+    PetscCall(PetscObjectSetName((PetscObject)profiles, name.c_str()));
+    PetscCall(VecLoad(profiles, viewer));
+    PetscCall(VecDestroy(&profiles));
+
+    Vec faceTimes;
+    const auto timeName = name + "Time";
+    PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, numberFaces, time.data(), &faceTimes));
+    PetscCall(PetscObjectSetName((PetscObject)faceTimes, timeName.c_str()));
+    PetscCall(VecLoad(faceTimes, viewer));
+    PetscCall(VecDestroy(&faceTimes));
+
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+    }
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -0,0 +1,145 @@
+#ifndef ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+#define ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mathFunctions/mathFunction.hpp"
+#include "parameters/parameters.hpp"
+
+namespace ablate::boundarySolver::physics::subModels {
+
+/**
+ * Solves the one dimensional solid heat equation for a batch of boundary faces.  Every face uses the same linear finite element discretization as the OneDimensionHeatTransfer
+ * model (a uniform mesh with the surface at x = 0 and the far field at x = length) advanced with backward euler.  The temperature profiles for all faces are stored
+ * in a single contiguous block and each step is a tridiagonal (Thomas) solve.  Because the matrix only depends upon the time step and the surface boundary condition,
+ * the forward elimination coefficients are computed once and shared by all faces.
+ */
+class BatchedOneDimensionHeatTransfer {
+   public:
+    //! the surface boundary condition applied to a face
+    enum class SurfaceCondition { heatFlux, temperature };
+
+   private:
+    //! the elimination coefficients for one kind of surface boundary condition and time step
+    struct Factorization {
+        PetscReal dt = -1.0;
+        std::vector<PetscReal> lower;
+        std::vector<PetscReal> upper;
+        std::vector<PetscReal> inversePivot;
+    };
+
+    //! the number of faces in the batch
+    const PetscInt numberFaces;
+
+    //! the number of elements in each one dimensional mesh
+    const PetscInt numberElements;
+
+    //! the depth of the solid domain
+    const PetscReal length;
+
+    //! the optional maximum sub step used to advance each face
+    const PetscReal maximumStep;
+
+    //! the solid heat capacity (density*specificHeat)
+    PetscReal heatCapacity;
+
+    //! the solid conductivity
+    PetscReal conductivity;
+
+    //! the surface temperature is held fixed at this value once reached
+    const PetscReal maximumSurfaceTemperature;
+
+    // store the initialization as it is also used for the far field boundary condition
+    const std::shared_ptr<ablate::mathFunctions::MathFunction> initialization;
+
+    //! the temperature at each node, each face profile is contiguous
+    std::vector<PetscReal> temperature;
+
+    //! the current time for each face
+    std::vector<PetscReal> time;
+
+    //! the shared factorizations for each kind of surface boundary condition
+    Factorization factorizations[2];
+
+    //! scratch space for the right hand side
+    std::vector<PetscReal> rhs;
+
+    /**
+     * Returns the factorization for this surface condition, recomputing it only if the time step changed
+     */
+    const Factorization& GetFactorization(SurfaceCondition condition, PetscReal dt);
+
+    /**
+     * Advance a single face by a single backward euler step
+     */
+    void Step(PetscInt face, PetscReal heatFluxToSurface, PetscReal dt);
+
+   public:
+    /**
+     * Create the batch of 1D solid models
+     * @param numberFaces the number of faces in the batch
+     * @param properties the heat transfer properties (specificHeat, conductivity, density)
+     * @param initialization, math function to initialize the temperature, also used for the far field
+     * @param options the mesh (dm_plex_box_faces, dm_plex_box_upper) and maximum sub step (ts_dt) options, any other option is rejected
+     * @param maxSurfaceTemperature the maximum surface temperature, ignored if negative
+     */
+    BatchedOneDimensionHeatTransfer(PetscInt numberFaces, const std::shared_ptr<ablate::parameters::Parameters>& properties,
+                                    const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization, const std::shared_ptr<ablate::parameters::Parameters>& options = {},
+                                    PetscReal maxSurfaceTemperature = PETSC_DEFAULT);
+
+    /**
+     * Advances the model for this face in time and returns the computed surface state
+     * @param face the index of the face in the batch
+     * @param heatFluxToSurface the heat flux into the solid surface
+     * @param dt
+     * @param surfaceTemperature
+     * @param heatFlux the heat flux conducted into the solid
+     */
+    void Solve(PetscInt face, PetscReal heatFluxToSurface, PetscReal dt, PetscReal& surfaceTemperature, PetscReal& heatFlux);
+
+    /**
+     * Compute the current surface temperature and conducted heat flux for this face
+     */
+    void GetSurfaceInformation(PetscInt face, PetscReal& surfaceTemperature, PetscReal& heatFlux) const;
+
+    /**
+     * Return the temperature profile for this face
+     */
+    [[nodiscard]] const PetscReal* GetTemperature(PetscInt face) const { return temperature.data() + face * (numberElements + 1); }
+
+    /**
+     * Return the current time for this face
+     */
+    [[nodiscard]] PetscReal GetTime(PetscInt face) const { return time[face]; }
+
+    /**
+     * Return the number of nodes in each face profile
+     */
+    [[nodiscard]] PetscInt GetNumberNodes() const { return numberElements + 1; }
+
+    /**
+     * Return the location of this node measured from the surface
+     */
+    [[nodiscard]] PetscReal GetNodeLocation(PetscInt node) const { return length * node / numberElements; }
+
+    /**
+     * Save all profiles to the PetscViewer as a single vector along with the id and current time of each face
+     * @param viewer
+     * @param name the name of the vector
+     * @param faceIds the id of each face in the batch
+     */
+    PetscErrorCode Save(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& faceIds);
+
+    /**
+     * Restore all profiles and face times from the PetscViewer.  An error is returned if the saved face ids do not match.
+     * @param viewer
+     * @param name the name of the vector
+     * @param faceIds the id of each face in the batch
+     */
+    PetscErrorCode Restore(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& faceIds);
+};
+
+}  // namespace ablate::boundarySolver::physics::subModels
+#endif  // ABLATELIBRARY_BATCHEDONEDIMENSIONHEATTRANSFER_HPP
@@ -1,6 +1,7 @@
 #include "temperatureSublimation.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
 ablate::boundarySolver::physics::subModels::TemperatureSublimation::TemperatureSublimation(const std::shared_ptr<ablate::parameters::Parameters>& properties,
                                                                                            const std::shared_ptr<ablate::mathFunctions::MathFunction>& initialization,
                                                                                            const std::shared_ptr<ablate::parameters::Parameters>& options)
@@ -18,10 +19,6 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
     // Get the surface temperature from the properties
     auto sublimationTemperature = properties->GetExpect<double>("sublimationTemperature");
 
-    // Get the rank
-    PetscMPIInt rank;
-    MPI_Comm_rank(bSolver.GetSubDomain().GetComm(), &rank) >> utilities::MpiUtilities::checkError;
-
     // Get the temperature field from the solver to set the init value
     auto temperatureField = bSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
     auto temperatureVec = bSolver.GetSubDomain().GetVec(temperatureField);
@@ -31,17 +28,22 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
     PetscScalar* temperatureArray;
     VecGetArray(temperatureVec, &temperatureArray) >> utilities::PetscUtilities::checkError;
 
-    /** Initialize the solid boundary heat transfer model */
-    for (const auto& geom : bSolver.GetBoundaryGeometry()) {
-        // Create a unique name for this model based pon the faceId and rank
-        auto uniqueId = std::to_string(rank) + "-" + std::to_string(geom.geometry.faceId);
+    /** Initialize the solid boundary heat transfer model with a single batch for every face */
+    const auto& boundaryGeometry = bSolver.GetBoundaryGeometry();
+    oneDimensionHeatTransfer = std::make_unique<BatchedOneDimensionHeatTransfer>((PetscInt)boundaryGeometry.size(), properties, initialization, options, sublimationTemperature);
+    heatFluxIntoSolid.assign(boundaryGeometry.size(), 0.0);
+    faceIndices.clear();
+    faceIds.resize(boundaryGeometry.size());
+    MPI_Comm_rank(bSolver.GetSubDomain().GetComm(), &rank) >> utilities::MpiUtilities::checkError;
 
-        oneDimensionHeatTransfer[geom.geometry.faceId] = std::make_shared<OneDimensionHeatTransfer>(uniqueId, properties, initialization, options, sublimationTemperature);
-        heatFluxIntoSolid[geom.geometry.faceId] = 0.0;
+    for (std::size_t i = 0; i < boundaryGeometry.size(); ++i) {
+        const auto& geom = boundaryGeometry[i];
+        faceIndices[geom.geometry.faceId] = (PetscInt)i;
+        faceIds[i] = geom.geometry.faceId;
 
         // Get the current surface temperature
-        PetscReal currentSurfaceTemp;
-        oneDimensionHeatTransfer[geom.geometry.faceId]->GetSurfaceTemperature(currentSurfaceTemp) >> utilities::PetscUtilities::checkError;
+        PetscReal currentSurfaceTemp, currentHeatFlux;
+        oneDimensionHeatTransfer->GetSurfaceInformation((PetscInt)i, currentSurfaceTemp, currentHeatFlux);
 
         // Get and set the temperature value
         PetscScalar* temperature;
@@ -55,8 +57,9 @@ void ablate::boundarySolver::physics::subModels::TemperatureSublimation::Initial
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Update(PetscInt faceId, PetscReal dt, PetscReal heatFluxToSurface, PetscReal& temperature) {
     PetscFunctionBegin;
 
-    // Step the time stepper in time
-    PetscCall(oneDimensionHeatTransfer[faceId]->Solve(heatFluxToSurface, dt, temperature, heatFluxIntoSolid[faceId]));
+    // Step this face of the solid model in time
+    const auto index = faceIndices.at(faceId);
+    oneDimensionHeatTransfer->Solve(index, heatFluxToSurface, dt, temperature, heatFluxIntoSolid[index]);
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -64,7 +67,7 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
                                                                                            ablate::boundarySolver::physics::subModels::SublimationModel::SurfaceState& surfaceState) {
     PetscFunctionBeginHot;
     // compute the heat flux. Add the radiation heat flux for this face intensity if the radiation solver exists
-    PetscReal sublimationHeatFlux = heatFluxToSurface - heatFluxIntoSolid[faceId];
+    PetscReal sublimationHeatFlux = heatFluxToSurface - heatFluxIntoSolid[faceIndices.at(faceId)];
 
     // We can only use positive heat flux
     sublimationHeatFlux = PetscMax(0.0, sublimationHeatFlux);
@@ -77,17 +80,13 @@ PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimatio
 }
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Save(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Save(viewer, "solidTemperature-" + std::to_string(rank), faceIds));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::subModels::TemperatureSublimation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    for (auto& oneDimModel : oneDimensionHeatTransfer) {
-        oneDimModel.second->Restore(viewer, sequenceNumber, time);
-    }
+    PetscCall(oneDimensionHeatTransfer->Restore(viewer, "solidTemperature-" + std::to_string(rank), faceIds));
     PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -96,4 +95,4 @@ REGISTER(ablate::boundarySolver::physics::subModels::SublimationModel, ablate::b
          "Sublimation occurs at the specified temperature.  Extra heatFlux is used to heat the solid boundary",
          ARG(ablate::parameters::Parameters, "properties", "the heat transfer properties (specificHeat, conductivity, density, sublimationTemperature, latentHeatOfFusion"),
          ARG(ablate::mathFunctions::MathFunction, "initialization", " math function to initialize the temperature"),
-         OPT(ablate::parameters::Parameters, "options", "the petsc options for the solver/ts"));
+         OPT(ablate::parameters::Parameters, "options", "the solid mesh (dm_plex_box_faces, dm_plex_box_upper) and maximum sub step (ts_dt) options, other options are rejected"));
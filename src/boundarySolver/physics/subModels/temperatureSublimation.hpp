@@ -3,7 +3,8 @@
 
 #include <map>
 #include <memory>
-#include "oneDimensionHeatTransfer.hpp"
+#include <vector>
+#include "batchedOneDimensionHeatTransfer.hpp"
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
 #include "sublimationModel.hpp"
@@ -12,11 +13,20 @@ namespace ablate::boundarySolver::physics::subModels {
 
 class TemperatureSublimation : public SublimationModel {
    private:
-    //! hold onto a map of solid heat transfer
-    std::map<PetscInt, std::shared_ptr<OneDimensionHeatTransfer>> oneDimensionHeatTransfer;
+    //! the solid heat transfer for every boundary face on this rank
+    std::unique_ptr<BatchedOneDimensionHeatTransfer> oneDimensionHeatTransfer;
 
-    //! hold onto a map of solid heat transfer flux, updated each time
-    std::map<PetscInt, PetscReal> heatFluxIntoSolid;
+    //! map from the faceId to the index in the solid heat transfer batch
+    std::map<PetscInt, PetscInt> faceIndices;
+
+    //! the faceId for each index in the solid heat transfer batch, saved to check the faces on restart
+    std::vector<PetscInt> faceIds;
+
+    //! the rank is used to give each solid temperature vector a unique name
+    PetscMPIInt rank = 0;
+
+    //! hold onto the solid heat transfer flux for each face in the batch, updated each time
+    std::vector<PetscReal> heatFluxIntoSolid;
 
     //! the material properties
     const std::shared_ptr<ablate::parameters::Parameters> properties;
@@ -24,7 +34,7 @@ class TemperatureSublimation : public SublimationModel {
     //! the math function used to initialize the domain
     const std::shared_ptr<ablate::mathFunctions::MathFunction> initialization;
 
-    //! the petsc options used to setup each oneDimensionHeatTransfer
+    //! the mesh (dm_plex_box_faces, dm_plex_box_upper) and maximum sub step (ts_dt) options for the solid heat transfer
     const std::shared_ptr<ablate::parameters::Parameters> options;
 
     //! the latent heat of fusion [J/kg]"
@@ -117,10 +117,16 @@ class Sublimation : public BoundaryProcess, public io::Serializable {
     [[nodiscard]] const std::string &GetId() const override { return sublimationId; }
 
     /**
-     * assume that the sublimation model does not need to Serialize
+     * the sublimation model and radiation rays are both saved in the same file. The sublimation model determines the serializer type if it has state,
+     * the radiation rays are written through whichever viewer is used
      * @return
      */
-    [[nodiscard]] SerializerType Serialize() const override { return sublimationModel ? sublimationModel->Serialize() : io::Serializable::SerializerType::none; }
+    [[nodiscard]] SerializerType Serialize() const override {
+        if (sublimationModel && sublimationModel->Serialize() != io::Serializable::SerializerType::none) {
+            return sublimationModel->Serialize();
+        }
+        return radiation ? radiation->Serialize() : io::Serializable::SerializerType::none;
+    }
 
     /**
      * Save the state to the PetscViewer
@@ -130,7 +136,12 @@ class Sublimation : public BoundaryProcess, public io::Serializable {
      */
     PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override {
         PetscFunctionBegin;
-        PetscCall(sublimationModel->Save(viewer, sequenceNumber, time));
+        if (sublimationModel) {
+            PetscCall(sublimationModel->Save(viewer, sequenceNumber, time));
+        }
+        if (radiation) {
+            PetscCall(radiation->Save(viewer, sequenceNumber, time));
+        }
         PetscFunctionReturn(PETSC_SUCCESS);
     };
 
@@ -142,7 +153,12 @@ class Sublimation : public BoundaryProcess, public io::Serializable {
      */
     PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override {
         PetscFunctionBegin;
-        PetscCall(sublimationModel->Restore(viewer, sequenceNumber, time));
+        if (sublimationModel) {
+            PetscCall(sublimationModel->Restore(viewer, sequenceNumber, time));
+        }
+        if (radiation) {
+            PetscCall(radiation->Restore(viewer, sequenceNumber, time));
+        }
         PetscFunctionReturn(PETSC_SUCCESS);
     }
 
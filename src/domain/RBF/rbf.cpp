@@ -1,4 +1,6 @@
 #include "rbf.hpp"
+#include <algorithm>
+#include <map>
 #include <petsc/private/dmpleximpl.h>
 
 using namespace ablate::domain::rbf;
@@ -125,17 +127,34 @@ PetscErrorCode ConditionNumber(Mat A) {
 
 static PetscInt fac[11] = {1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800};  // Pre-computed factorials
 
-// Compute the LU-factorization of the augmented RBF matrix
+// LU-factorization of a dense column-major system
+static PetscErrorCode FactorSystem(PetscInt size, PetscReal A[], PetscBLASInt pivots[]) {
+    PetscBLASInt n, info;
+
+    PetscFunctionBegin;
+    PetscCall(PetscBLASIntCast(size, &n));
+    PetscCallBLAS("LAPACKgetrf", LAPACKgetrf_(&n, &n, A, &n, pivots, &info));
+    PetscCheck(!info, PETSC_COMM_SELF, PETSC_ERR_LIB, "Error while calling the Lapack routine DGETRF");
+    PetscFunctionReturn(0);
+}
+
+// Solve a factored system for nrhs column-major right-hand-sides. The solution overwrites B.
+static PetscErrorCode SolveSystem(PetscInt size, PetscInt numberRhs, PetscReal A[], PetscBLASInt pivots[], PetscReal B[]) {
+    PetscBLASInt n, nrhs, info;
+
+    PetscFunctionBegin;
+    PetscCall(PetscBLASIntCast(size, &n));
+    PetscCall(PetscBLASIntCast(numberRhs, &nrhs));
+    PetscCallBLAS("LAPACKgetrs", LAPACKgetrs_("N", &n, &nrhs, A, &n, pivots, B, &n, &info));
+    PetscCheck(!info, PETSC_COMM_SELF, PETSC_ERR_LIB, "Error while calling the Lapack routine DGETRS");
+    PetscFunctionReturn(0);
+}
+
+// Find the neighbors of a cell and append them to the stencil storage
 // c - Location in cellRange
-void RBF::Matrix(const PetscInt c) {
-    PetscInt i, j, d, px, py, pz, matSize;
+void RBF::SetupStencil(const PetscInt c) {
     PetscInt nCells, *list;
-    const PetscInt dim = RBF::subDomain->GetDimensions();
-    const PetscInt numPoly = RBF::nPoly, p = RBF::polyOrder, p1 = PetscMax(p + 1, 1);
-    Mat A;
-    PetscReal *x, *vals;
-    PetscReal x0[dim];  // Center of the cell of interest
-    PetscReal *xp;      // Powers of the cell centers
+    const PetscInt numPoly = RBF::nPoly, p = RBF::polyOrder;
     const DM dm = RBF::subDomain->GetSubDM();
 
     // Get the list of neighbor cells
@@ -146,19 +165,55 @@ void RBF::Matrix(const PetscInt c) {
                                     std::to_string(numPoly) + " number of cells.");
     }
 
-    PetscMalloc1(nCells * dim * p1, &xp) >> utilities::PetscUtilities::checkError;
+    RBF::nStencil[c - RBF::cStart] = nCells;
+    RBF::stencilOffset[c - RBF::cStart] = (PetscInt)RBF::stencilList.size();
+    RBF::stencilList.insert(RBF::stencilList.end(), list, list + nCells);
+
+    // Return the work arrays
+    DMPlexRestoreNeighbors(dm, c, -1, -1.0, RBF::minNumberCells, RBF::useCells, RBF::returnNeighborVertices, &nCells, &list) >> utilities::PetscUtilities::checkError;
+
+    // Store the locations, they are needed to assemble the matrix and to interpolate
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    RBF::stencilXLocs.resize(RBF::stencilList.size() * dim);
+    RBF::StencilLocations(c, &RBF::stencilXLocs[RBF::stencilOffset[c - RBF::cStart] * dim]);
+}
+
+// Shifted cell-centers of the neighbor cells
+// c - Location in cellRange
+void RBF::StencilLocations(const PetscInt c, PetscReal x[]) {
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt nCells = RBF::nStencil[c - RBF::cStart];
+    const PetscInt *list = &RBF::stencilList[RBF::stencilOffset[c - RBF::cStart]];
+    PetscReal x0[3];  // Center of the cell of interest
+    const DM dm = RBF::subDomain->GetSubDM();
 
     // Get the cell center
     DMPlexComputeCellGeometryFVM(dm, c, NULL, x0, NULL) >> utilities::PetscUtilities::checkError;
 
-    // Shifted cell-centers of neighbor cells
-    PetscMalloc1(nCells * dim, &x);
-    for (i = 0; i < nCells; ++i) {
+    for (PetscInt i = 0; i < nCells; ++i) {
         DMPlexComputeCellGeometryFVM(dm, list[i], NULL, &x[i * dim], NULL) >> utilities::PetscUtilities::checkError;
-        for (d = 0; d < dim; ++d) {
+        for (PetscInt d = 0; d < dim; ++d) {
             x[i * dim + d] -= x0[d];
+        }
+    }
+}
 
-            // Precompute the powers for later use
+// Assemble the augmented RBF matrix
+// c - Location in cellRange
+// x - Shifted cell-centers of the neighbor list
+// A - The (nCells + nPoly)^2 matrix
+void RBF::AssembleMatrix(const PetscInt c, const PetscReal x[], PetscReal A[]) {
+    PetscInt i, j, d, px, py, pz;
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt nCells = RBF::nStencil[c - RBF::cStart];
+    const PetscInt numPoly = RBF::nPoly, p1 = PetscMax(RBF::polyOrder + 1, 1);
+    const PetscInt matSize = nCells + numPoly;
+    PetscReal xi[3], xj[3];
+    std::vector<PetscReal> xp(nCells * dim * p1);  // Powers of the cell centers
+
+    // Precompute the powers for later use
+    for (i = 0; i < nCells; ++i) {
+        for (d = 0; d < dim; ++d) {
             xp[(i * dim + d) * p1 + 0] = 1.0;
             for (px = 1; px < p1; ++px) {
                 xp[(i * dim + d) * p1 + px] = xp[(i * dim + d) * p1 + (px - 1)] * x[i * dim + d];
@@ -166,20 +221,16 @@ void RBF::Matrix(const PetscInt c) {
         }
     }
 
-    matSize = nCells + numPoly;
-
-    // Create the matrix
-    MatCreateSeqDense(PETSC_COMM_SELF, matSize, matSize, NULL, &A) >> utilities::PetscUtilities::checkError;
-    PetscObjectSetName((PetscObject)A, "ablate::domain::RBF::A") >> utilities::PetscUtilities::checkError;
-    MatZeroEntries(A) >> utilities::PetscUtilities::checkError;
-    MatSetOption(A, MAT_SYMMETRIC, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
-
-    MatDenseGetArrayWrite(A, &vals) >> utilities::PetscUtilities::checkError;
+    std::fill(A, A + matSize * matSize, 0.0);
 
     // RBF contributions to the matrix
     for (i = 0; i < nCells; ++i) {
         for (j = i; j < nCells; ++j) {
-            vals[i * matSize + j] = vals[j * matSize + i] = RBFVal(dim, &x[i * dim], &x[j * dim]);
+            for (d = 0; d < dim; ++d) {
+                xi[d] = x[i * dim + d];
+                xj[d] = x[j * dim + d];
+            }
+            A[i * matSize + j] = A[j * matSize + i] = RBFVal(dim, xi, xj);
         }
     }
 
@@ -190,7 +241,7 @@ void RBF::Matrix(const PetscInt c) {
                 for (i = 0; i < nCells; ++i) {
                     j = nCells;
                     for (px = 0; px < p1; ++px) {
-                        vals[i * matSize + j] = vals[j * matSize + i] = xp[(i * dim + 0) * p1 + px];
+                        A[i * matSize + j] = A[j * matSize + i] = xp[(i * dim + 0) * p1 + px];
                         ++j;
                     }
                 }
@@ -200,7 +251,7 @@ void RBF::Matrix(const PetscInt c) {
                     j = nCells;
                     for (py = 0; py < p1; ++py) {
                         for (px = 0; px < p1 - py; ++px) {
-                            vals[i * matSize + j] = vals[j * matSize + i] = xp[(i * dim + 0) * p1 + px] * xp[(i * dim + 1) * p1 + py];
+                            A[i * matSize + j] = A[j * matSize + i] = xp[(i * dim + 0) * p1 + px] * xp[(i * dim + 1) * p1 + py];
                             ++j;
                         }
                     }
@@ -212,7 +263,7 @@ void RBF::Matrix(const PetscInt c) {
                     for (pz = 0; pz < p1; ++pz) {
                         for (py = 0; py < p1 - pz; ++py) {
                             for (px = 0; px < p1 - py - pz; ++px) {
-                                vals[i * matSize + j] = vals[j * matSize + i] = xp[(i * dim + 0) * p1 + px] * xp[(i * dim + 1) * p1 + py] * xp[(i * dim + 2) * p1 + pz];
+                                A[i * matSize + j] = A[j * matSize + i] = xp[(i * dim + 0) * p1 + px] * xp[(i * dim + 1) * p1 + py] * xp[(i * dim + 2) * p1 + pz];
                                 ++j;
                             }
                         }
@@ -220,27 +271,31 @@ void RBF::Matrix(const PetscInt c) {
                 }
                 break;
             default:
-                throw std::runtime_error("ablate::domain::RBF::Matrix encountered an unknown dimension.");
+                throw std::runtime_error("ablate::domain::RBF::AssembleMatrix encountered an unknown dimension.");
         }
     }
+}
 
-    MatDenseRestoreArrayWrite(A, &vals) >> utilities::PetscUtilities::checkError;
-    MatViewFromOptions(A, NULL, "-ablate::domain::rbf::RBF::A_view") >> utilities::PetscUtilities::checkError;
+// Compute and store the LU-factorization of the augmented RBF matrix
+// c - Location in cellRange
+void RBF::Matrix(const PetscInt c) {
+    if (RBF::nStencil[c - RBF::cStart] < 1) {
+        RBF::SetupStencil(c);
+    }
 
-    // Factor the matrix
-    MatLUFactor(A, NULL, NULL, NULL) >> utilities::PetscUtilities::checkError;
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt matSize = RBF::nStencil[c - RBF::cStart] + RBF::nPoly;
+    const PetscInt offset = (PetscInt)RBF::rbfFactors.size();
+    const PetscInt pOffset = (PetscInt)RBF::rbfPivots.size();
 
-    PetscFree(xp) >> utilities::PetscUtilities::checkError;
+    RBF::rbfFactors.resize(offset + matSize * matSize);
+    RBF::rbfPivots.resize(pOffset + matSize);
 
-    // Assign output
-    RBF::RBFMatrix[c] = A;
-    RBF::stencilXLocs[c] = x;
-    RBF::nStencil[c] = nCells;
-    PetscMalloc1(nCells, &(RBF::stencilList[c])) >> utilities::PetscUtilities::checkError;
-    PetscArraycpy(RBF::stencilList[c], list, nCells) >> utilities::PetscUtilities::checkError;
+    RBF::AssembleMatrix(c, &RBF::stencilXLocs[RBF::stencilOffset[c - RBF::cStart] * dim], &RBF::rbfFactors[offset]);
+    FactorSystem(matSize, &RBF::rbfFactors[offset], &RBF::rbfPivots[pOffset]) >> utilities::PetscUtilities::checkError;
 
-    // Return the work arrays
-    DMPlexRestoreNeighbors(dm, c, -1, -1.0, RBF::minNumberCells, RBF::useCells, RBF::returnNeighborVertices, &nCells, &list) >> utilities::PetscUtilities::checkError;
+    RBF::factorOffset[c - RBF::cStart] = offset;
+    RBF::pivotOffset[c - RBF::cStart] = pOffset;
 }
 
 /************ Begin Derivative Code **********************/
@@ -268,34 +323,29 @@ void RBF::SetDerivatives(PetscInt numDer, PetscInt dx[], PetscInt dy[], PetscInt
  */
 void RBF::SetDerivatives(PetscInt numDer, PetscInt dx[], PetscInt dy[], PetscInt dz[]) { RBF::SetDerivatives(numDer, dx, dy, dz, PETSC_FALSE); }
 
-// Compute the RBF weights at the cell center of p using a cell-list
-// c - The center cell in cellRange ordering
-void RBF::SetupDerivativeStencils(PetscInt c) {
-    if (RBF::RBFMatrix[c] == nullptr) {
-        RBF::Matrix(c);
-    }
-
-    Mat A = RBF::RBFMatrix[c], B = nullptr;
-    PetscReal *x = RBF::stencilXLocs[c];  // Shifted cell-centers of the neigbor list
-    PetscInt dim = RBF::subDomain->GetDimensions();
-    PetscInt nCells = RBF::nStencil[c];
-    PetscInt matSize = nCells + RBF::nPoly;
-    PetscInt numDer = RBF::nDer;
-    PetscInt *derXYZ = RBF::dxyz;
-    PetscInt i, j;
+// Assemble the derivatives of the RBF and augmented polynomials at the cell center
+// c - Location in cellRange
+// x - Shifted cell-centers of the neighbor list
+// B - The (nCells + nPoly) x nDer column-major right-hand-sides
+void RBF::AssembleDerivatives(const PetscInt c, const PetscReal x[], PetscReal B[]) {
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt nCells = RBF::nStencil[c - RBF::cStart];
+    const PetscInt matSize = nCells + RBF::nPoly;
+    const PetscInt numDer = RBF::nDer;
+    const PetscInt *derXYZ = RBF::dxyz;
+    PetscInt i, j, d;
     PetscInt px, py, pz, p1 = PetscMax(RBF::polyOrder + 1, 1);
-    PetscScalar *vals = nullptr;
+    PetscReal xi[3];
 
-    // Create the RHS
-    MatCreateSeqDense(PETSC_COMM_SELF, matSize, numDer, NULL, &B) >> utilities::PetscUtilities::checkError;
-    PetscObjectSetName((PetscObject)B, "ablate::domain::rbf::RBF::rhs") >> utilities::PetscUtilities::checkError;
-    MatZeroEntries(B) >> utilities::PetscUtilities::checkError;
-    MatDenseGetArrayWrite(B, &vals) >> utilities::PetscUtilities::checkError;
+    std::fill(B, B + matSize * numDer, 0.0);
 
     // Derivatives of the RBF
     for (i = 0; i < nCells; ++i) {
+        for (d = 0; d < dim; ++d) {
+            xi[d] = x[i * dim + d];
+        }
         for (j = 0; j < numDer; ++j) {
-            vals[i + j * matSize] = RBFDer(dim, &x[i * dim], derXYZ[j * 3 + 0], derXYZ[j * 3 + 1], derXYZ[j * 3 + 2]);
+            B[i + j * matSize] = RBFDer(dim, xi, derXYZ[j * 3 + 0], derXYZ[j * 3 + 1], derXYZ[j * 3 + 2]);
         }
     }
 
@@ -307,7 +357,7 @@ void RBF::SetupDerivativeStencils(PetscInt c) {
                     i = nCells;
                     for (px = 0; px < p1; ++px) {
                         if (derXYZ[j * 3 + 0] == px) {
-                            vals[i + j * matSize] = (PetscReal)fac[px];
+                            B[i + j * matSize] = (PetscReal)fac[px];
                         }
                         ++i;
                     }
@@ -319,7 +369,7 @@ void RBF::SetupDerivativeStencils(PetscInt c) {
                     for (py = 0; py < p1; ++py) {
                         for (px = 0; px < p1 - py; ++px) {
                             if (derXYZ[j * 3 + 0] == px && derXYZ[j * 3 + 1] == py) {
-                                vals[i + j * matSize] = (PetscReal)(fac[px] * fac[py]);
+                                B[i + j * matSize] = (PetscReal)(fac[px] * fac[py]);
                             }
                             ++i;
                         }
@@ -333,7 +383,7 @@ void RBF::SetupDerivativeStencils(PetscInt c) {
                         for (py = 0; py < p1 - pz; ++py) {
                             for (px = 0; px < p1 - py - pz; ++px) {
                                 if (derXYZ[j * 3 + 0] == px && derXYZ[j * 3 + 1] == py && derXYZ[j * 3 + 2] == pz) {
-                                    vals[i + j * matSize] = (PetscReal)(fac[px] * fac[py] * fac[pz]);
+                                    B[i + j * matSize] = (PetscReal)(fac[px] * fac[py] * fac[pz]);
                                 }
                                 ++i;
                             }
@@ -342,47 +392,123 @@ void RBF::SetupDerivativeStencils(PetscInt c) {
                 }
                 break;
             default:
-                throw std::runtime_error("ablate::domain::RBF::SetupDerivativeStencils encountered an unknown dimension.");
+                throw std::runtime_error("ablate::domain::RBF::AssembleDerivatives encountered an unknown dimension.");
         }
     }
+}
 
-    MatDenseRestoreArrayWrite(B, &vals) >> utilities::PetscUtilities::checkError;
-
-    MatViewFromOptions(B, NULL, "-ablate::domain::rbf::RBF::rhs_view") >> utilities::PetscUtilities::checkError;
-
-    MatMatSolve(A, B, B) >> utilities::PetscUtilities::checkError;
-
-    MatViewFromOptions(B, NULL, "-ablate::domain::rbf::RBF::sol_view") >> utilities::PetscUtilities::checkError;
-
-    // Now populate the output
-    PetscMalloc1(numDer * nCells, &(RBF::stencilWeights[c])) >> utilities::PetscUtilities::checkError;
-    PetscReal *wt = RBF::stencilWeights[c];
-    MatDenseGetArrayWrite(B, &vals) >> utilities::PetscUtilities::checkError;
-    for (i = 0; i < nCells; ++i) {
-        for (j = 0; j < numDer; ++j) {
-            wt[i * numDer + j] = vals[i + j * matSize];
+// Copy the solution of the derivative systems into the weight storage
+// c - Location in cellRange
+// B - The solved (nCells + nPoly) x nDer column-major right-hand-sides
+void RBF::StoreWeights(const PetscInt c, const PetscReal B[]) {
+    const PetscInt nCells = RBF::nStencil[c - RBF::cStart];
+    const PetscInt matSize = nCells + RBF::nPoly;
+    const PetscInt numDer = RBF::nDer;
+    const PetscInt offset = (PetscInt)RBF::stencilWeights.size();
+
+    RBF::stencilWeights.resize(offset + nCells * numDer);
+    PetscReal *wt = &RBF::stencilWeights[offset];
+    for (PetscInt i = 0; i < nCells; ++i) {
+        for (PetscInt j = 0; j < numDer; ++j) {
+            wt[i * numDer + j] = B[i + j * matSize];
         }
     }
-    MatDenseGetArrayWrite(B, &vals) >> utilities::PetscUtilities::checkError;
+    RBF::weightOffset[c - RBF::cStart] = offset;
+}
+
+// Compute the RBF weights at the cell center of p using a cell-list
+// c - The center cell in cellRange ordering
+void RBF::SetupDerivativeStencils(PetscInt c) {
+    // The stored factors are reused when interpolation is required, otherwise the matrix is only needed until the weights are computed
+    if (RBF::hasInterpolation && RBF::factorOffset[c - RBF::cStart] < 0) {
+        RBF::Matrix(c);
+    } else if (RBF::nStencil[c - RBF::cStart] < 1) {
+        RBF::SetupStencil(c);
+    }
+
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt nCells = RBF::nStencil[c - RBF::cStart];
+    const PetscInt matSize = nCells + RBF::nPoly;
+    const PetscReal *x = &RBF::stencilXLocs[RBF::stencilOffset[c - RBF::cStart] * dim];
+    std::vector<PetscReal> B(matSize * RBF::nDer);
 
-    // The matrix is only needed in the future if interpolation is required. If not then
-    //    the stencil list is enough.
+    RBF::AssembleDerivatives(c, x, B.data());
     if (RBF::hasInterpolation) {
-        RBF::RBFMatrix[c] = A;
-        RBF::stencilXLocs[c] = x;
+        SolveSystem(matSize, RBF::nDer, &RBF::rbfFactors[RBF::factorOffset[c - RBF::cStart]], &RBF::rbfPivots[RBF::pivotOffset[c - RBF::cStart]], B.data()) >>
+            utilities::PetscUtilities::checkError;
     } else {
-        MatDestroy(&A) >> utilities::PetscUtilities::checkError;
-        PetscFree(x) >> utilities::PetscUtilities::checkError;
+        std::vector<PetscReal> A(matSize * matSize);
+        std::vector<PetscBLASInt> pivots(matSize);
+        RBF::AssembleMatrix(c, x, A.data());
+        FactorSystem(matSize, A.data(), pivots.data()) >> utilities::PetscUtilities::checkError;
+        SolveSystem(matSize, RBF::nDer, A.data(), pivots.data(), B.data()) >> utilities::PetscUtilities::checkError;
     }
-    MatDestroy(&B) >> utilities::PetscUtilities::checkError;
+
+    RBF::StoreWeights(c, B.data());
 }
 
 /*
- * Setup all derivative stencils for the entire subDomain
+ * Setup all derivative stencils for the entire subDomain. The neighbor lists are found first so that cells with the same system size can be assembled
+ * into contiguous buffers and factored/solved together in batches.
  */
 void RBF::SetupDerivativeStencils() {
+    const PetscInt dim = RBF::subDomain->GetDimensions();
+    const PetscInt numDer = RBF::nDer;
+
+    // Group the remaining cells by the size of their augmented system
+    std::map<PetscInt, std::vector<PetscInt>> cellsBySize;
+    PetscInt numberWeights = 0;
     for (PetscInt c = cStart; c < cEnd; ++c) {
-        RBF::SetupDerivativeStencils(RBF::cellList[c]);
+        if (RBF::weightOffset[c - RBF::cStart] >= 0) {
+            continue;
+        }
+        if (RBF::nStencil[c - RBF::cStart] < 1) {
+            RBF::SetupStencil(c);
+        }
+        cellsBySize[RBF::nStencil[c - RBF::cStart] + RBF::nPoly].push_back(c);
+        numberWeights += RBF::nStencil[c - RBF::cStart] * numDer;
+    }
+    RBF::stencilWeights.reserve(RBF::stencilWeights.size() + numberWeights);
+
+    std::vector<PetscReal> A, B;
+    std::vector<PetscBLASInt> pivots;
+    for (const auto &[matSize, cells] : cellsBySize) {
+        const PetscInt matStride = matSize * matSize, rhsStride = matSize * numDer;
+
+        A.resize(batchSize * matStride);
+        B.resize(batchSize * rhsStride);
+        pivots.resize(batchSize * matSize);
+
+        for (std::size_t start = 0; start < cells.size(); start += batchSize) {
+            const std::size_t end = PetscMin(start + batchSize, cells.size());
+
+            // Assemble every system in the batch
+            for (std::size_t b = start; b < end; ++b) {
+                const PetscInt c = cells[b];
+                const PetscReal *xc = &RBF::stencilXLocs[RBF::stencilOffset[c - RBF::cStart] * dim];
+                RBF::AssembleMatrix(c, xc, &A[(b - start) * matStride]);
+                RBF::AssembleDerivatives(c, xc, &B[(b - start) * rhsStride]);
+            }
+
+            // Factor and solve over the contiguous buffers
+            for (std::size_t b = 0; b < end - start; ++b) {
+                FactorSystem(matSize, &A[b * matStride], &pivots[b * matSize]) >> utilities::PetscUtilities::checkError;
+                SolveSystem(matSize, numDer, &A[b * matStride], &pivots[b * matSize], &B[b * rhsStride]) >> utilities::PetscUtilities::checkError;
+            }
+
+            // Keep the weights, and the factors if they will be needed for interpolation
+            for (std::size_t b = start; b < end; ++b) {
+                const PetscInt c = cells[b];
+                RBF::StoreWeights(c, &B[(b - start) * rhsStride]);
+
+                if (RBF::hasInterpolation && RBF::factorOffset[c - RBF::cStart] < 0) {
+                    RBF::factorOffset[c - RBF::cStart] = (PetscInt)RBF::rbfFactors.size();
+                    RBF::pivotOffset[c - RBF::cStart] = (PetscInt)RBF::rbfPivots.size();
+                    RBF::rbfFactors.insert(RBF::rbfFactors.end(), A.begin() + (b - start) * matStride, A.begin() + (b - start + 1) * matStride);
+                    RBF::rbfPivots.insert(RBF::rbfPivots.end(), pivots.begin() + (b - start) * matSize, pivots.begin() + (b - start + 1) * matSize);
+                }
+            }
+        }
     }
 }
 
@@ -408,13 +534,13 @@ PetscReal RBF::EvalDer(const ablate::domain::Field *field, Vec vec, PetscInt c,
     PetscHMapIGet(RBF::hash, derKey, &derID);
 
     // If the stencil hasn't been setup yet do so
-    if (RBF::nStencil[c] < 1) {
+    if (RBF::weightOffset[c - RBF::cStart] < 0) {
         RBF::SetupDerivativeStencils(c);
     }
 
-    wt = RBF::stencilWeights[c];
-    nCells = RBF::nStencil[c];
-    lst = RBF::stencilList[c];
+    wt = &RBF::stencilWeights[RBF::weightOffset[c - RBF::cStart]];
+    nCells = RBF::nStencil[c - RBF::cStart];
+    lst = &RBF::stencilList[RBF::stencilOffset[c - RBF::cStart]];
 
     VecGetArrayRead(vec, &array) >> utilities::PetscUtilities::checkError;
 
@@ -444,11 +570,9 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, PetscReal xEval[3
 
 PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal xEval[3]) {
     PetscInt i, c, nCells, *lst;
-    PetscScalar *vals, *v;
+    PetscScalar *v;
     const PetscScalar *fvals;
     PetscReal *x, x0[3];
-    Mat A;
-    Vec weights, rhs;
     DM dm = RBF::subDomain->GetFieldDM(*field);
     const PetscInt fid = field->id;
 
@@ -459,23 +583,17 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
                                  std::to_string(xEval[2]) + ").");
     }
 
-    if (RBF::RBFMatrix[c] == nullptr) {
+    if (RBF::factorOffset[c - RBF::cStart] < 0) {
         RBF::Matrix(c);
     }
 
-    A = RBF::RBFMatrix[c];
-    x = RBF::stencilXLocs[c];
-
-    nCells = RBF::nStencil[c];
-    lst = RBF::stencilList[c];
+    nCells = RBF::nStencil[c - RBF::cStart];
+    lst = &RBF::stencilList[RBF::stencilOffset[c - RBF::cStart]];
+    x = &RBF::stencilXLocs[RBF::stencilOffset[c - RBF::cStart] * subDomain->GetDimensions()];
 
-    MatCreateVecs(A, &weights, &rhs) >> utilities::PetscUtilities::checkError;
-    VecZeroEntries(weights) >> utilities::PetscUtilities::checkError;
-    VecZeroEntries(rhs) >> utilities::PetscUtilities::checkError;
-
-    // The function values
+    // The function values, with zeros for the augmented polynomial
+    std::vector<PetscReal> vals(nCells + RBF::nPoly, 0.0);
     VecGetArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
-    VecGetArray(rhs, &vals) >> utilities::PetscUtilities::checkError;
 
     for (i = 0; i < nCells; ++i) {
         // DMPlexPointLocalFieldRead isn't behaving like I would expect. If I don't make f a pointer then it just returns zero.
@@ -490,11 +608,10 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
     }
 
     VecRestoreArrayRead(f, &fvals) >> utilities::PetscUtilities::checkError;
-    VecRestoreArray(rhs, &vals) >> utilities::PetscUtilities::checkError;
-
-    MatSolve(A, rhs, weights) >> utilities::PetscUtilities::checkError;
 
-    VecDestroy(&rhs) >> utilities::PetscUtilities::checkError;
+    // Solve for the weights in place
+    SolveSystem(nCells + RBF::nPoly, 1, &RBF::rbfFactors[RBF::factorOffset[c - RBF::cStart]], &RBF::rbfPivots[RBF::pivotOffset[c - RBF::cStart]], vals.data()) >>
+        utilities::PetscUtilities::checkError;
 
     // Now do the actual interpolation
 
@@ -517,7 +634,6 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
     }
 
     PetscReal interpVal = 0.0;
-    VecGetArray(weights, &vals) >> utilities::PetscUtilities::checkError;
     for (i = 0; i < nCells; ++i) {
         interpVal += vals[i] * RBFVal(dim, x0, &x[i * dim]);
     }
@@ -549,8 +665,6 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
             throw std::runtime_error("ablate::domain::RBF::Interpolate encountered an unknown dimension.");
     }
 
-    VecRestoreArray(weights, &vals) >> utilities::PetscUtilities::checkError;
-    VecDestroy(&weights) >> utilities::PetscUtilities::checkError;
     PetscFree(xp) >> utilities::PetscUtilities::checkError;
 
     return interpVal;
@@ -562,15 +676,6 @@ PetscReal RBF::Interpolate(const ablate::domain::Field *field, Vec f, PetscReal
 RBF::RBF(int polyOrder, bool hasDerivatives, bool hasInterpolation) : polyOrder(polyOrder), hasDerivatives(hasDerivatives), hasInterpolation(hasInterpolation) {}
 
 RBF::~RBF() {
-    if ((RBF::cEnd - RBF::cStart) > 0) {
-        for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
-            PetscFree(RBF::stencilList[c]);
-            if (RBF::RBFMatrix[c]) MatDestroy(&(RBF::RBFMatrix[c]));
-            PetscFree(RBF::stencilWeights[c]);
-            PetscFree(RBF::stencilXLocs[c]);
-        }
-        PetscFree6(RBF::cellList, RBF::nStencil, RBF::stencilList, RBF::RBFMatrix, RBF::stencilXLocs, RBF::stencilWeights) >> utilities::PetscUtilities::checkError;
-    }
     if (dxyz) {
         PetscFree(dxyz);
     }
@@ -674,41 +779,20 @@ void RBF::Setup(std::shared_ptr<ablate::domain::SubDomain> subDomainIn) {
 }
 
 void RBF::Initialize(ablate::domain::Range cellRange) {
-    // If this is called due to a grid change then release the old memory. In this case cEnd - cStart will be greater than zero.
-    if ((RBF::cEnd - RBF::cStart) > 0) {
-        for (PetscInt c = RBF::cStart; c < RBF::cEnd; ++c) {
-            PetscFree(RBF::stencilList[c]);
-            if (RBF::RBFMatrix[c]) MatDestroy(&(RBF::RBFMatrix[c]));
-            PetscFree(RBF::stencilWeights[c]);
-            PetscFree(RBF::stencilXLocs[c]);
-        }
-        PetscFree6(RBF::cellList, RBF::nStencil, RBF::stencilList, RBF::RBFMatrix, RBF::stencilXLocs, RBF::stencilWeights) >> utilities::PetscUtilities::checkError;
-    }
-
     RBF::cStart = cellRange.start;
     RBF::cEnd = cellRange.end;
 
-    // Both interpolation and derivatives need the list of points
+    // If this is called due to a grid change then release the old stencils. The per-cell offsets index into the shared buffers.
     PetscInt nCells = RBF::cEnd - RBF::cStart;
-    PetscMalloc6(nCells, &(RBF::cellList), nCells, &(RBF::nStencil), nCells, &(RBF::stencilList), nCells, &(RBF::RBFMatrix), nCells, &(RBF::stencilXLocs), nCells, &(RBF::stencilWeights)) >>
-        utilities::PetscUtilities::checkError;
-
-    // Shift so that we can use cell range directly
-    RBF::cellList -= cStart;
-    RBF::nStencil -= cStart;
-    RBF::stencilList -= cStart;
-    RBF::RBFMatrix -= cStart;
-    RBF::stencilXLocs -= cStart;
-    RBF::stencilWeights -= cStart;
-
-    for (PetscInt c = cStart; c < cEnd; ++c) {
-        RBF::cellList[c] = cellRange.GetPoint(c);
-
-        RBF::nStencil[c] = -1;
-        RBF::stencilList[c] = nullptr;
-
-        RBF::RBFMatrix[c] = nullptr;
-        RBF::stencilXLocs[c] = nullptr;
-        RBF::stencilWeights[c] = nullptr;
-    }
+    RBF::nStencil.assign(nCells, -1);
+    RBF::stencilOffset.assign(nCells, -1);
+    RBF::weightOffset.assign(nCells, -1);
+    RBF::factorOffset.assign(nCells, -1);
+    RBF::pivotOffset.assign(nCells, -1);
+
+    RBF::stencilList.clear();
+    RBF::stencilXLocs.clear();
+    RBF::stencilWeights.clear();
+    RBF::rbfFactors.clear();
+    RBF::rbfPivots.clear();
 }
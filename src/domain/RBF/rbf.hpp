@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_RBF_HPP
 #include <petsc.h>
 #include <petsc/private/hashmapi.h>
+#include <petscblaslapack.h>
+#include <vector>
 #include "domain/range.hpp"  // For domain::Range
 #include "domain/subDomain.hpp"
 #include "utilities/petscSupport.hpp"
@@ -24,17 +26,23 @@ class RBF {
 
     // Information from the subDomain cell range
     PetscInt cStart = 0, cEnd = 0;  // The cell range
-    PetscInt *cellList;             // List of the cells to compute over. Length of cEnd - cStart
 
     // Derivative data
     const bool hasDerivatives;
-    PetscInt nDer = 0;                     // Number of derivative stencils which are pre-computed
-    PetscInt *dxyz = nullptr;              // The derivatives which have been setup
-    PetscHMapI hash = nullptr;             // Hash of the derivative
-    PetscInt *nStencil = nullptr;          // Length of each stencil. Needed for both derivatives and interpolation.
-    PetscInt **stencilList = nullptr;      // IDs of the points in the stencil. Needed for both derivatives and interpolation.
-    PetscReal **stencilWeights = nullptr;  // Weights of the points in the stencil. Needed only for derivatives.
-    PetscReal **stencilXLocs = nullptr;    // Locations wrt a cell center. Needed only for interpolation.
+    PetscInt nDer = 0;          // Number of derivative stencils which are pre-computed
+    PetscInt *dxyz = nullptr;   // The derivatives which have been setup
+    PetscHMapI hash = nullptr;  // Hash of the derivative
+
+    // Stencil data. Each cell holds offsets into shared contiguous buffers rather than its own allocations. All per-cell arrays are indexed by c - cStart.
+    std::vector<PetscInt> nStencil;         // Length of each stencil, -1 if it has not been setup. Needed for both derivatives and interpolation.
+    std::vector<PetscInt> stencilOffset;    // Offset of each stencil into stencilList. Locations are offset by dim times this value.
+    std::vector<PetscInt> stencilList;      // IDs of the points in all stencils. Needed for both derivatives and interpolation.
+    std::vector<PetscReal> stencilXLocs;    // Locations wrt a cell center. Needed for both derivatives and interpolation.
+    std::vector<PetscInt> weightOffset;     // Offset of each cell into stencilWeights, -1 if the weights have not been computed
+    std::vector<PetscReal> stencilWeights;  // Weights of the points in the stencil, nDer per point. Needed only for derivatives.
+
+    // The number of systems assembled and factored together when setting up all derivative stencils
+    static inline constexpr std::size_t batchSize = 256;
 
     // The derivative->key map for the hash
     PetscInt derivativeKey(PetscInt dx, PetscInt dy, PetscInt dz) const { return (100 * dx + 10 * dy + dz); };
@@ -43,9 +51,27 @@ class RBF {
     void SetupDerivativeStencils(PetscInt c);
 
     const bool hasInterpolation;
-    Mat *RBFMatrix = nullptr;
+    std::vector<PetscInt> factorOffset;   // Offset of each cell into rbfFactors, -1 if it has not been factored
+    std::vector<PetscInt> pivotOffset;    // Offset of each cell into rbfPivots
+    std::vector<PetscReal> rbfFactors;    // The LU-factors of the augmented RBF matrices, column-major. Only stored when interpolation is required or used.
+    std::vector<PetscBLASInt> rbfPivots;  // The pivots of the LU-factors
+
+    // Find the neighbor list of a cell and append it to the stencil storage
+    void SetupStencil(PetscInt c);
+
+    // Compute the shifted cell-centers of the stencil of a cell. x must have room for nStencil[c]*dim values.
+    void StencilLocations(PetscInt c, PetscReal x[]);
+
+    // Assemble the augmented RBF matrix (matSize x matSize) of a cell given the shifted cell-centers
+    void AssembleMatrix(PetscInt c, const PetscReal x[], PetscReal A[]);
+
+    // Assemble the derivative right-hand-sides (matSize x nDer, column-major) of a cell given the shifted cell-centers
+    void AssembleDerivatives(PetscInt c, const PetscReal x[], PetscReal B[]);
+
+    // Copy the solved derivative weights of a cell into the weight storage
+    void StoreWeights(PetscInt c, const PetscReal B[]);
 
-    // Compute the LU-decomposition of the augmented RBF matrix given a cell list.
+    // Compute and store the LU-decomposition of the augmented RBF matrix of a cell
     void Matrix(const PetscInt c);
 
     void CheckField(const ablate::domain::Field *field);  // Checks whether the field is SOL or AUX
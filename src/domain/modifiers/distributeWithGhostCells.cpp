@@ -1,15 +1,35 @@
 #include "distributeWithGhostCells.hpp"
+#include <utility>
+#include <vector>
 #include "utilities/petscUtilities.hpp"
 
-ablate::domain::modifiers::DistributeWithGhostCells::DistributeWithGhostCells(int ghostCellDepthIn) : ghostCellDepth(ghostCellDepthIn < 1 ? 2 : ghostCellDepthIn) {}
+ablate::domain::modifiers::DistributeWithGhostCells::DistributeWithGhostCells(int ghostCellDepthIn, std::shared_ptr<mathFunctions::MathFunction> cellWeight)
+    : ghostCellDepth(ghostCellDepthIn < 1 ? 2 : ghostCellDepthIn), cellWeight(std::move(cellWeight)) {}
 void ablate::domain::modifiers::DistributeWithGhostCells::Modify(DM &dm) {
     // Make sure that the flow is set up distributed
     DM dmDist;
 
+    // if weighted, temporarily replace the partitioner with the precomputed weighted partition
+    PetscPartitioner originalPartitioner = nullptr;
+    if (cellWeight) {
+        PetscPartitioner weightedPartitioner;
+        CreateWeightedPartitioner(dm, &weightedPartitioner) >> utilities::PetscUtilities::checkError;
+        DMPlexGetPartitioner(dm, &originalPartitioner) >> utilities::PetscUtilities::checkError;
+        PetscObjectReference((PetscObject)originalPartitioner) >> utilities::PetscUtilities::checkError;
+        DMPlexSetPartitioner(dm, weightedPartitioner) >> utilities::PetscUtilities::checkError;
+        PetscPartitionerDestroy(&weightedPartitioner) >> utilities::PetscUtilities::checkError;
+    }
+
     // create any ghost cells that are needed
     DMPlexDistribute(dm, ghostCellDepth, NULL, &dmDist) >> utilities::PetscUtilities::checkError;
     ReplaceDm(dm, dmDist);
 
+    // restore the original partitioner so that the shell partition is not reused
+    if (originalPartitioner) {
+        DMPlexSetPartitioner(dm, originalPartitioner) >> utilities::PetscUtilities::checkError;
+        PetscPartitionerDestroy(&originalPartitioner) >> utilities::PetscUtilities::checkError;
+    }
+
     // if we are using ghost cells, set the adjacency for fvm
     DMSetBasicAdjacency(dm, PETSC_TRUE, PETSC_FALSE) >> utilities::PetscUtilities::checkError;
 
@@ -80,6 +100,86 @@ PetscErrorCode ablate::domain::modifiers::DistributeWithGhostCells::TagMpiGhostC
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::domain::modifiers::DistributeWithGhostCells::CreateWeightedPartitioner(DM dm, PetscPartitioner *weightedPartitioner) const {
+    PetscFunctionBegin;
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+    PetscMPIInt size;
+    PetscCallMPI(MPI_Comm_size(comm, &size));
+
+    // build the cell adjacency graph used by the partitioner
+    PetscInt numberVertices;
+    PetscInt *offsets = nullptr, *adjacency = nullptr;
+    IS globalNumbering;
+    PetscCall(DMPlexCreatePartitionerGraph(dm, 0, &numberVertices, &offsets, &adjacency, &globalNumbering));
+
+    // the graph vertices are the locally owned cells in order
+    PetscInt cStart;
+    PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, nullptr));
+    PetscInt numberGraphCells;
+    const PetscInt *globalNumberingIndices;
+    PetscCall(ISGetLocalSize(globalNumbering, &numberGraphCells));
+    PetscCall(ISGetIndices(globalNumbering, &globalNumberingIndices));
+    std::vector<PetscInt> vertexCells;
+    vertexCells.reserve(numberVertices);
+    for (PetscInt i = 0; i < numberGraphCells; ++i) {
+        if (globalNumberingIndices[i] >= 0) {
+            vertexCells.push_back(cStart + i);
+        }
+    }
+    PetscCall(ISRestoreIndices(globalNumbering, &globalNumberingIndices));
+    PetscCall(ISDestroy(&globalNumbering));
+    PetscCheck((PetscInt)vertexCells.size() == numberVertices, comm, PETSC_ERR_PLIB, "The partitioner graph does not match the local cells");
+
+    // store the integer weight for each vertex as the dof in a section
+    PetscInt coordinateDimension;
+    PetscCall(DMGetCoordinateDim(dm, &coordinateDimension));
+    PetscSection vertexSection;
+    PetscCall(PetscSectionCreate(PETSC_COMM_SELF, &vertexSection));
+    PetscCall(PetscSectionSetChart(vertexSection, 0, numberVertices));
+    for (PetscInt v = 0; v < numberVertices; ++v) {
+        PetscReal centroid[3] = {0.0, 0.0, 0.0};
+        PetscCall(DMPlexComputeCellGeometryFVM(dm, vertexCells[v], nullptr, centroid, nullptr));
+        const PetscReal weight = cellWeight->Eval(centroid, (int)coordinateDimension, 0.0);
+        PetscCall(PetscSectionSetDof(vertexSection, v, PetscMax(1, (PetscInt)PetscRoundReal(weight))));
+    }
+    PetscCall(PetscSectionSetUp(vertexSection));
+
+    // partition using the dm's partitioner, this must be a partitioner that supports vertex weights such as parmetis or ptscotch
+    PetscPartitioner partitioner;
+    PetscCall(DMPlexGetPartitioner(dm, &partitioner));
+    PetscCall(PetscPartitionerSetUp(partitioner));
+    PetscSection partSection;
+    PetscCall(PetscSectionCreate(comm, &partSection));
+    IS partition;
+#if PETSC_VERSION_GE(3, 20, 0)
+    PetscCall(PetscPartitionerPartition(partitioner, size, numberVertices, offsets, adjacency, vertexSection, nullptr, nullptr, partSection, &partition));
+#else
+    PetscCall(PetscPartitionerPartition(partitioner, size, numberVertices, offsets, adjacency, vertexSection, nullptr, partSection, &partition));
+#endif
+    PetscCall(PetscFree(offsets));
+    PetscCall(PetscFree(adjacency));
+    PetscCall(PetscSectionDestroy(&vertexSection));
+
+    // store the precomputed partition in a shell partitioner used by DMPlexDistribute.  The partition is ordered by rank and holds graph vertex indices, DMPlexDistribute maps these back
+    // to cells using the same partitioner graph
+    std::vector<PetscInt> sizes(size);
+    for (PetscMPIInt rank = 0; rank < size; ++rank) {
+        PetscCall(PetscSectionGetDof(partSection, rank, &sizes[rank]));
+    }
+    const PetscInt *partitionIndices;
+    PetscCall(ISGetIndices(partition, &partitionIndices));
+    PetscCall(PetscPartitionerCreate(comm, weightedPartitioner));
+    PetscCall(PetscPartitionerSetType(*weightedPartitioner, PETSCPARTITIONERSHELL));
+    PetscCall(PetscPartitionerShellSetPartition(*weightedPartitioner, size, sizes.data(), partitionIndices));
+    PetscCall(ISRestoreIndices(partition, &partitionIndices));
+    PetscCall(ISDestroy(&partition));
+    PetscCall(PetscSectionDestroy(&partSection));
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::DistributeWithGhostCells, "Distribute DMPlex with ghost cells",
-         OPT(int, "ghostCellDepth", "the number of ghost cells to share on the boundary.  Default is 1."));
\ No newline at end of file
+         OPT(int, "ghostCellDepth", "the number of ghost cells to share on the boundary.  Default is 1."),
+         OPT(ablate::mathFunctions::MathFunction, "cellWeight",
+             "optional function describing the relative cost of each cell.  The value at each cell centroid is rounded to an integer weight (minimum of 1) used by the initial partition only, the "
+             "mesh is not repartitioned during the run."));
\ No newline at end of file
@@ -1,14 +1,32 @@
 #ifndef ABLATELIBRARY_DISTRIBUTEWITHGHOSTCELLS_HPP
 #define ABLATELIBRARY_DISTRIBUTEWITHGHOSTCELLS_HPP
 
+#include <memory>
+#include "mathFunctions/mathFunction.hpp"
 #include "modifier.hpp"
 
 namespace ablate::domain::modifiers {
 
+/**
+ * Distributes the DMPlex with ghost cells.  An optional cell weight function can be provided to describe the relative cost of each cell (e.g. where
+ * chemistry or soot is expected) so that each rank is assigned a balanced amount of work instead of an equal number of cells.  The weights are only used for this static, initial
+ * partition; the mesh is not repartitioned as the cost changes during the run.
+ */
 class DistributeWithGhostCells : public Modifier {
    private:
     const int ghostCellDepth;
 
+    //! optional function evaluated at each cell centroid to determine the relative cost of the cell
+    const std::shared_ptr<mathFunctions::MathFunction> cellWeight;
+
+    /**
+     * Computes a partition using the cellWeight as vertex weights with the dm's partitioner and stores the result (as partitioner graph vertices) in a shell partitioner
+     * @param dm the dm to be distributed
+     * @param weightedPartitioner the new shell partitioner holding the weighted partition
+     * @return
+     */
+    PetscErrorCode CreateWeightedPartitioner(DM dm, PetscPartitioner *weightedPartitioner) const;
+
     /***
      * Tags the mpi ghost cells. This is a duplicate of the DMPlexCreateVTKLabel_Internal call in PETSc but works without calling DMPlexConstructGhostCells
      * @param dm
@@ -18,7 +36,11 @@ class DistributeWithGhostCells : public Modifier {
     PetscErrorCode TagMpiGhostCells(DM dmNew);
 
    public:
-    explicit DistributeWithGhostCells(int ghostCellDepth = {});
+    /**
+     * @param ghostCellDepth the number of ghost cells to share on the boundary
+     * @param cellWeight optional function for the relative cost of each cell, rounded to an integer weight of at least one
+     */
+    explicit DistributeWithGhostCells(int ghostCellDepth = {}, std::shared_ptr<mathFunctions::MathFunction> cellWeight = {});
 
     void Modify(DM&) override;
 
@@ -0,0 +1,395 @@
+#include "reorderMesh.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace {
+/**
+ * Collect the cells that can be reordered (all cells but fvm ghost cells) and the face neighbors of each
+ */
+void GetCellGraph(DM dm, std::vector<PetscInt>& cells, std::vector<std::vector<PetscInt>>& neighbors) {
+    PetscInt cStart, cEnd, fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> ablate::utilities::PetscUtilities::checkError;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> ablate::utilities::PetscUtilities::checkError;
+
+    // store the index of each movable cell
+    std::vector<PetscInt> cellIndex(cEnd - cStart, -1);
+    cells.clear();
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        DMPolytopeType cellType;
+        DMPlexGetCellType(dm, c, &cellType) >> ablate::utilities::PetscUtilities::checkError;
+        if (cellType != DM_POLYTOPE_FV_GHOST) {
+            cellIndex[c - cStart] = (PetscInt)cells.size();
+            cells.push_back(c);
+        }
+    }
+
+    // cells are neighbors if they share a face
+    neighbors.assign(cells.size(), {});
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        PetscInt coneSize;
+        const PetscInt* cone;
+        DMPlexGetConeSize(dm, cells[i], &coneSize) >> ablate::utilities::PetscUtilities::checkError;
+        DMPlexGetCone(dm, cells[i], &cone) >> ablate::utilities::PetscUtilities::checkError;
+        for (PetscInt f = 0; f < coneSize; ++f) {
+            if (cone[f] < fStart || cone[f] >= fEnd) {
+                continue;
+            }
+            PetscInt supportSize;
+            const PetscInt* support;
+            DMPlexGetSupportSize(dm, cone[f], &supportSize) >> ablate::utilities::PetscUtilities::checkError;
+            DMPlexGetSupport(dm, cone[f], &support) >> ablate::utilities::PetscUtilities::checkError;
+            for (PetscInt s = 0; s < supportSize; ++s) {
+                if (support[s] != cells[i] && support[s] >= cStart && support[s] < cEnd && cellIndex[support[s] - cStart] >= 0) {
+                    neighbors[i].push_back(cellIndex[support[s] - cStart]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Spread the lower 21 bits so that there are two zero bits between each bit
+ */
+uint64_t SpreadBits(uint64_t value) {
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+}  // namespace
+
+ablate::domain::modifiers::ReorderMesh::ReorderMesh(Ordering ordering, bool reportBandwidth) : ordering(ordering), reportBandwidth(reportBandwidth) {}
+
+void ablate::domain::modifiers::ReorderMesh::Modify(DM& dm) {
+    PetscInt bandwidthBefore = reportBandwidth ? ComputeCellBandwidth(dm) : 0;
+
+    // order the movable cells
+    std::vector<PetscInt> cells;
+    std::vector<std::vector<PetscInt>> neighbors;
+    GetCellGraph(dm, cells, neighbors);
+    auto order = OrderCells(dm, cells, neighbors);
+
+    // the fvm ghost cells keep their original order at the end of the cell stratum
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    std::vector<PetscInt> cellOrder;
+    cellOrder.reserve(cEnd - cStart);
+    for (const auto& index : order) {
+        cellOrder.push_back(cells[index]);
+    }
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        DMPolytopeType cellType;
+        DMPlexGetCellType(dm, c, &cellType) >> utilities::PetscUtilities::checkError;
+        if (cellType == DM_POLYTOPE_FV_GHOST) {
+            cellOrder.push_back(c);
+        }
+    }
+
+    // permute all points in the dm
+    IS permutation;
+    CreatePointPermutation(dm, cellOrder, &permutation) >> utilities::PetscUtilities::checkError;
+    DM permutedDm;
+    DMPlexPermute(dm, permutation, &permutedDm) >> utilities::PetscUtilities::checkError;
+    PermutePointSF(dm, permutation, permutedDm) >> utilities::PetscUtilities::checkError;
+    ISDestroy(&permutation) >> utilities::PetscUtilities::checkError;
+
+    // copy over the adjacency used for fvm
+    PetscBool useCone, useClosure;
+    DMGetBasicAdjacency(dm, &useCone, &useClosure) >> utilities::PetscUtilities::checkError;
+    DMSetBasicAdjacency(permutedDm, useCone, useClosure) >> utilities::PetscUtilities::checkError;
+    PetscInt vtkCellHeight;
+    DMPlexGetVTKCellHeight(dm, &vtkCellHeight) >> utilities::PetscUtilities::checkError;
+    DMPlexSetVTKCellHeight(permutedDm, vtkCellHeight) >> utilities::PetscUtilities::checkError;
+
+    ReplaceDm(dm, permutedDm);
+
+    if (reportBandwidth) {
+        PetscInt bandwidthAfter = ComputeCellBandwidth(dm);
+        std::stringstream message;
+        message << ToString() << " cell bandwidth: " << bandwidthBefore << " -> " << bandwidthAfter << std::endl;
+        PetscPrintf(PetscObjectComm((PetscObject)dm), "%s", message.str().c_str()) >> utilities::PetscUtilities::checkError;
+    }
+}
+
+std::vector<PetscInt> ablate::domain::modifiers::ReorderMesh::OrderCells(DM dm, const std::vector<PetscInt>& cells, const std::vector<std::vector<PetscInt>>& neighbors) const {
+    switch (ordering) {
+        case Ordering::RCM:
+            return ReverseCuthillMcKee(neighbors);
+        case Ordering::MORTON:
+            return Morton(dm, cells);
+        default:
+            throw std::invalid_argument("Unknown ReorderMesh ordering");
+    }
+}
+
+std::vector<PetscInt> ablate::domain::modifiers::ReorderMesh::ReverseCuthillMcKee(const std::vector<std::vector<PetscInt>>& neighbors) {
+    const auto size = (PetscInt)neighbors.size();
+    auto degree = [&neighbors](PetscInt i) { return neighbors[i].size(); };
+
+    // breadth first search from the root returning the number of levels and the cells in the last level
+    std::vector<PetscInt> level(size, -1);
+    auto levelStructure = [&neighbors, &level](PetscInt root) {
+        std::vector<PetscInt> visited = {root};
+        level[root] = 0;
+        for (std::size_t v = 0; v < visited.size(); ++v) {
+            for (const auto& n : neighbors[visited[v]]) {
+                if (level[n] < 0) {
+                    level[n] = level[visited[v]] + 1;
+                    visited.push_back(n);
+                }
+            }
+        }
+        const PetscInt depth = level[visited.back()];
+        std::vector<PetscInt> lastLevel;
+        for (const auto& v : visited) {
+            if (level[v] == depth) {
+                lastLevel.push_back(v);
+            }
+            level[v] = -1;
+        }
+        return std::make_pair(depth, lastLevel);
+    };
+
+    std::vector<PetscInt> order;
+    order.reserve(size);
+    std::vector<bool> ordered(size, false);
+    for (PetscInt seed = 0; seed < size; ++seed) {
+        if (ordered[seed]) {
+            continue;
+        }
+
+        // find a pseudo-peripheral root for this connected component (George-Liu)
+        PetscInt root = seed;
+        auto [depth, lastLevel] = levelStructure(root);
+        while (true) {
+            const auto candidate = *std::min_element(lastLevel.begin(), lastLevel.end(), [&degree](PetscInt a, PetscInt b) { return degree(a) < degree(b); });
+            auto [candidateDepth, candidateLastLevel] = levelStructure(candidate);
+            if (candidateDepth <= depth) {
+                break;
+            }
+            root = candidate;
+            depth = candidateDepth;
+            lastLevel = std::move(candidateLastLevel);
+        }
+
+        // Cuthill-McKee, visit the neighbors in order of increasing degree
+        std::queue<PetscInt> queue;
+        queue.push(root);
+        ordered[root] = true;
+        std::vector<PetscInt> next;
+        while (!queue.empty()) {
+            const auto current = queue.front();
+            queue.pop();
+            order.push_back(current);
+
+            next.clear();
+            for (const auto& n : neighbors[current]) {
+                if (!ordered[n]) {
+                    ordered[n] = true;
+                    next.push_back(n);
+                }
+            }
+            std::stable_sort(next.begin(), next.end(), [&degree](PetscInt a, PetscInt b) { return degree(a) < degree(b); });
+            for (const auto& n : next) {
+                queue.push(n);
+            }
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+std::vector<PetscInt> ablate::domain::modifiers::ReorderMesh::Morton(DM dm, const std::vector<PetscInt>& cells) {
+    PetscInt dim;
+    DMGetCoordinateDim(dm, &dim) >> utilities::PetscUtilities::checkError;
+
+    // compute the centroid of each cell and the bounding box
+    std::vector<std::array<PetscReal, 3>> centroids(cells.size(), {0.0, 0.0, 0.0});
+    std::array<PetscReal, 3> lower = {PETSC_MAX_REAL, PETSC_MAX_REAL, PETSC_MAX_REAL};
+    std::array<PetscReal, 3> upper = {PETSC_MIN_REAL, PETSC_MIN_REAL, PETSC_MIN_REAL};
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        DMPlexComputeCellGeometryFVM(dm, cells[i], nullptr, centroids[i].data(), nullptr) >> utilities::PetscUtilities::checkError;
+        for (PetscInt d = 0; d < dim; ++d) {
+            lower[d] = PetscMin(lower[d], centroids[i][d]);
+            upper[d] = PetscMax(upper[d], centroids[i][d]);
+        }
+    }
+
+    // quantize each centroid to 21 bits per direction and interleave the bits
+    const PetscReal maxQuantized = (PetscReal)((1 << 21) - 1);
+    std::vector<uint64_t> keys(cells.size(), 0);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            const PetscReal extent = upper[d] - lower[d];
+            const auto quantized = extent > 0.0 ? (uint64_t)((centroids[i][d] - lower[d]) / extent * maxQuantized) : 0;
+            keys[i] |= SpreadBits(quantized) << d;
+        }
+    }
+
+    std::vector<PetscInt> order(cells.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&keys](PetscInt a, PetscInt b) { return keys[a] < keys[b]; });
+    return order;
+}
+
+PetscErrorCode ablate::domain::modifiers::ReorderMesh::CreatePointPermutation(DM dm, const std::vector<PetscInt>& cellOrder, IS* permutation) {
+    PetscFunctionBeginUser;
+    PetscInt pStart, pEnd, depth;
+    PetscCall(DMPlexGetChart(dm, &pStart, &pEnd));
+    PetscCall(DMPlexGetDepth(dm, &depth));
+
+    // each depth stratum is kept contiguous, so track the range and next number in each
+    std::vector<PetscInt> stratumStart(depth + 1), stratumEnd(depth + 1);
+    for (PetscInt d = 0; d <= depth; ++d) {
+        PetscCall(DMPlexGetDepthStratum(dm, d, &stratumStart[d], &stratumEnd[d]));
+    }
+    std::vector<PetscInt> nextPoint = stratumStart;
+    std::vector<PetscInt> perm(pEnd - pStart, -1);
+    auto numberPoint = [&](PetscInt p) {
+        if (perm[p - pStart] >= 0) {
+            return;
+        }
+        for (PetscInt d = 0; d <= depth; ++d) {
+            if (p >= stratumStart[d] && p < stratumEnd[d]) {
+                perm[p - pStart] = nextPoint[d]++;
+                return;
+            }
+        }
+    };
+
+    // number each cell and then the points in its closure the first time they are reached
+    for (const auto& cell : cellOrder) {
+        PetscInt closureSize;
+        PetscInt* closure = nullptr;
+        PetscCall(DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure));
+        for (PetscInt cl = 0; cl < closureSize * 2; cl += 2) {
+            numberPoint(closure[cl]);
+        }
+        PetscCall(DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure));
+    }
+
+    // any point not in a cell closure keeps its relative order
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        numberPoint(p);
+    }
+
+    PetscCall(ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, perm.data(), PETSC_COPY_VALUES, permutation));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::domain::modifiers::ReorderMesh::PermutePointSF(DM dm, IS permutation, DM permutedDm) {
+    PetscFunctionBeginUser;
+    PetscSF pointSF;
+    PetscCall(DMGetPointSF(dm, &pointSF));
+    PetscInt numberRoots, numberLeaves;
+    const PetscInt* leaves;
+    const PetscSFNode* remotes;
+    PetscCall(PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, &leaves, &remotes));
+    if (numberRoots < 0) {
+        // the dm is not distributed
+        PetscFunctionReturn(0);
+    }
+
+    PetscInt pStart, pEnd;
+    PetscCall(DMPlexGetChart(dm, &pStart, &pEnd));
+    PetscCheck(pStart == 0, PetscObjectComm((PetscObject)dm), PETSC_ERR_SUP, "ReorderMesh requires the chart to start at zero");
+
+    // send the new number of each root point to the leaves
+    const PetscInt* perm;
+    PetscCall(ISGetIndices(permutation, &perm));
+    std::vector<PetscInt> remotePerm(pEnd, -1);
+    PetscCall(PetscSFBcastBegin(pointSF, MPIU_INT, perm, remotePerm.data(), MPI_REPLACE));
+    PetscCall(PetscSFBcastEnd(pointSF, MPIU_INT, perm, remotePerm.data(), MPI_REPLACE));
+
+    // the leaves are stored in order of the new local point
+    std::vector<std::pair<PetscInt, PetscSFNode>> newLeaves(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        const PetscInt leaf = leaves ? leaves[l] : l;
+        newLeaves[l] = {perm[leaf], PetscSFNode{.rank = remotes[l].rank, .index = remotePerm[leaf]}};
+    }
+    PetscCall(ISRestoreIndices(permutation, &perm));
+    std::sort(newLeaves.begin(), newLeaves.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    PetscInt* newLocal;
+    PetscSFNode* newRemote;
+    PetscCall(PetscMalloc1(numberLeaves, &newLocal));
+    PetscCall(PetscMalloc1(numberLeaves, &newRemote));
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        newLocal[l] = newLeaves[l].first;
+        newRemote[l] = newLeaves[l].second;
+    }
+
+    PetscSF newPointSF;
+    PetscCall(PetscSFCreate(PetscObjectComm((PetscObject)dm), &newPointSF));
+    PetscCall(PetscSFSetGraph(newPointSF, numberRoots, numberLeaves, newLocal, PETSC_OWN_POINTER, newRemote, PETSC_OWN_POINTER));
+    PetscCall(DMSetPointSF(permutedDm, newPointSF));
+    PetscCall(PetscSFDestroy(&newPointSF));
+    PetscFunctionReturn(0);
+}
+
+PetscInt ablate::domain::modifiers::ReorderMesh::ComputeCellBandwidth(DM dm) {
+    std::vector<PetscInt> cells;
+    std::vector<std::vector<PetscInt>> neighbors;
+    GetCellGraph(dm, cells, neighbors);
+
+    PetscInt localBandwidth = 0;
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        for (const auto& n : neighbors[i]) {
+            localBandwidth = PetscMax(localBandwidth, PetscAbsInt(cells[i] - cells[n]));
+        }
+    }
+
+    PetscInt bandwidth;
+    MPI_Allreduce(&localBandwidth, &bandwidth, 1, MPIU_INT, MPI_MAX, PetscObjectComm((PetscObject)dm)) >> utilities::MpiUtilities::checkError;
+    return bandwidth;
+}
+
+std::string ablate::domain::modifiers::ReorderMesh::ToString() const {
+    std::stringstream stream;
+    stream << "ablate::domain::modifiers::ReorderMesh: " << ordering;
+    return stream.str();
+}
+
+std::ostream& ablate::domain::modifiers::operator<<(std::ostream& os, const ablate::domain::modifiers::ReorderMesh::Ordering& v) {
+    switch (v) {
+        case ReorderMesh::Ordering::RCM:
+            return os << "rcm";
+        case ReorderMesh::Ordering::MORTON:
+            return os << "morton";
+        default:
+            return os;
+    }
+}
+
+std::istream& ablate::domain::modifiers::operator>>(std::istream& is, ablate::domain::modifiers::ReorderMesh::Ordering& v) {
+    std::string enumString;
+    is >> enumString;
+
+    if (enumString == "rcm") {
+        v = ReorderMesh::Ordering::RCM;
+    } else if (enumString == "morton") {
+        v = ReorderMesh::Ordering::MORTON;
+    } else {
+        throw std::invalid_argument("Unknown ReorderMesh ordering " + enumString);
+    }
+    return is;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::ReorderMesh,
+         "Renumbers the local cells using reverse Cuthill-McKee or a Morton space-filling curve, with the faces, edges, and vertices following their cells, to improve memory locality. "
+         "This should be applied after the mesh is distributed.",
+         ENUM(ablate::domain::modifiers::ReorderMesh::Ordering, "ordering", "the cell ordering ('rcm', 'morton')"),
+         OPT(bool, "reportBandwidth", "report the cell bandwidth before and after reordering (default is false)"));
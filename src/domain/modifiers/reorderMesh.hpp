@@ -0,0 +1,96 @@
+#ifndef ABLATELIBRARY_REORDERMESH_HPP
+#define ABLATELIBRARY_REORDERMESH_HPP
+
+#include <petsc.h>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "modifier.hpp"
+
+namespace ablate::domain::modifiers {
+
+/**
+ * Renumbers the local mesh points to improve the memory locality of the cell and face loops.  The cells are ordered using reverse Cuthill-McKee (rcm) on the
+ * cell adjacency graph or along a Morton (z-order) space-filling curve through the cell centroids.  Faces, edges, and vertices are then numbered in the order
+ * they are first reached by the renumbered cells so that they follow their cells.  FVM ghost cells are kept at the end of the cell stratum.  This modifier
+ * should be applied after the mesh is distributed but before any fields/sections are created.
+ */
+class ReorderMesh : public Modifier {
+   public:
+    //! the method used to order the cells
+    enum class Ordering { RCM, MORTON };
+
+   private:
+    //! the method used to order the cells
+    const Ordering ordering;
+
+    //! report the cell bandwidth before and after reordering
+    const bool reportBandwidth;
+
+    /**
+     * Compute the new order of the movable cells
+     * @param dm
+     * @param cells the movable cells in the current order
+     * @param neighbors the neighbors (index into cells) of each movable cell
+     * @return the new cell order as indices into cells
+     */
+    std::vector<PetscInt> OrderCells(DM dm, const std::vector<PetscInt>& cells, const std::vector<std::vector<PetscInt>>& neighbors) const;
+
+    /**
+     * Order the cells with reverse Cuthill-McKee starting each connected component from a pseudo-peripheral cell
+     */
+    static std::vector<PetscInt> ReverseCuthillMcKee(const std::vector<std::vector<PetscInt>>& neighbors);
+
+    /**
+     * Order the cells along a Morton curve through the cell centroids
+     */
+    static std::vector<PetscInt> Morton(DM dm, const std::vector<PetscInt>& cells);
+
+    /**
+     * Create the point permutation (perm[old point] = new point) that keeps each depth stratum contiguous
+     */
+    static PetscErrorCode CreatePointPermutation(DM dm, const std::vector<PetscInt>& cellOrder, IS* permutation);
+
+    /**
+     * Remap the point sf of the distributed dm into the permuted numbering
+     */
+    static PetscErrorCode PermutePointSF(DM dm, IS permutation, DM permutedDm);
+
+   public:
+    /**
+     * @param ordering the method used to order the cells
+     * @param reportBandwidth optionally report the cell bandwidth before and after reordering
+     */
+    explicit ReorderMesh(Ordering ordering, bool reportBandwidth = false);
+
+    void Modify(DM&) override;
+
+    std::string ToString() const override;
+
+    /**
+     * Compute the maximum difference in cell number between any two neighboring cells over all ranks
+     * @param dm
+     * @return
+     */
+    static PetscInt ComputeCellBandwidth(DM dm);
+};
+
+/**
+ * Support function for the Ordering Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::ostream& operator<<(std::ostream& os, const ReorderMesh::Ordering& v);
+
+/**
+ * Support function for the Ordering Enum
+ * @param is
+ * @param v
+ * @return
+ */
+std::istream& operator>>(std::istream& is, ReorderMesh::Ordering& v);
+
+}  // namespace ablate::domain::modifiers
+#endif  // ABLATELIBRARY_REORDERMESH_HPP
@@ -13,7 +13,8 @@
 
 static void NoOpDeallocator(void *, size_t, void *) {}
 
-ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path) : ChemistryModel("ablate::chemistry::ChemTab") {
+ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path, int batchSize)
+    : ChemistryModel("ablate::chemistry::ChemTab"), batchSize(batchSize > 0 ? (std::size_t)batchSize : defaultBatchSize) {
     const char *tags = "serve";  // default model serving tag; can change in future
     int ntags = 1;
 
@@ -53,6 +54,13 @@ ablate::eos::ChemTab::ChemTab(const std::filesystem::path &path) : ChemistryMode
     runOpts = nullptr;
     session = TF_LoadSessionFromSavedModel(sessionOpts, runOpts, rpath.c_str(), &tags, ntags, graph, nullptr, status);
 
+    // look up the model input and outputs once
+    inputOperation = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
+    if (inputOperation.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
+    outputOperations = {TF_Output{TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0}, TF_Output{TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1}};
+    if (outputOperations[0].oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
+    if (outputOperations[1].oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
+
     std::fstream inputFileStream;
     // load the meta data from the weights.csv file
     inputFileStream.open(wpath.c_str(), std::ios::in);
@@ -153,54 +161,17 @@ void ablate::eos::ChemTab::LoadBasisVectors(std::istream &inputStream, std::size
 #define safe_free(ptr) \
     if (ptr != NULL) free(ptr)
 
-void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscReal density, const PetscReal densityProgressVariable[], PetscReal *predictedSourceEnergy, PetscReal *progressVariableSource,
-                                                       PetscReal *densityMassFractions) const {
-    //********* Get Input tensor
-    const std::size_t numInputs = 1;
-
-    TF_Output t0 = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
-
-    if (t0.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
-    std::array<TF_Output, numInputs> input = {t0};
-
-    //********* Get Output tensor
-    const std::size_t numOutputs = 2;
-
-    TF_Output t_sourceenergy = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0};
-    TF_Output t_sourceterms = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1};
-
-    if (t_sourceenergy.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
-    if (t_sourceterms.oper == nullptr) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
-    std::array<TF_Output, numOutputs> output = {t_sourceenergy, t_sourceterms};
-
-    //********* Allocate data for inputs & outputs
-    std::array<TF_Tensor *, numInputs> inputValues = {nullptr};
-    std::array<TF_Tensor *, numOutputs> outputValues = {nullptr, nullptr};
-
-    std::size_t ndims = 2;
-
-    // according to Varun this should work for including Zmix
-    auto ninputs = progressVariablesNames.size();
-    int64_t dims[] = {1, (int)ninputs};
-    float data[ninputs];
-
-    for (std::size_t i = 0; i < ninputs; i++) {
-        data[i] = (float)(densityProgressVariable[i] / density);
-    }
-
-    std::size_t ndata = ninputs * sizeof(float);
-    TF_Tensor *input_tensor = TF_NewTensor(TF_FLOAT, dims, (int)ndims, data, ndata, &NoOpDeallocator, nullptr);
-    if (input_tensor == nullptr) throw std::runtime_error("ERROR: Failed TF_NewTensor");
-
-    inputValues[0] = input_tensor;
-
-    TF_SessionRun(session, nullptr, input.data(), inputValues.data(), (int)numInputs, output.data(), outputValues.data(), (int)numOutputs, nullptr, 0, nullptr, status);
+void ablate::eos::ChemTab::RunModel(TF_Tensor *inputTensor, std::array<TF_Tensor *, 2> &outputValues) const {
+    outputValues = {nullptr, nullptr};
+    TF_SessionRun(session, nullptr, &inputOperation, &inputTensor, 1, outputOperations.data(), outputValues.data(), (int)outputValues.size(), nullptr, 0, nullptr, status);
     if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
-    //********** Extract source predictions
+}
 
+void ablate::eos::ChemTab::ExtractModelOutput(const std::array<TF_Tensor *, 2> &outputValues, std::size_t row, PetscReal density, PetscReal *predictedSourceEnergy,
+                                              PetscReal *progressVariableSource, PetscReal *densityMassFractions) const {
     // store physical variables (e.g. souener & mass fractions)
-    float *outputArray;  // Dwyer: as counter intuitive as it may be static dependents come second, it did pass its tests!
-    outputArray = (float *)TF_TensorData(outputValues[1]);
+    // Dwyer: as counter intuitive as it may be static dependents come second, it did pass its tests!
+    const float *outputArray = (float *)TF_TensorData(outputValues[1]) + row * (speciesNames.size() + 1);
     auto p = (PetscReal)outputArray[0];
     if (predictedSourceEnergy != nullptr) *predictedSourceEnergy = p * density;
 
@@ -212,7 +183,7 @@ void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscReal density, const
     }
 
     // store CPV sources
-    outputArray = (float *)TF_TensorData(outputValues[0]);
+    outputArray = (float *)TF_TensorData(outputValues[0]) + row * (progressVariablesNames.size() - 1);
     if (progressVariableSource != nullptr) {
         progressVariableSource[0] = 0;  // Zmix source is always 0!
 
@@ -221,14 +192,34 @@ void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscReal density, const
             progressVariableSource[i + 1] = (PetscReal)outputArray[i] * density;  // +1 b/c we are manually filling in Zmix source value (to 0)
         }
     }
+}
+
+void ablate::eos::ChemTab::ChemTabModelComputeFunction(PetscReal density, const PetscReal densityProgressVariable[], PetscReal *predictedSourceEnergy, PetscReal *progressVariableSource,
+                                                       PetscReal *densityMassFractions) const {
+    std::size_t ndims = 2;
+
+    // according to Varun this should work for including Zmix
+    auto ninputs = progressVariablesNames.size();
+    int64_t dims[] = {1, (int)ninputs};
+    float data[ninputs];
+
+    for (std::size_t i = 0; i < ninputs; i++) {
+        data[i] = (float)(densityProgressVariable[i] / density);
+    }
+
+    std::size_t ndata = ninputs * sizeof(float);
+    TF_Tensor *inputTensor = TF_NewTensor(TF_FLOAT, dims, (int)ndims, data, ndata, &NoOpDeallocator, nullptr);
+    if (inputTensor == nullptr) throw std::runtime_error("ERROR: Failed TF_NewTensor");
+
+    std::array<TF_Tensor *, 2> outputValues = {nullptr, nullptr};
+    RunModel(inputTensor, outputValues);
+    ExtractModelOutput(outputValues, 0, density, predictedSourceEnergy, progressVariableSource, densityMassFractions);
 
     // free allocated vectors
     for (auto &t : outputValues) {
         TF_DeleteTensor(t);
     }
-    for (auto &t : inputValues) {
-        TF_DeleteTensor(t);
-    }
+    TF_DeleteTensor(inputTensor);
 }
 
 void ablate::eos::ChemTab::ComputeMassFractions(const PetscReal *progressVariables, PetscReal *densityMassFractions, PetscReal density) const {
@@ -289,7 +280,8 @@ std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> ablate::eos::Chem
     return std::make_shared<ChemTabSourceCalculator>(eulerField->offset + ablate::finiteVolume::CompressibleFlowFields::RHO,
                                                      eulerField->offset + ablate::finiteVolume::CompressibleFlowFields::RHOE,
                                                      densityProgressField->offset,
-                                                     shared_from_this());
+                                                     shared_from_this(),
+                                                     cellRange.end - cellRange.start);
 }
 
 ablate::eos::ThermodynamicFunction ablate::eos::ChemTab::GetThermodynamicFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
@@ -441,8 +433,44 @@ std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> ablate::eos::ChemT
 }
 
 ablate::eos::ChemTab::ChemTabSourceCalculator::ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset,
-                                                                       std::shared_ptr<ChemTab> chemTabModel)
-    : densityOffset(densityOffset), densityEnergyOffset(densityEnergyOffset), densityProgressVariableOffset(densityProgressVariableOffset), chemTabModel(std::move(chemTabModel)) {}
+                                                                       std::shared_ptr<ChemTab> chemTabModelIn, std::size_t numberCells)
+    : densityOffset(densityOffset), densityEnergyOffset(densityEnergyOffset), densityProgressVariableOffset(densityProgressVariableOffset), chemTabModel(std::move(chemTabModelIn)) {
+    // size the input tensor for the largest batch so that it can be reused each step
+    batchRows = std::max((std::size_t)1, std::min(chemTabModel->batchSize, numberCells));
+    batchTensor = GetInputTensor(batchRows);
+}
+
+ablate::eos::ChemTab::ChemTabSourceCalculator::~ChemTabSourceCalculator() {
+    if (batchTensor) {
+        TF_DeleteTensor(batchTensor);
+    }
+    if (remainderTensor) {
+        TF_DeleteTensor(remainderTensor);
+    }
+}
+
+TF_Tensor *ablate::eos::ChemTab::ChemTabSourceCalculator::GetInputTensor(std::size_t rows) {
+    if (batchTensor && (std::size_t)TF_Dim(batchTensor, 0) == rows) {
+        return batchTensor;
+    }
+    if (remainderTensor && (std::size_t)TF_Dim(remainderTensor, 0) == rows) {
+        return remainderTensor;
+    }
+
+    // let tensorflow allocate (and align) the buffer so that it is used in place instead of copied when the model is run
+    auto ninputs = chemTabModel->progressVariablesNames.size();
+    int64_t dims[] = {(int64_t)rows, (int64_t)ninputs};
+    auto tensor = TF_AllocateTensor(TF_FLOAT, dims, 2, rows * ninputs * sizeof(float));
+    if (tensor == nullptr) throw std::runtime_error("ERROR: Failed TF_AllocateTensor");
+
+    if (batchTensor) {
+        if (remainderTensor) {
+            TF_DeleteTensor(remainderTensor);
+        }
+        remainderTensor = tensor;
+    }
+    return tensor;
+}
 
 void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::domain::Range &cellRange, Vec locX, Vec locFVec) {
     // get access to the xArray, fArray
@@ -455,20 +483,48 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::doma
     DM dm;
     VecGetDM(locFVec, &dm) >> utilities::PetscUtilities::checkError;
 
-    // March over each cell in the range
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
+    const auto ninputs = chemTabModel->progressVariablesNames.size();
+
+    // March over the cells in batches
+    for (PetscInt batchStart = cellRange.start; batchStart < cellRange.end; batchStart += (PetscInt)batchRows) {
+        const auto rows = std::min(batchRows, (std::size_t)(cellRange.end - batchStart));
+
+        // gather the progress variables for each cell in the batch directly into the tensor
+        auto inputTensor = GetInputTensor(rows);
+        auto inputData = (float *)TF_TensorData(inputTensor);
+        for (std::size_t r = 0; r < rows; ++r) {
+            const PetscInt c = batchStart + (PetscInt)r;
+            const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
 
-        // Get the current state variables for this cell
-        PetscScalar *sourceAtCell = nullptr;
-        DMPlexPointLocalRef(dm, iCell, fArray, &sourceAtCell) >> utilities::PetscUtilities::checkError;
+            const PetscScalar *solutionAtCell = nullptr;
+            DMPlexPointLocalRead(dm, iCell, xArray, &solutionAtCell) >> utilities::PetscUtilities::checkError;
+            for (std::size_t i = 0; i < ninputs; i++) {
+                inputData[r * ninputs + i] = (float)(solutionAtCell[densityProgressVariableOffset + i] / solutionAtCell[densityOffset]);
+            }
+        }
+
+        std::array<TF_Tensor *, 2> outputValues = {nullptr, nullptr};
+        chemTabModel->RunModel(inputTensor, outputValues);
+
+        // scatter the results back to each cell
+        for (std::size_t r = 0; r < rows; ++r) {
+            const PetscInt c = batchStart + (PetscInt)r;
+            const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
 
-        // Get the current state variables for this cell
-        const PetscScalar *solutionAtCell = nullptr;
-        DMPlexPointLocalRead(dm, iCell, xArray, &solutionAtCell) >> utilities::PetscUtilities::checkError;
+            // Get the current state variables for this cell
+            PetscScalar *sourceAtCell = nullptr;
+            DMPlexPointLocalRef(dm, iCell, fArray, &sourceAtCell) >> utilities::PetscUtilities::checkError;
+            const PetscScalar *solutionAtCell = nullptr;
+            DMPlexPointLocalRead(dm, iCell, xArray, &solutionAtCell) >> utilities::PetscUtilities::checkError;
 
-        chemTabModel->ChemistrySource(solutionAtCell[densityOffset], solutionAtCell + densityProgressVariableOffset, sourceAtCell + densityEnergyOffset, sourceAtCell + densityProgressVariableOffset);
+            chemTabModel->ExtractModelOutput(outputValues, r, solutionAtCell[densityOffset], sourceAtCell + densityEnergyOffset, sourceAtCell + densityProgressVariableOffset, nullptr);
+        }
+
+        for (auto &t : outputValues) {
+            TF_DeleteTensor(t);
+        }
     }
+
     // cleanup
     VecRestoreArray(locFVec, &fArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(locX, &xArray) >> utilities::PetscUtilities::checkError;
@@ -477,4 +533,5 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::doma
 #endif
 
 #include "registrar.hpp"
-REGISTER(ablate::eos::ChemistryModel, ablate::eos::ChemTab, "Uses a tensorflow model developed by ChemTab", ARG(std::filesystem::path, "path", "the path to the model"));
+REGISTER(ablate::eos::ChemistryModel, ablate::eos::ChemTab, "Uses a tensorflow model developed by ChemTab", ARG(std::filesystem::path, "path", "the path to the model"),
+         OPT(int, "batchSize", "the number of cells passed to the model in each call (default is 1024)"));
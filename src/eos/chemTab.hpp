@@ -8,6 +8,7 @@
 #include "eos/tChem.hpp"
 #ifdef WITH_TENSORFLOW
 #include <tensorflow/c/c_api.h>
+#include <array>
 #include "utilities/vectorUtilities.hpp"
 #endif
 
@@ -34,6 +35,13 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
     PetscReal** Wmat = nullptr;
     PetscReal* sourceEnergyScaler = nullptr;
 
+    //! the model input and outputs are looked up once from the graph
+    TF_Output inputOperation{};
+    std::array<TF_Output, 2> outputOperations{};
+
+    //! the maximum number of cells passed to the model in each call
+    const std::size_t batchSize;
+
     // Store any initializers specified by the metadata
     std::map<std::string, std::map<std::string, double>> initializers;
 
@@ -55,8 +63,27 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
                                      PetscReal* densityMassFractions) const;
 
     /**
-     * The source calculator is used to do batch processing for chemistry model.  This is a bad implementation
-     * that calls each node one at a time.
+     * Runs the model for each row in the input tensor.  The output tensors must be deleted by the caller.
+     * @param inputTensor sized [rows, progress variables]
+     * @param outputValues the progress variable sources followed by the source energy and mass fractions
+     */
+    void RunModel(TF_Tensor* inputTensor, std::array<TF_Tensor*, 2>& outputValues) const;
+
+    /**
+     * Copies the model output for a single row, scaled by density
+     * @param outputValues
+     * @param row
+     * @param density
+     * @param predictedSourceEnergy , if null, wont' be set
+     * @param progressVariableSource , if null, won't be set
+     * @param densityMassFractions , if null, won't be set
+     */
+    void ExtractModelOutput(const std::array<TF_Tensor*, 2>& outputValues, std::size_t row, PetscReal density, PetscReal* predictedSourceEnergy, PetscReal* progressVariableSource,
+                            PetscReal* densityMassFractions) const;
+
+    /**
+     * The source calculator is used to do batch processing for chemistry model.  The cells are gathered into
+     * preallocated input tensors and passed to the model up to batchSize cells at a time.
      */
     class ChemTabSourceCalculator : public ChemistryModel::SourceCalculator {
        private:
@@ -67,8 +94,21 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
         //! hold a pointer to the chemTabModel to compute the source terms
         const std::shared_ptr<ChemTab> chemTabModel;
 
+        //! the number of rows (cells) in a full batch
+        std::size_t batchRows = 1;
+
+        //! the reused input tensors for full batches and the smaller final batch.  The inputs are written directly into the tensor data each step
+        TF_Tensor* batchTensor = nullptr;
+        TF_Tensor* remainderTensor = nullptr;
+
+        /**
+         * Get an input tensor sized for the number of rows, reusing the preallocated tensors.  The tensors are allocated by tensorflow so the buffer is aligned.
+         */
+        TF_Tensor* GetInputTensor(std::size_t rows);
+
        public:
-        ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset, std::shared_ptr<ChemTab> chemTabModel);
+        ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset, std::shared_ptr<ChemTab> chemTabModel, std::size_t numberCells);
+        ~ChemTabSourceCalculator() override;
 
         /**
          * There is no need to precompute source for the chemtab model
@@ -103,7 +143,14 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
     static PetscErrorCode ComputeMassFractions(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], PetscScalar* u, void* ctx);
 
    public:
-    explicit ChemTab(const std::filesystem::path& path);
+    //! the default number of cells passed to the model in each call
+    static inline constexpr std::size_t defaultBatchSize = 1024;
+
+    /**
+     * @param path the path to the model
+     * @param batchSize the number of cells passed to the model in each call, values less than one use the default
+     */
+    explicit ChemTab(const std::filesystem::path& path, int batchSize = 0);
     ~ChemTab() override;
 
     /**
@@ -231,7 +278,7 @@ class ChemTab : public ChemistryModel {
    public:
     inline const static std::string DENSITY_YI_DECODE_FIELD = "DENSITY_YI_DECODE";
     static inline const std::string errorMessage = "Using the ChemTab requires Tensorflow to be compile with ABLATE.";
-    ChemTab(std::filesystem::path path) : ChemistryModel("ablate::chemistry::ChemTabModel") { throw std::runtime_error(errorMessage); }
+    ChemTab(std::filesystem::path path, int batchSize = 0) : ChemistryModel("ablate::chemistry::ChemTabModel") { throw std::runtime_error(errorMessage); }
 
     [[nodiscard]] const std::vector<std::string>& GetSpeciesVariables() const override { throw std::runtime_error(errorMessage); }
 
@@ -0,0 +1,31 @@
+#include "eos.hpp"
+
+ablate::eos::ThermodynamicBatchFunction ablate::eos::EOS::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field>& fields) const {
+    auto singleFunction = std::make_shared<ThermodynamicFunction>(GetThermodynamicFunction(property, fields));
+    return ThermodynamicBatchFunction{.function = ThermodynamicBatchFromSingleFunction, .context = singleFunction, .propertySize = singleFunction->propertySize};
+}
+
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::EOS::GetThermodynamicTemperatureBatchFunction(ablate::eos::ThermodynamicProperty property,
+                                                                                                             const std::vector<domain::Field>& fields) const {
+    auto singleFunction = std::make_shared<ThermodynamicTemperatureFunction>(GetThermodynamicTemperatureFunction(property, fields));
+    return ThermodynamicTemperatureBatchFunction{.function = ThermodynamicTemperatureBatchFromSingleFunction, .context = singleFunction, .propertySize = singleFunction->propertySize};
+}
+
+PetscErrorCode ablate::eos::EOS::ThermodynamicBatchFromSingleFunction(PetscInt numberStates, const PetscReal* conserved, PetscInt conservedStride, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto singleFunction = (ThermodynamicFunction*)ctx;
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        PetscCall(singleFunction->function(conserved + s * conservedStride, property + s * singleFunction->propertySize, singleFunction->context.get()));
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::EOS::ThermodynamicTemperatureBatchFromSingleFunction(PetscInt numberStates, const PetscReal* conserved, PetscInt conservedStride, const PetscReal* T, PetscReal* property,
+                                                                                 void* ctx) {
+    PetscFunctionBeginUser;
+    auto singleFunction = (ThermodynamicTemperatureFunction*)ctx;
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        PetscCall(singleFunction->function(conserved + s * conservedStride, T[s], property + s * singleFunction->propertySize, singleFunction->context.get()));
+    }
+    PetscFunctionReturn(0);
+}
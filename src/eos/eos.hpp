@@ -48,6 +48,31 @@ struct ThermodynamicTemperatureFunction {
     PetscInt propertySize = 1;
 };
 
+/**
+ * Simple struct representing the context and function for computing any thermodynamic value for a batch of states when temperature is not available.  The conserved values for state i start at
+ * conserved[i*conservedStride] and the property for state i is stored in property[i*propertySize]
+ */
+struct ThermodynamicBatchFunction {
+    //! function to be called
+    PetscErrorCode (*function)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx) = nullptr;
+    //! optional context to pass into the function
+    std::shared_ptr<void> context = nullptr;
+    //! the property size being set per state
+    PetscInt propertySize = 1;
+};
+
+/**
+ * Simple struct representing the context and function for computing any thermodynamic value for a batch of states when temperature is available.  The temperature for state i is T[i].
+ */
+struct ThermodynamicTemperatureBatchFunction {
+    //! function to be called
+    PetscErrorCode (*function)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx) = nullptr;
+    //! optional context to pass into the function
+    std::shared_ptr<void> context = nullptr;
+    //! the property size being set per state
+    PetscInt propertySize = 1;
+};
+
 /**
  * Simple function representing the context and function for computing a field from two specified properties, velocity, and other properties as specified
  */
@@ -93,6 +118,23 @@ class EOS {
      */
     [[nodiscard]] virtual ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const = 0;
 
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields.  The default implementation loops over the single state function.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const;
+
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields and temperature.  The default implementation loops over the single state
+     * function.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicTemperatureBatchFunction GetThermodynamicTemperatureBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const;
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
@@ -138,6 +180,16 @@ class EOS {
         eos.View(out);
         return out;
     }
+
+   private:
+    /** @name Default Batch Functions
+     * These functions call the single state function (stored in the ctx) for each state in the batch
+     * @{
+     */
+    static PetscErrorCode ThermodynamicBatchFromSingleFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode ThermodynamicTemperatureBatchFromSingleFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property,
+                                                                          void* ctx);
+    /** @} */
 };
 
 /**
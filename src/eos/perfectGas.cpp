@@ -46,6 +46,41 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::PerfectGas::GetThermo
         .propertySize = std::get<2>(thermodynamicFunctions.at(property)) == SPECIES_SIZE ? (PetscInt)species.size() : PetscInt(std::get<2>(thermodynamicFunctions.at(property)))};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::PerfectGas::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::PerfectGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicBatchFunction{
+        .function = std::get<0>(thermodynamicBatchFunctions.at(property)),
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
+
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::PerfectGas::GetThermodynamicTemperatureBatchFunction(ablate::eos::ThermodynamicProperty property,
+                                                                                                                    const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicTemperatureBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::PerfectGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicTemperatureBatchFunction{
+        .function = std::get<1>(thermodynamicBatchFunctions.at(property)),
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
+
 PetscErrorCode ablate::eos::PerfectGas::PressureFunction(const PetscReal *conserved, PetscReal *pressure, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
@@ -196,6 +231,110 @@ PetscErrorCode ablate::eos::PerfectGas::DensityTemperatureFunction(const PetscRe
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::eos::PerfectGas::PressureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *pressure, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscInt dim = functionContext->dim;
+    const PetscReal gamma = functionContext->parameters.gamma;
+    const PetscReal *euler = conserved + functionContext->eulerOffset;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        const PetscReal *eulerState = euler + s * conservedStride;
+        PetscReal density = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal ke = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            ke += PetscSqr(eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        pressure[s] = (gamma - 1.0) * (eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOE] - 0.5 * density * ke);
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::TemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *temperature, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    PetscCall(InternalSensibleEnergyBatchFunction(numberStates, conserved, conservedStride, temperature, ctx));
+
+    const PetscReal cv = functionContext->parameters.rGas / (functionContext->parameters.gamma - 1.0);
+    for (PetscInt s = 0; s < numberStates; s++) {
+        temperature[s] /= cv;
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::InternalSensibleEnergyBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *internalEnergy, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscInt dim = functionContext->dim;
+    const PetscReal *euler = conserved + functionContext->eulerOffset;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        const PetscReal *eulerState = euler + s * conservedStride;
+        PetscReal density = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal ke = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            ke += PetscSqr(eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        internalEnergy[s] = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * ke;
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::SpeedOfSoundBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *speedOfSound, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal gamma = functionContext->parameters.gamma;
+    PetscCall(InternalSensibleEnergyBatchFunction(numberStates, conserved, conservedStride, speedOfSound, ctx));
+
+    // a^2 = gamma*p/rho = gamma*(gamma-1)*e
+    for (PetscInt s = 0; s < numberStates; s++) {
+        speedOfSound[s] = PetscSqrtReal(gamma * (gamma - 1.0) * speedOfSound[s]);
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::PressureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *pressure,
+                                                                         void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal rGas = functionContext->parameters.rGas;
+    const PetscReal *density = conserved + functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        pressure[s] = rGas * density[s * conservedStride] * T[s];
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::TemperatureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *temperature,
+                                                                            void *ctx) {
+    return TemperatureBatchFunction(numberStates, conserved, conservedStride, temperature, ctx);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::InternalSensibleEnergyTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T,
+                                                                                       PetscReal *internalEnergy, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal cv = functionContext->parameters.rGas / (functionContext->parameters.gamma - 1.0);
+    for (PetscInt s = 0; s < numberStates; s++) {
+        internalEnergy[s] = T[s] * cv;
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::PerfectGas::SpeedOfSoundTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *speedOfSound,
+                                                                             void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal gammaRGas = functionContext->parameters.gamma * functionContext->parameters.rGas;
+
+    // a^2 = gamma*p/rho = gamma*R*T
+    for (PetscInt s = 0; s < numberStates; s++) {
+        speedOfSound[s] = PetscSqrtReal(gammaRGas * T[s]);
+    }
+    PetscFunctionReturn(0);
+}
+
 ablate::eos::EOSFunction ablate::eos::PerfectGas::GetFieldFunctionFunction(const std::string &field, ablate::eos::ThermodynamicProperty property1, ablate::eos::ThermodynamicProperty property2,
                                                                            std::vector<std::string> otherProperties) const {
     if (finiteVolume::CompressibleFlowFields::EULER_FIELD == field) {
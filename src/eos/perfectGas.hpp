@@ -67,6 +67,27 @@ class PerfectGas : public EOS {
     static PetscErrorCode SpeciesSensibleEnthalpyTemperatureFunction(const PetscReal conserved[], PetscReal T, PetscReal* property, void* ctx);
     /** @} */
 
+    /** @name Batched Thermodynamic Properties Functions
+     * These functions compute the thermodynamic properties for a batch of states in a single call.  The loops are kept free of function calls so the compiler can vectorize them.
+     * @param numberStates
+     * @param conserved
+     * @param conservedStride
+     * @param property
+     * @param ctx
+     * @return
+     * @{
+     */
+    static PetscErrorCode PressureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode TemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode InternalSensibleEnergyBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode SpeedOfSoundBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode PressureTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    static PetscErrorCode TemperatureTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    static PetscErrorCode InternalSensibleEnergyTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property,
+                                                                         void* ctx);
+    static PetscErrorCode SpeedOfSoundTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    /** @} */
+
     /**
      * Store a map of functions functions for quick lookup
      */
@@ -83,6 +104,18 @@ class PerfectGas : public EOS {
         {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundFunction, SpeedOfSoundTemperatureFunction, 1}},
         {ThermodynamicProperty::SpeciesSensibleEnthalpy, {SpeciesSensibleEnthalpyFunction, SpeciesSensibleEnthalpyTemperatureFunction, SPECIES_SIZE}}};
 
+    /**
+     * Store a map of the batched functions.  Any property not listed here falls back to the default EOS batch implementation
+     */
+    using ThermodynamicBatchStaticFunction = PetscErrorCode (*)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    using ThermodynamicTemperatureBatchStaticFunction = PetscErrorCode (*)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property,
+                                                                           void* ctx);
+    std::map<ThermodynamicProperty, std::tuple<ThermodynamicBatchStaticFunction, ThermodynamicTemperatureBatchStaticFunction>> thermodynamicBatchFunctions = {
+        {ThermodynamicProperty::Pressure, {PressureBatchFunction, PressureTemperatureBatchFunction}},
+        {ThermodynamicProperty::Temperature, {TemperatureBatchFunction, TemperatureTemperatureBatchFunction}},
+        {ThermodynamicProperty::InternalSensibleEnergy, {InternalSensibleEnergyBatchFunction, InternalSensibleEnergyTemperatureBatchFunction}},
+        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundBatchFunction, SpeedOfSoundTemperatureBatchFunction}}};
+
    public:
     explicit PerfectGas(const std::shared_ptr<ablate::parameters::Parameters>&, std::vector<std::string> species = {});
     void View(std::ostream& stream) const override;
@@ -114,6 +147,22 @@ class PerfectGas : public EOS {
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Single function to produce a batched thermodynamic function for any property based upon the available fields and temperature
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetThermodynamicTemperatureBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
@@ -14,12 +14,31 @@ ablate::eos::radiationProperties::SootSpectrumProperties::SootSpectrumProperties
     //! If a range is given, initialize a linear variation in wavelength over the desired range.
     if (std::empty(wavelengthsIn)) {
         wavelengthsIn.resize(num);
+        bandwidthsIn.resize(num);
         double widths = (max - min) / num;
         for (int i = 0; i < num; i++) {
             wavelengthsIn[i] = min + ((double)i / (double)num) * max;
             bandwidthsIn[i] = widths;  //! Default the bandwidths to cover the whole range.
         }
     }
+
+    //! Precompute the optical constants and black body coefficients for every band
+    absorptionFactorsIn.resize(wavelengthsIn.size());
+    emissionFactorsIn.resize(wavelengthsIn.size());
+    emissionExponentsIn.resize(wavelengthsIn.size());
+    for (std::size_t i = 0; i < wavelengthsIn.size(); i++) {
+        const PetscReal lambda = wavelengthsIn[i];
+        const PetscReal n = GetRefractiveIndex(lambda);  //! Fit of model to data.
+        const PetscReal k = GetAbsorptiveIndex(lambda);  //! Fit of model to data.
+        absorptionFactorsIn[i] = (36 * ablate::utilities::Constants::pi * n * k) / (((((n * n) - (k * k) + 2) * ((n * n) - (k * k) + 2)) + (4 * n * n * k * k)) * (lambda));
+
+        //! The same black body intensity as Radiation::GetBlackBodyWavelengthIntensity multiplied by the bandwidth under the constant assumption
+        PetscReal factor = (2 * ablate::utilities::Constants::pi * ablate::utilities::Constants::h * ablate::utilities::Constants::c * ablate::utilities::Constants::c);
+        factor /= n * n * lambda * lambda * lambda * lambda * lambda;
+        factor /= ablate::utilities::Constants::pi;
+        emissionFactorsIn[i] = factor * bandwidthsIn[i];
+        emissionExponentsIn[i] = (ablate::utilities::Constants::h * ablate::utilities::Constants::c) / (n * lambda * ablate::utilities::Constants::k);
+    }
 }
 
 // Bandwidth of 10 nanometers is assumed for the filters. Constant emissivity over the bandwidth.
@@ -29,10 +48,12 @@ PetscErrorCode ablate::eos::radiationProperties::SootSpectrumProperties::SootEmi
 
     auto functionContext = (FunctionContext *)ctx;
 
-    for (size_t i = 0; i < functionContext->wavelengths.size(); i++) {
-        epsilon[i] = ablate::radiation::Radiation::GetBlackBodyWavelengthIntensity(
-            temperature, functionContext->wavelengths[i], GetRefractiveIndex(functionContext->wavelengths[i]));  //! Get the black body intensity at the temperature and wavelength specified.
-        epsilon[i] *= functionContext->bandwidths[i];  //! Multiply it by the bandwidth under constant assumption to get the power integration.
+    const std::size_t numberBands = functionContext->emissionFactors.size();
+    const PetscReal* emissionFactors = functionContext->emissionFactors.data();
+    const PetscReal* emissionExponents = functionContext->emissionExponents.data();
+    for (std::size_t i = 0; i < numberBands; i++) {
+        //! The band integrated black body intensity at the temperature specified.
+        epsilon[i] = emissionFactors[i] / (exp(emissionExponents[i] / temperature) - 1);
         /**
          * In other models we may want to implement a smarter integration.
          */
@@ -51,16 +72,11 @@ PetscErrorCode ablate::eos::radiationProperties::SootSpectrumProperties::SootAbs
     PetscCall(functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get()));  //!< Get the density value at this location
     PetscReal YinC = (functionContext->densityYiCSolidCOffset == -1) ? 0 : conserved[functionContext->densityYiCSolidCOffset] / density;     //!< Get the mass fraction of carbon here
 
-    PetscReal n;
-    PetscReal k;
     PetscReal fv = density * YinC / rhoC;
-    for (size_t i = 0; i < functionContext->wavelengths.size(); i++) {
-        PetscReal lambda = functionContext->wavelengths[i];  //! Must convert to micrometers because of the model fit
-        //! This is the wavelength. (We must integrate over the valid range of wavelengths.)
-        n = GetRefractiveIndex(lambda);  //! Fit of model to data.
-        k = GetAbsorptiveIndex(lambda);  //! Fit of model to data.
-
-        kappa[i] = (36 * ablate::utilities::Constants::pi * n * k * fv) / (((((n * n) - (k * k) + 2) * ((n * n) - (k * k) + 2)) + (4 * n * n * k * k)) * (lambda));
+    const std::size_t numberBands = functionContext->absorptionFactors.size();
+    const PetscReal* absorptionFactors = functionContext->absorptionFactors.data();
+    for (std::size_t i = 0; i < numberBands; i++) {
+        kappa[i] = absorptionFactors[i] * fv;
     }
 
     PetscFunctionReturn(0);
@@ -89,7 +105,10 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
                                                                              .temperatureFunction = eos->GetThermodynamicFunction(ThermodynamicProperty::Temperature, fields),
                                                                              .densityFunction = eos->GetThermodynamicTemperatureFunction(ThermodynamicProperty::Density, fields),
                                                                              .wavelengths = wavelengthsIn,
-                                                                             .bandwidths = bandwidthsIn}),
+                                                                             .bandwidths = bandwidthsIn,
+                                                                             .absorptionFactors = absorptionFactorsIn,
+                                                                             .emissionFactors = emissionFactorsIn,
+                                                                             .emissionExponents = emissionExponentsIn}),
                 .propertySize = (int)wavelengthsIn.size()};  //!< Create a struct to hold the offsets
         case RadiationProperty::Emissivity:
             return ThermodynamicTemperatureFunction{
@@ -98,7 +117,10 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
                                                                              .temperatureFunction = eos->GetThermodynamicFunction(ThermodynamicProperty::Temperature, fields),
                                                                              .densityFunction = eos->GetThermodynamicTemperatureFunction(ThermodynamicProperty::Density, fields),
                                                                              .wavelengths = wavelengthsIn,
-                                                                             .bandwidths = bandwidthsIn}),
+                                                                             .bandwidths = bandwidthsIn,
+                                                                             .absorptionFactors = absorptionFactorsIn,
+                                                                             .emissionFactors = emissionFactorsIn,
+                                                                             .emissionExponents = emissionExponentsIn}),
                 .propertySize = (int)wavelengthsIn.size()};  //!< Create a struct to hold the offsets
         default:
             throw std::invalid_argument("Unknown radiationProperties property in ablate::eos::radiationProperties::SootAbsorptionModel");
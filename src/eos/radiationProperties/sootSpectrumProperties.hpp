@@ -16,6 +16,11 @@ class SootSpectrumProperties : public RadiationModel {
         const ThermodynamicTemperatureFunction densityFunction;
         const std::vector<PetscReal> wavelengths;
         const std::vector<PetscReal> bandwidths;
+        //! the absorption per unit soot volume fraction for each band
+        const std::vector<PetscReal> absorptionFactors;
+        //! the band integrated black body intensity for each band is emissionFactors / (exp(emissionExponents / T) - 1)
+        const std::vector<PetscReal> emissionFactors;
+        const std::vector<PetscReal> emissionExponents;
     };
     const std::shared_ptr<eos::EOS> eos;     //! eos is needed to compute field values
     constexpr static PetscReal rhoC = 2000;  //! kg/m^3
@@ -23,6 +28,11 @@ class SootSpectrumProperties : public RadiationModel {
     std::vector<PetscReal> wavelengthsIn;
     std::vector<PetscReal> bandwidthsIn;
 
+    //! the temperature independent part of each band, computed once so that each cell only needs a single exponential per band
+    std::vector<PetscReal> absorptionFactorsIn;
+    std::vector<PetscReal> emissionFactorsIn;
+    std::vector<PetscReal> emissionExponentsIn;
+
    public:
     SootSpectrumProperties(std::shared_ptr<eos::EOS> eosIn, int num = 0, double min = 0.4E-6, double max = 30E-6, const std::vector<double>& wavelengths = {},
                            const std::vector<double>& bandwidths = {});
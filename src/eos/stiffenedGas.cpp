@@ -47,6 +47,39 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::StiffenedGas::GetTher
         .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
         .propertySize = std::get<2>(thermodynamicFunctions.at(property)) == SPECIES_SIZE ? (PetscInt)species.size() : PetscInt(std::get<2>(thermodynamicFunctions.at(property)))};
 }
+ablate::eos::ThermodynamicBatchFunction ablate::eos::StiffenedGas::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::StiffenedGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicBatchFunction{
+        .function = std::get<0>(thermodynamicBatchFunctions.at(property)),
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::StiffenedGas::GetThermodynamicTemperatureBatchFunction(ablate::eos::ThermodynamicProperty property,
+                                                                                                                      const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicTemperatureBatchFunction(property, fields);
+    }
+
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::StiffenedGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    return ThermodynamicTemperatureBatchFunction{
+        .function = std::get<1>(thermodynamicBatchFunctions.at(property)),
+        .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters}),
+        .propertySize = 1};
+}
 
 ablate::eos::EOSFunction ablate::eos::StiffenedGas::GetFieldFunctionFunction(const std::string &field, ablate::eos::ThermodynamicProperty property1, ablate::eos::ThermodynamicProperty property2,
                                                                              std::vector<std::string> otherProperties) const {
@@ -332,6 +365,94 @@ PetscErrorCode ablate::eos::StiffenedGas::SpeciesSensibleEnthalpyFunction(const
 PetscErrorCode ablate::eos::StiffenedGas::SpeciesSensibleEnthalpyTemperatureFunction(const PetscReal *conserved, PetscReal T, PetscReal *property, void *ctx) {
     return SpeciesSensibleEnthalpyFunction(conserved, property, ctx);
 }
+PetscErrorCode ablate::eos::StiffenedGas::PressureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *p, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscInt dim = functionContext->dim;
+    const PetscReal gam = functionContext->parameters.gamma;
+    const PetscReal pinf = functionContext->parameters.p0;
+    const PetscReal *euler = conserved + functionContext->eulerOffset;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        const PetscReal *eulerState = euler + s * conservedStride;
+        PetscReal density = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal speedSquare = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            speedSquare += PetscSqr(eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        PetscReal internalEnergy = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+        p[s] = (gam - 1.0) * density * internalEnergy - gam * pinf;
+    }
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::StiffenedGas::TemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *temperature, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscInt dim = functionContext->dim;
+    const PetscReal cp = functionContext->parameters.Cp;
+    const PetscReal pinf = functionContext->parameters.p0;
+    const PetscReal gam = functionContext->parameters.gamma;
+    const PetscReal *euler = conserved + functionContext->eulerOffset;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        const PetscReal *eulerState = euler + s * conservedStride;
+        PetscReal density = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal speedSquare = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            speedSquare += PetscSqr(eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        PetscReal internalEnergy = eulerState[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+        temperature[s] = (internalEnergy - pinf / density) * gam / cp;
+    }
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::StiffenedGas::SpeedOfSoundBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *a, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal gam = functionContext->parameters.gamma;
+    const PetscReal pinf = functionContext->parameters.p0;
+    const PetscReal *density = conserved + functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO;
+
+    // compute the pressure in place and then convert to the speed of sound
+    PetscCall(PressureBatchFunction(numberStates, conserved, conservedStride, a, ctx));
+    for (PetscInt s = 0; s < numberStates; s++) {
+        a[s] = PetscSqrtReal(gam * (a[s] + pinf) / density[s * conservedStride]);
+    }
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::StiffenedGas::PressureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *p, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal cp = functionContext->parameters.Cp;
+    const PetscReal pinf = functionContext->parameters.p0;
+    const PetscReal gam = functionContext->parameters.gamma;
+    const PetscReal *density = conserved + functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO;
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        PetscReal rho = density[s * conservedStride];
+        PetscReal internalEnergy = T[s] * cp / gam + pinf / rho;
+        p[s] = (gam - 1.0) * rho * internalEnergy - gam * pinf;
+    }
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::StiffenedGas::TemperatureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *temperature,
+                                                                              void *ctx) {
+    return TemperatureBatchFunction(numberStates, conserved, conservedStride, temperature, ctx);
+}
+PetscErrorCode ablate::eos::StiffenedGas::SpeedOfSoundTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *T, PetscReal *a,
+                                                                              void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const PetscReal gam = functionContext->parameters.gamma;
+    const PetscReal pinf = functionContext->parameters.p0;
+    const PetscReal *density = conserved + functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO;
+
+    PetscCall(PressureTemperatureBatchFunction(numberStates, conserved, conservedStride, T, a, ctx));
+    for (PetscInt s = 0; s < numberStates; s++) {
+        a[s] = PetscSqrtReal(gam * (a[s] + pinf) / density[s * conservedStride]);
+    }
+    PetscFunctionReturn(0);
+}
 PetscErrorCode ablate::eos::StiffenedGas::DensityFunction(const PetscReal *conserved, PetscReal *density, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
@@ -90,6 +90,137 @@ ablate::eos::TChem::ThermodynamicTemperatureMassFractionFunction ablate::eos::TC
                                                         .propertySize = speciesSizedProperties.count(property) ? (PetscInt)species.size() : 1};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::TChem::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+    auto batchContext = std::make_shared<BatchFunctionContext>(BatchFunctionContext{
+        .functionContext = *BuildFunctionContext(property, fields),
+        .perTeamScratch = tChemLib::Scratch<real_type_1d_view_host>::shmem_size(std::get<2>(thermodynamicFunctions.at(property))(kineticsModelDataDevice->nSpec))});
+    return ThermodynamicBatchFunction{.function = std::get<0>(thermodynamicBatchFunctions.at(property)), .context = batchContext, .propertySize = 1};
+}
+
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::TChem::GetThermodynamicTemperatureBatchFunction(ablate::eos::ThermodynamicProperty property,
+                                                                                                               const std::vector<domain::Field> &fields) const {
+    if (!thermodynamicBatchFunctions.count(property)) {
+        return EOS::GetThermodynamicTemperatureBatchFunction(property, fields);
+    }
+    auto batchContext = std::make_shared<BatchFunctionContext>(BatchFunctionContext{
+        .functionContext = *BuildFunctionContext(property, fields),
+        .perTeamScratch = tChemLib::Scratch<real_type_1d_view_host>::shmem_size(std::get<2>(thermodynamicFunctions.at(property))(kineticsModelDataDevice->nSpec))});
+    return ThermodynamicTemperatureBatchFunction{.function = std::get<1>(thermodynamicBatchFunctions.at(property)), .context = batchContext, .propertySize = 1};
+}
+
+void ablate::eos::TChem::PrepareBatch(ablate::eos::TChem::BatchFunctionContext &batchContext, PetscInt numberStates) {
+    auto &functionContext = batchContext.functionContext;
+
+    // only grow the working views, they are reused between calls
+    if ((PetscInt)functionContext.stateHost.extent(0) < numberStates) {
+        Kokkos::resize(functionContext.stateHost, numberStates, functionContext.stateHost.extent(1));
+        Kokkos::resize(functionContext.perSpeciesHost, numberStates, functionContext.perSpeciesHost.extent(1));
+        Kokkos::resize(functionContext.mixtureHost, numberStates);
+    }
+
+    // the league size sets the number of states computed
+    if (functionContext.policy.league_size() != numberStates) {
+        functionContext.policy = tChemLib::UseThisTeamPolicy<tChemLib::host_exec_space>::type(numberStates, Kokkos::AUTO());
+        functionContext.policy.set_scratch_size(1, Kokkos::PerTeam((int)batchContext.perTeamScratch));
+    }
+}
+
+void ablate::eos::TChem::FillBatchStateVectors(ablate::eos::TChem::BatchFunctionContext &batchContext, PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride,
+                                              const PetscReal *T) {
+    auto &functionContext = batchContext.functionContext;
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        const PetscReal *state = conserved + s * conservedStride;
+        auto stateHost = Impl::StateVector<real_type_1d_view_host>(functionContext.kineticsModelDataHost->nSpec, Kokkos::subview(functionContext.stateHost, s, Kokkos::ALL()));
+        FillWorkingVectorFromDensityMassFractions(
+            state[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO], T ? T[s] : 300.0, state + functionContext.densityYiOffset, stateHost);
+    }
+}
+
+PetscErrorCode ablate::eos::TChem::TemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *temperature, void *ctx) {
+    return TemperatureTemperatureBatchFunction(numberStates, conserved, conservedStride, nullptr, temperature, ctx);
+}
+
+PetscErrorCode ablate::eos::TChem::TemperatureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperatureGuess,
+                                                                       PetscReal *temperature, void *ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (BatchFunctionContext *)ctx;
+    auto &functionContext = batchContext->functionContext;
+    PrepareBatch(*batchContext, numberStates);
+
+    // Fill the working arrays using the temperature guess
+    FillBatchStateVectors(*batchContext, numberStates, conserved, conservedStride, temperatureGuess);
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        const PetscReal *euler = conserved + s * conservedStride + functionContext.eulerOffset;
+        PetscReal density = euler[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal speedSquare = 0.0;
+        for (PetscInt d = 0; d < functionContext.dim; d++) {
+            speedSquare += PetscSqr(euler[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        functionContext.mixtureHost[s] = euler[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+    }
+
+    // compute the temperature of every state at once
+    ablate::eos::tChem::Temperature::runHostBatch(
+        functionContext.policy, functionContext.stateHost, functionContext.mixtureHost, functionContext.perSpeciesHost, functionContext.enthalpyReferenceHost, *functionContext.kineticsModelDataHost);
+
+    // copy back the results
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        temperature[s] = Impl::StateVector<real_type_1d_view_host>(functionContext.kineticsModelDataHost->nSpec, Kokkos::subview(functionContext.stateHost, s, Kokkos::ALL())).Temperature();
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::TChem::PressureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *pressure, void *ctx) {
+    PetscFunctionBeginUser;
+    // the pressure output is used as scratch for the temperature
+    PetscCall(TemperatureBatchFunction(numberStates, conserved, conservedStride, pressure, ctx));
+    PetscCall(PressureTemperatureBatchFunction(numberStates, conserved, conservedStride, pressure, pressure, ctx));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::TChem::PressureTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature, PetscReal *pressure,
+                                                                    void *ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (BatchFunctionContext *)ctx;
+    auto &functionContext = batchContext->functionContext;
+    PrepareBatch(*batchContext, numberStates);
+    FillBatchStateVectors(*batchContext, numberStates, conserved, conservedStride, temperature);
+
+    ablate::eos::tChem::Pressure::runHostBatch(functionContext.policy, functionContext.stateHost, *functionContext.kineticsModelDataHost);
+
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        pressure[s] = Impl::StateVector<real_type_1d_view_host>(functionContext.kineticsModelDataHost->nSpec, Kokkos::subview(functionContext.stateHost, s, Kokkos::ALL())).Pressure();
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::TChem::SpeedOfSoundBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, PetscReal *speedOfSound, void *ctx) {
+    PetscFunctionBeginUser;
+    // the speedOfSound output is used as scratch for the temperature
+    PetscCall(TemperatureBatchFunction(numberStates, conserved, conservedStride, speedOfSound, ctx));
+    PetscCall(SpeedOfSoundTemperatureBatchFunction(numberStates, conserved, conservedStride, speedOfSound, speedOfSound, ctx));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::eos::TChem::SpeedOfSoundTemperatureBatchFunction(PetscInt numberStates, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature,
+                                                                        PetscReal *speedOfSound, void *ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (BatchFunctionContext *)ctx;
+    auto &functionContext = batchContext->functionContext;
+    PrepareBatch(*batchContext, numberStates);
+    FillBatchStateVectors(*batchContext, numberStates, conserved, conservedStride, temperature);
+
+    ablate::eos::tChem::SpeedOfSound::runHostBatch(functionContext.policy, functionContext.stateHost, functionContext.mixtureHost, *functionContext.kineticsModelDataHost);
+
+    for (PetscInt s = 0; s < numberStates; ++s) {
+        speedOfSound[s] = functionContext.mixtureHost(s);
+    }
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::eos::TChem::DensityFunction(const PetscReal *conserved, PetscReal *density, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
@@ -940,4 +1071,4 @@ REGISTER(ablate::eos::ChemistryModel, ablate::eos::TChem, "[TChemV2](https://git
          OPT(ablate::monitors::logs::Log, "log", "An optional log for TChem echo output (only used with yaml input)"),
          OPT(ablate::parameters::Parameters, "options",
              "time stepping options (dtMin, dtMax, dtDefault, dtEstimateFactor, relToleranceTime, relToleranceTime, absToleranceTime, relToleranceNewton, absToleranceNewton, maxNumNewtonIterations, "
-             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature)"));
+             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature, loadBalanceTolerance, isatTolerance, isatRadius, isatMaxRecords)"));
@@ -73,6 +73,22 @@ class TChem : public TChemBase, public std::enable_shared_from_this<ablate::eos:
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Produce a batched thermodynamic function.  Temperature, pressure, and speed of sound are evaluated with a single kokkos launch over the batch; other properties fall back to the default
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Produce a batched thermodynamic function when temperature (or a temperature guess) is known for each state
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetThermodynamicTemperatureBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce thermodynamic function for any property based upon the available fields and yi
      * @param property
@@ -213,6 +229,51 @@ class TChem : public TChemBase, public std::enable_shared_from_this<ablate::eos:
     static PetscErrorCode SpeciesSensibleEnthalpyTemperatureMassFractionFunction(const PetscReal conserved[], const PetscReal yi[], PetscReal T, PetscReal* property, void* ctx);
     /** @} */
 
+    /**
+     * The batch function context holds the working views sized for the largest batch seen so far
+     */
+    struct BatchFunctionContext {
+        //! the working views and policy, the league size of the policy is set to the current batch size
+        FunctionContext functionContext;
+        //! the per team scratch needed by the property
+        std::size_t perTeamScratch;
+    };
+
+    /**
+     * Resize the working views (if needed) and update the policy for the number of states
+     * @param batchContext
+     * @param numberStates
+     */
+    static void PrepareBatch(BatchFunctionContext& batchContext, PetscInt numberStates);
+
+    /**
+     * Fill the state vector for each state in the batch using the provided temperature
+     */
+    static void FillBatchStateVectors(BatchFunctionContext& batchContext, PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[]);
+
+    /** @name Batched Thermodynamic Properties Functions
+     * These functions evaluate the property for every state in the batch using a single TChem kernel launch
+     * @{
+     */
+    static PetscErrorCode TemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode PressureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode SpeedOfSoundBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    static PetscErrorCode TemperatureTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    static PetscErrorCode PressureTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    static PetscErrorCode SpeedOfSoundTemperatureBatchFunction(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property, void* ctx);
+    /** @} */
+
+    /**
+     * Store a map of the batched functions.  Any property not listed here falls back to the default EOS batch implementation
+     */
+    using ThermodynamicBatchStaticFunction = PetscErrorCode (*)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, PetscReal* property, void* ctx);
+    using ThermodynamicTemperatureBatchStaticFunction = PetscErrorCode (*)(PetscInt numberStates, const PetscReal conserved[], PetscInt conservedStride, const PetscReal T[], PetscReal* property,
+                                                                           void* ctx);
+    const std::map<ThermodynamicProperty, std::tuple<ThermodynamicBatchStaticFunction, ThermodynamicTemperatureBatchStaticFunction>> thermodynamicBatchFunctions = {
+        {ThermodynamicProperty::Temperature, {TemperatureBatchFunction, TemperatureTemperatureBatchFunction}},
+        {ThermodynamicProperty::Pressure, {PressureBatchFunction, PressureTemperatureBatchFunction}},
+        {ThermodynamicProperty::SpeedOfSound, {SpeedOfSoundBatchFunction, SpeedOfSoundTemperatureBatchFunction}}};
+
     /**
      * template function to call base tChem function
      */
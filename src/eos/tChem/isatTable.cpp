@@ -0,0 +1,129 @@
+#include "isatTable.hpp"
+#include <cmath>
+
+ablate::eos::tChem::IsatTable::IsatTable(std::size_t keySize, std::size_t valueSize, double tolerance, double initialRadius, std::size_t maxRecords, std::size_t maxGrowths)
+    : keySize(keySize), valueSize(valueSize), tolerance(tolerance), initialRadius(initialRadius), maxGrowths(maxGrowths > 0 ? maxGrowths : keySize), maxRecords(maxRecords) {}
+
+int ablate::eos::tChem::IsatTable::FindLeaf(const double* key, int& leafNode) const {
+    leafNode = root;
+    if (leafNode < 0) {
+        return -1;
+    }
+
+    while (nodes[leafNode].record < 0) {
+        const auto& node = nodes[leafNode];
+        double projection = 0.0;
+        for (std::size_t k = 0; k < keySize; ++k) {
+            projection += node.v[k] * key[k];
+        }
+        leafNode = projection > node.a ? node.right : node.left;
+    }
+    return nodes[leafNode].record;
+}
+
+double ablate::eos::tChem::IsatTable::EoaNorm(const double* key, const Record& record, double* mappedOffset) const {
+    // start with the initial sphere
+    const double sphereScale = 1.0 / (initialRadius * initialRadius);
+    double norm = 0.0;
+    for (std::size_t k = 0; k < keySize; ++k) {
+        const double offset = key[k] - record.key[k];
+        norm += offset * offset * sphereScale;
+        if (mappedOffset) {
+            mappedOffset[k] = offset * sphereScale;
+        }
+    }
+
+    // remove each rank one growth
+    const auto numberGrowths = record.growths.size() / keySize;
+    for (std::size_t g = 0; g < numberGrowths; ++g) {
+        const double* growth = record.growths.data() + g * keySize;
+        double projection = 0.0;
+        for (std::size_t k = 0; k < keySize; ++k) {
+            projection += growth[k] * (key[k] - record.key[k]);
+        }
+        norm -= projection * projection;
+        if (mappedOffset) {
+            for (std::size_t k = 0; k < keySize; ++k) {
+                mappedOffset[k] -= growth[k] * projection;
+            }
+        }
+    }
+    return norm;
+}
+
+bool ablate::eos::tChem::IsatTable::Retrieve(const double* key, double* value) {
+    int leafNode;
+    auto recordIndex = FindLeaf(key, leafNode);
+    if (recordIndex >= 0 && EoaNorm(key, records[recordIndex]) <= 1.0) {
+        const auto& record = records[recordIndex];
+        for (std::size_t v = 0; v < valueSize; ++v) {
+            value[v] = record.value[v];
+        }
+        statistics.hits++;
+        return true;
+    }
+    statistics.misses++;
+    return false;
+}
+
+void ablate::eos::tChem::IsatTable::Add(const double* key, const double* value) {
+    int leafNode;
+    auto recordIndex = FindLeaf(key, leafNode);
+
+    // grow the EOA if the nearest record still predicts this value
+    if (recordIndex >= 0 && records[recordIndex].growths.size() < maxGrowths * keySize) {
+        auto& record = records[recordIndex];
+        double error = 0.0;
+        for (std::size_t v = 0; v < valueSize; ++v) {
+            error += (value[v] - record.value[v]) * (value[v] - record.value[v]);
+        }
+        if (std::sqrt(error) <= tolerance) {
+            // stretch the EOA along the key direction so that the key is on its boundary, M' = M - (1 - 1/r^2)/r^2 (Mp)(Mp)', where r^2 = p'Mp.
+            // This is the smallest change with a fixed center that covers both the old EOA and the key.
+            std::vector<double> mappedOffset(keySize);
+            const double norm = EoaNorm(key, record, mappedOffset.data());
+            if (norm > 1.0) {
+                const double growthScale = std::sqrt((1.0 - 1.0 / norm) / norm);
+                for (std::size_t k = 0; k < keySize; ++k) {
+                    record.growths.push_back(growthScale * mappedOffset[k]);
+                }
+            }
+            statistics.grows++;
+            return;
+        }
+    }
+
+    if (records.size() >= maxRecords) {
+        return;
+    }
+
+    // store the new record
+    records.push_back(Record{.key = std::vector<double>(key, key + keySize), .value = std::vector<double>(value, value + valueSize), .growths = {}});
+    Node newLeaf;
+    newLeaf.record = (int)records.size() - 1;
+    statistics.adds++;
+
+    if (recordIndex < 0) {
+        nodes.push_back(newLeaf);
+        root = (int)nodes.size() - 1;
+        return;
+    }
+
+    // split the existing leaf with the plane halfway between the two records
+    Node oldLeaf;
+    oldLeaf.record = recordIndex;
+    nodes.push_back(oldLeaf);
+    nodes.push_back(newLeaf);
+
+    auto& node = nodes[leafNode];
+    const auto& oldKey = records[recordIndex].key;
+    node.record = -1;
+    node.left = (int)nodes.size() - 2;
+    node.right = (int)nodes.size() - 1;
+    node.v.resize(keySize);
+    node.a = 0.0;
+    for (std::size_t k = 0; k < keySize; ++k) {
+        node.v[k] = key[k] - oldKey[k];
+        node.a += node.v[k] * 0.5 * (key[k] + oldKey[k]);
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef ABLATELIBRARY_TCHEM_ISATTABLE_HPP
+#define ABLATELIBRARY_TCHEM_ISATTABLE_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace ablate::eos::tChem {
+
+/**
+ * A host side in situ adaptive tabulation (ISAT) table.  Each record maps a scaled query point to a scaled increment and holds an ellipsoid of accuracy (EOA) around the query point.
+ * The records are stored in the leaves of a binary tree where each internal node holds the cutting plane between the two records it separated.
+ *
+ * Each EOA starts as a sphere and is only stretched along the direction of a query that was checked against a direct computation, so the retrieval error is not
+ * extended to directions that were never checked.
+ */
+class IsatTable {
+   public:
+    //! hold the hit/grow/add counters for the table
+    struct Statistics {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t grows = 0;
+        std::size_t adds = 0;
+    };
+
+   private:
+    //! a single tabulated query point and the increment it maps to
+    struct Record {
+        std::vector<double> key;
+        std::vector<double> value;
+        //! the EOA is x'Mx <= 1 with M = I/initialRadius^2 - sum(g g') over each growth vector g, stored [growth][key]
+        std::vector<double> growths;
+    };
+
+    //! a leaf holds a record, an internal node holds the cutting plane v.x = a
+    struct Node {
+        int left = -1;
+        int right = -1;
+        int record = -1;
+        std::vector<double> v;
+        double a = 0.0;
+    };
+
+    //! the size of each query point
+    const std::size_t keySize;
+
+    //! the size of each increment
+    const std::size_t valueSize;
+
+    //! the allowed error in the scaled increment
+    const double tolerance;
+
+    //! the radius of the initial (spherical) region of accuracy in the scaled key space
+    const double initialRadius;
+
+    //! the maximum number of times a single record can be grown
+    const std::size_t maxGrowths;
+
+    //! stop adding records when this size is reached
+    const std::size_t maxRecords;
+
+    std::vector<Record> records;
+    std::vector<Node> nodes;
+    int root = -1;
+
+    Statistics statistics;
+
+    /**
+     * walks the tree to the record that is on the same side of every cutting plane as the key
+     * @return the record index or -1 if the table is empty
+     */
+    [[nodiscard]] int FindLeaf(const double* key, int& leafNode) const;
+
+    /**
+     * computes M (key - record.key) and returns (key - record.key)' M (key - record.key), which is at most one inside the EOA
+     * @param mappedOffset optional storage (keySize) for M (key - record.key)
+     */
+    [[nodiscard]] double EoaNorm(const double* key, const Record& record, double* mappedOffset = nullptr) const;
+
+   public:
+    /**
+     * @param keySize the size of each scaled query point
+     * @param valueSize the size of each scaled increment
+     * @param tolerance the allowed error in the scaled increment
+     * @param initialRadius the radius of the initial region of accuracy in the scaled key space
+     * @param maxRecords the maximum number of records to store
+     * @param maxGrowths the maximum number of times a single record can be grown, defaults to the key size
+     */
+    IsatTable(std::size_t keySize, std::size_t valueSize, double tolerance, double initialRadius, std::size_t maxRecords, std::size_t maxGrowths = 0);
+
+    /**
+     * Tries to retrieve the increment for this key.  The value is only written if the key is inside the EOA of a record.
+     * @return true if the increment was retrieved
+     */
+    bool Retrieve(const double* key, double* value);
+
+    /**
+     * Updates the table with a directly computed increment for a key that was not retrieved.  The EOA of the nearest record is stretched along the direction of
+     * the key if it already predicts the value within tolerance, otherwise a new record is added.
+     */
+    void Add(const double* key, const double* value);
+
+    /**
+     * return the number of stored records
+     */
+    [[nodiscard]] std::size_t Size() const { return records.size(); }
+
+    /**
+     * return the hit/miss/grow/add counters
+     */
+    [[nodiscard]] const Statistics& GetStatistics() const { return statistics; }
+};
+
+}  // namespace ablate::eos::tChem
+#endif
@@ -2,6 +2,8 @@
 #include <TChem_ConstantVolumeIgnitionReactor.hpp>
 #include <TChem_Impl_IgnitionZeroD_Problem.hpp>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 #include "constantVolumeIgnitionReactorTemperatureThreshold.hpp"
 #include "eos/tChem.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
@@ -24,6 +26,10 @@ void ablate::eos::tChem::SourceCalculator::ChemistryConstraints::Set(const std::
         jacobianInterval = options->Get("jacobianInterval", jacobianInterval);
         maxAttempts = options->Get("maxAttempts", maxAttempts);
         thresholdTemperature = options->Get("thresholdTemperature", thresholdTemperature);
+        loadBalanceTolerance = options->Get("loadBalanceTolerance", loadBalanceTolerance);
+        isatTolerance = options->Get("isatTolerance", isatTolerance);
+        isatRadius = options->Get("isatRadius", isatRadius);
+        isatMaxRecords = options->Get("isatMaxRecords", isatMaxRecords);
         reactorType = options->Get("reactorType", ReactorType::ConstantPressure);
     }
 }
@@ -31,6 +37,11 @@ void ablate::eos::tChem::SourceCalculator::ChemistryConstraints::Set(const std::
 ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain::Field>& fields, const std::shared_ptr<TChem> eosIn,
                                                        ablate::eos::tChem::SourceCalculator::ChemistryConstraints constraints, const ablate::domain::Range& cellRange)
     : chemistryConstraints(constraints), eos(eosIn), numberSpecies(eosIn->GetSpeciesVariables().size()) {
+    // the tabulated cells are not moved between ranks, so balancing would be silently skipped
+    if (constraints.isatTolerance > 0 && constraints.loadBalanceTolerance > 0) {
+        throw std::invalid_argument("ablate::eos::tChem::SourceCalculator cannot use both isatTolerance and loadBalanceTolerance");
+    }
+
     // determine the number of required cells
     std::size_t numberCells = cellRange.end - cellRange.start;
 
@@ -49,6 +60,19 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
     perSpeciesScratchDevice = real_type_2d_view("perSpeciesScratchDevice", numberCells, kineticModelGasConstData.nSpec);
     timeViewDevice = real_type_1d_view("time", numberCells);
     dtViewDevice = real_type_1d_view("delta time", numberCells);
+    failedCellsDevice = ordinal_type_1d_view("failedCellsDevice", numberCells);
+
+    // the table is keyed on the scaled state and log(dt) and stores the scaled change in state
+    if (constraints.isatTolerance > 0) {
+        isatTable = std::make_unique<IsatTable>(stateVecDim + 1, stateVecDim, constraints.isatTolerance, constraints.isatRadius, constraints.isatMaxRecords);
+
+        real_type_1d_view_host scaleHost("isatScale", stateVecDim);
+        Kokkos::deep_copy(scaleHost, 1.0);
+        Impl::StateVector<real_type_1d_view_host> scaleVector(kineticModelGasConstData.nSpec, scaleHost);
+        scaleVector.Pressure() = 101325.0;
+        scaleVector.Temperature() = 1000.0;
+        isatScale.assign(scaleHost.data(), scaleHost.data() + stateVecDim);
+    }
 
     // Create the default timeAdvanceObject
     timeAdvanceDefault._tbeg = 0.0;
@@ -117,6 +141,491 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
     densityYiId = densityYiField->id;
 }
 
+void ablate::eos::tChem::SourceCalculator::IntegrateBatch(ordinal_type batchSize, const real_type_2d_view& fac, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state,
+                                                          const real_type_1d_view& timeView, const real_type_1d_view& dtView, const real_type_2d_view& endState) {
+    // each team needs its own copy of the kinetic model data
+    if (kineticModelGasConstDataDevices.extent(0) < (std::size_t)batchSize) {
+        kineticModelDataClone = eos->GetKineticModelData().clone(batchSize);
+        kineticModelGasConstDataDevices = ::tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<exec_space>::type>(kineticModelDataClone);
+    }
+
+    auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), batchSize, Kokkos::AUTO());
+
+    // determine the required team size
+    switch (chemistryConstraints.reactorType) {
+        case ReactorType::ConstantPressure:
+            chemistryFunctionPolicy.set_scratch_size(
+                1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
+            break;
+        case ReactorType::ConstantVolume:
+            chemistryFunctionPolicy.set_scratch_size(
+                1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::ConstantVolumeIgnitionReactor::getWorkSpaceSize(solveTla, kineticModelGasConstDataDevice))));
+            break;
+    }
+
+    // assume a constant pressure zero D reaction for each cell
+    switch (chemistryConstraints.reactorType) {
+        case ReactorType::ConstantPressure:
+            if (chemistryConstraints.thresholdTemperature != 0.0) {
+                // If there is a thresholdTemperature, use the modified version of IgnitionZeroDTemperatureThreshold
+                ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
+                                                                                      tolNewtonDevice,
+                                                                                      tolTimeDevice,
+                                                                                      fac,
+                                                                                      timeAdvance,
+                                                                                      state,
+                                                                                      timeView,
+                                                                                      dtView,
+                                                                                      endState,
+                                                                                      kineticModelGasConstDataDevices,
+                                                                                      chemistryConstraints.thresholdTemperature);
+            } else {
+                // else fall back to the default tChem version
+                tChemLib::IgnitionZeroD::runDeviceBatch(chemistryFunctionPolicy,
+                                                        tolNewtonDevice,
+                                                        tolTimeDevice,
+                                                        fac,
+                                                        timeAdvance,
+                                                        state,
+                                                        timeView,
+                                                        dtView,
+                                                        endState,
+                                                        kineticModelGasConstDataDevices);
+            }
+            break;
+        case ReactorType::ConstantVolume:
+            // These arrays are not used when solveTla is false
+            real_type_3d_view state_z;
+            if (chemistryConstraints.thresholdTemperature != 0.0) {
+                ablate::eos::tChem::ConstantVolumeIgnitionReactorTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
+                                                                                                      solveTla,
+                                                                                                      thetaTla,
+                                                                                                      tolNewtonDevice,
+                                                                                                      tolTimeDevice,
+                                                                                                      fac,
+                                                                                                      timeAdvance,
+                                                                                                      state,
+                                                                                                      state_z,
+                                                                                                      timeView,
+                                                                                                      dtView,
+                                                                                                      endState,
+                                                                                                      state_z,
+                                                                                                      kineticModelGasConstDataDevices,
+                                                                                                      chemistryConstraints.thresholdTemperature);
+            } else {
+                ConstantVolumeIgnitionReactor::runDeviceBatch(chemistryFunctionPolicy,
+                                                              solveTla,
+                                                              thetaTla,
+                                                              tolNewtonDevice,
+                                                              tolTimeDevice,
+                                                              fac,
+                                                              timeAdvance,
+                                                              state,
+                                                              state_z,
+                                                              timeView,
+                                                              dtView,
+                                                              endState,
+                                                              state_z,
+                                                              kineticModelGasConstDataDevices);
+            }
+
+            break;
+    }
+}
+
+void ablate::eos::tChem::SourceCalculator::IntegrateWithRetry(ordinal_type batchSize, const real_type_2d_view& fac, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state,
+                                                              const real_type_1d_view& timeView, const real_type_1d_view& dtView, const real_type_2d_view& endState, double time, double dt) {
+    // make sure there is room to compact the failed entries
+    if (failedCellsDevice.extent(0) < (std::size_t)batchSize) {
+        failedCellsDevice = ordinal_type_1d_view("failedCellsDevice", batchSize);
+    }
+
+    auto timeAdvanceLocal = timeAdvance;
+    auto dtViewLocal = dtView;
+    auto chemistryConstraintsLocal = chemistryConstraints;
+    auto timeViewLocal = timeView;
+    auto endStateLocal = endState;
+    auto stateLocal = state;
+    auto failedCellsDeviceLocal = failedCellsDevice;
+    auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
+
+    for (int attempt = 0; attempt < chemistryConstraints.maxAttempts; ++attempt) {
+        auto factor = PetscPowInt(2, attempt);
+
+        if (attempt == 0) {
+            // Use a parallel for updating timeAdvanceDevice dt
+            Kokkos::parallel_for(
+                "timeAdvanceUpdate", Kokkos::RangePolicy<tChemLib::exec_space>(0, batchSize), KOKKOS_LAMBDA(const ordinal_type& i) {
+                    auto& tAdvAtI = timeAdvanceLocal(i);
+
+                    tAdvAtI._tbeg = time;
+                    tAdvAtI._tend = time + dt;
+                    tAdvAtI._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewLocal(i) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtI._dtmax), tAdvAtI._dtmin);
+                    // set the default time information
+                    timeViewLocal(i) = time;
+                });
+
+            // integrate every entry in the first attempt
+            IntegrateBatch(batchSize, fac, timeAdvance, state, timeView, dtView, endState);
+        } else {
+            // the failed cells are compacted into a smaller retry batch with a reduced initial dt.  Converged cells keep their results.
+            ordinal_type numberFailed = 0;
+            Kokkos::parallel_scan(
+                "failedCellCompaction",
+                Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize),
+                KOKKOS_LAMBDA(const ordinal_type& chemIndex, ordinal_type& failedIndex, const bool final) {
+                    // the reactors set the pressure to zero if they do not converge
+                    const auto stateAtI = Kokkos::subview(endStateLocal, chemIndex, Kokkos::ALL());
+                    Impl::StateVector<real_type_1d_view> stateVector(nSpecLocal, stateAtI);
+                    if (stateVector.Pressure() <= 0) {
+                        if (final) {
+                            failedCellsDeviceLocal(failedIndex) = chemIndex;
+                        }
+                        ++failedIndex;
+                    }
+                },
+                numberFailed);
+
+            if (numberFailed == 0) {
+                break;
+            }
+
+            // the first retry has the most failed cells, so the retry views are only allocated when they are too small and then reused
+            if (retryStateDevice.extent(0) < (std::size_t)numberFailed) {
+                retryFacDevice = real_type_2d_view("retryFac", numberFailed, fac.extent(1));
+                retryTimeAdvanceDevice = time_advance_type_1d_view("retryTimeAdvance", numberFailed);
+                retryStateDevice = real_type_2d_view("retryState", numberFailed, state.extent(1));
+                retryTimeViewDevice = real_type_1d_view("retryTime", numberFailed);
+                retryDtViewDevice = real_type_1d_view("retryDeltaTime", numberFailed);
+                retryEndStateDevice = real_type_2d_view("retryEndState", numberFailed, endState.extent(1));
+            }
+            auto retryFac = retryFacDevice;
+            auto retryTimeAdvance = retryTimeAdvanceDevice;
+            auto retryState = retryStateDevice;
+            auto retryTimeView = retryTimeViewDevice;
+            auto retryDtView = retryDtViewDevice;
+            auto retryEndState = retryEndStateDevice;
+
+            // gather the failed cells and reduce the starting dt
+            Kokkos::parallel_for(
+                "retryGather", Kokkos::RangePolicy<tChemLib::exec_space>(0, numberFailed), KOKKOS_LAMBDA(const ordinal_type& r) {
+                    const auto chemIndex = failedCellsDeviceLocal(r);
+                    for (std::size_t s = 0; s < retryState.extent(1); ++s) {
+                        retryState(r, s) = stateLocal(chemIndex, s);
+                    }
+
+                    auto& tAdvAtI = retryTimeAdvance(r);
+                    tAdvAtI = timeAdvanceLocal(chemIndex);
+                    tAdvAtI._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewLocal(chemIndex) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtI._dtmax) / factor, tAdvAtI._dtmin);
+                    retryTimeView(r) = time;
+                });
+
+            IntegrateBatch(numberFailed, retryFac, retryTimeAdvance, retryState, retryTimeView, retryDtView, retryEndState);
+
+            // scatter the retry results back to the full batch
+            Kokkos::parallel_for(
+                "retryScatter", Kokkos::RangePolicy<tChemLib::exec_space>(0, numberFailed), KOKKOS_LAMBDA(const ordinal_type& r) {
+                    const auto chemIndex = failedCellsDeviceLocal(r);
+                    for (std::size_t s = 0; s < retryEndState.extent(1); ++s) {
+                        endStateLocal(chemIndex, s) = retryEndState(r, s);
+                    }
+                    timeAdvanceLocal(chemIndex) = retryTimeAdvance(r);
+                    timeViewLocal(chemIndex) = retryTimeView(r);
+                    dtViewLocal(chemIndex) = retryDtView(r);
+                });
+        }
+    }
+}
+
+void ablate::eos::tChem::SourceCalculator::IntegrateBalanced(MPI_Comm comm, std::size_t numberCells, double time, double dt) {
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(comm, &rank) >> utilities::MpiUtilities::checkError;
+    MPI_Comm_size(comm, &size) >> utilities::MpiUtilities::checkError;
+
+    // estimate the cost of each cell from the number of substeps taken in the previous integration
+    Kokkos::deep_copy(stateHost, stateDevice);
+    auto dtViewHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dtViewDevice);
+    std::vector<double> cellCost(numberCells);
+    double localCost = 0.0;
+    for (std::size_t chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+        const auto stateAtI = Kokkos::subview(stateHost, chemIndex, Kokkos::ALL());
+        Impl::StateVector<real_type_1d_view_host> stateVector(kineticModelGasConstDataDevice.nSpec, stateAtI);
+
+        // cells below the threshold temperature are copied without integration
+        if (chemistryConstraints.thresholdTemperature != 0.0 && stateVector.Temperature() < chemistryConstraints.thresholdTemperature) {
+            cellCost[chemIndex] = 1.0;
+        } else {
+            cellCost[chemIndex] = PetscMax(1.0, dt / PetscMax(dtViewHost(chemIndex), chemistryConstraints.dtMin));
+        }
+        localCost += cellCost[chemIndex];
+    }
+
+    std::vector<double> rankCost(size);
+    MPI_Allgather(&localCost, 1, MPI_DOUBLE, rankCost.data(), 1, MPI_DOUBLE, comm) >> utilities::MpiUtilities::checkError;
+    const double meanCost = std::accumulate(rankCost.begin(), rankCost.end(), 0.0) / size;
+    const double maxCost = *std::max_element(rankCost.begin(), rankCost.end());
+
+    // only move work when the most loaded rank is outside the tolerance
+    if (size == 1 || meanCost <= 0.0 || maxCost <= chemistryConstraints.loadBalanceTolerance * meanCost) {
+        IntegrateWithRetry((ordinal_type)numberCells, facDevice, timeAdvanceDevice, stateDevice, timeViewDevice, dtViewDevice, endStateDevice, time, dt);
+        return;
+    }
+
+    // pair the overloaded ranks with the underloaded ranks.  Every rank computes the same plan but only keeps its own transfers
+    std::vector<std::pair<PetscMPIInt, double>> transfers;
+    std::vector<double> excessCost(size);
+    for (PetscMPIInt r = 0; r < size; ++r) {
+        excessCost[r] = rankCost[r] - meanCost;
+    }
+    PetscMPIInt receiver = 0;
+    for (PetscMPIInt donor = 0; donor < size; ++donor) {
+        while (excessCost[donor] > 0) {
+            while (receiver < size && excessCost[receiver] >= 0) {
+                ++receiver;
+            }
+            if (receiver == size) {
+                break;
+            }
+            const double amount = PetscMin(excessCost[donor], -excessCost[receiver]);
+            if (donor == rank) {
+                transfers.emplace_back(receiver, amount);
+            }
+            excessCost[donor] -= amount;
+            excessCost[receiver] += amount;
+        }
+    }
+
+    // hand out the most expensive cells first so that the fewest states are moved
+    std::vector<std::size_t> costOrder(numberCells);
+    std::iota(costOrder.begin(), costOrder.end(), 0);
+    std::sort(costOrder.begin(), costOrder.end(), [&cellCost](auto a, auto b) { return cellCost[a] > cellCost[b]; });
+    std::vector<PetscMPIInt> destination(numberCells, rank);
+    for (auto chemIndex : costOrder) {
+        for (auto& transfer : transfers) {
+            if (cellCost[chemIndex] <= transfer.second) {
+                destination[chemIndex] = transfer.first;
+                transfer.second -= cellCost[chemIndex];
+                break;
+            }
+        }
+    }
+
+    // each exported row holds the state followed by the dt estimate
+    const std::size_t stateVecDim = stateDevice.extent(1);
+    const std::size_t rowSize = stateVecDim + 1;
+    std::vector<PetscMPIInt> sendCounts(size, 0);
+    std::vector<std::size_t> keptCells;
+    for (std::size_t chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+        if (destination[chemIndex] == rank) {
+            keptCells.push_back(chemIndex);
+        } else {
+            sendCounts[destination[chemIndex]]++;
+        }
+    }
+    std::vector<PetscMPIInt> receiveCounts(size, 0);
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, comm) >> utilities::MpiUtilities::checkError;
+
+    // compute the row offsets for each rank
+    std::vector<PetscMPIInt> sendOffsets(size + 1, 0), receiveOffsets(size + 1, 0);
+    for (PetscMPIInt r = 0; r < size; ++r) {
+        sendOffsets[r + 1] = sendOffsets[r] + sendCounts[r];
+        receiveOffsets[r + 1] = receiveOffsets[r] + receiveCounts[r];
+    }
+    const std::size_t numberExported = sendOffsets[size];
+    const std::size_t numberImported = receiveOffsets[size];
+
+    // pack the exported states grouped by destination rank
+    std::vector<std::size_t> exportedCells(numberExported);
+    std::vector<double> sendBuffer(numberExported * rowSize);
+    {
+        std::vector<PetscMPIInt> packIndex(sendOffsets.begin(), sendOffsets.end() - 1);
+        for (std::size_t chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+            if (destination[chemIndex] != rank) {
+                const auto row = packIndex[destination[chemIndex]]++;
+                exportedCells[row] = chemIndex;
+                for (std::size_t s = 0; s < stateVecDim; ++s) {
+                    sendBuffer[row * rowSize + s] = stateHost(chemIndex, s);
+                }
+                sendBuffer[row * rowSize + stateVecDim] = dtViewHost(chemIndex);
+            }
+        }
+    }
+
+    // MPI expects the counts and displacements in units of doubles
+    auto scale = [rowSize](std::vector<PetscMPIInt> values) {
+        for (auto& value : values) {
+            value *= (PetscMPIInt)rowSize;
+        }
+        return values;
+    };
+    const auto sendValueCounts = scale(sendCounts);
+    const auto sendValueOffsets = scale(sendOffsets);
+    const auto receiveValueCounts = scale(receiveCounts);
+    const auto receiveValueOffsets = scale(receiveOffsets);
+
+    std::vector<double> receiveBuffer(numberImported * rowSize);
+    MPI_Alltoallv(sendBuffer.data(),
+                  sendValueCounts.data(),
+                  sendValueOffsets.data(),
+                  MPI_DOUBLE,
+                  receiveBuffer.data(),
+                  receiveValueCounts.data(),
+                  receiveValueOffsets.data(),
+                  MPI_DOUBLE,
+                  comm) >>
+        utilities::MpiUtilities::checkError;
+
+    // build a single batch from the kept and imported cells
+    const std::size_t batchSize = keptCells.size() + numberImported;
+    real_type_2d_view batchState("balancedState", batchSize, stateVecDim);
+    real_type_1d_view batchDtView("balancedDeltaTime", batchSize);
+    auto batchStateHost = Kokkos::create_mirror_view(batchState);
+    auto batchDtViewHost = Kokkos::create_mirror_view(batchDtView);
+    for (std::size_t b = 0; b < keptCells.size(); ++b) {
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            batchStateHost(b, s) = stateHost(keptCells[b], s);
+        }
+        batchDtViewHost(b) = dtViewHost(keptCells[b]);
+    }
+    for (std::size_t i = 0; i < numberImported; ++i) {
+        const auto b = keptCells.size() + i;
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            batchStateHost(b, s) = receiveBuffer[i * rowSize + s];
+        }
+        batchDtViewHost(b) = receiveBuffer[i * rowSize + stateVecDim];
+    }
+    Kokkos::deep_copy(batchState, batchStateHost);
+    Kokkos::deep_copy(batchDtView, batchDtViewHost);
+
+    real_type_2d_view batchFac("balancedFac", batchSize, facDevice.extent(1));
+    time_advance_type_1d_view batchTimeAdvance("balancedTimeAdvance", batchSize);
+    Kokkos::deep_copy(batchTimeAdvance, timeAdvanceDefault);
+    real_type_1d_view batchTimeView("balancedTime", batchSize);
+    real_type_2d_view batchEndState("balancedEndState", batchSize, stateVecDim);
+    IntegrateWithRetry((ordinal_type)batchSize, batchFac, batchTimeAdvance, batchState, batchTimeView, batchDtView, batchEndState, time, dt);
+
+    // copy the kept results back and return the imported results to their owners
+    auto batchEndStateHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), batchEndState);
+    Kokkos::deep_copy(batchDtViewHost, batchDtView);
+    auto endStateHost = Kokkos::create_mirror_view(endStateDevice);
+    for (std::size_t b = 0; b < keptCells.size(); ++b) {
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            endStateHost(keptCells[b], s) = batchEndStateHost(b, s);
+        }
+        dtViewHost(keptCells[b]) = batchDtViewHost(b);
+    }
+    for (std::size_t i = 0; i < numberImported; ++i) {
+        const auto b = keptCells.size() + i;
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            receiveBuffer[i * rowSize + s] = batchEndStateHost(b, s);
+        }
+        receiveBuffer[i * rowSize + stateVecDim] = batchDtViewHost(b);
+    }
+
+    MPI_Alltoallv(receiveBuffer.data(),
+                  receiveValueCounts.data(),
+                  receiveValueOffsets.data(),
+                  MPI_DOUBLE,
+                  sendBuffer.data(),
+                  sendValueCounts.data(),
+                  sendValueOffsets.data(),
+                  MPI_DOUBLE,
+                  comm) >>
+        utilities::MpiUtilities::checkError;
+
+    for (std::size_t row = 0; row < numberExported; ++row) {
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            endStateHost(exportedCells[row], s) = sendBuffer[row * rowSize + s];
+        }
+        dtViewHost(exportedCells[row]) = sendBuffer[row * rowSize + stateVecDim];
+    }
+    Kokkos::deep_copy(endStateDevice, endStateHost);
+    Kokkos::deep_copy(dtViewDevice, dtViewHost);
+}
+
+void ablate::eos::tChem::SourceCalculator::IntegrateTabulated(std::size_t numberCells, double time, double dt) {
+    Kokkos::deep_copy(stateHost, stateDevice);
+    auto dtViewHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dtViewDevice);
+    auto endStateHost = Kokkos::create_mirror_view(endStateDevice);
+    const std::size_t stateVecDim = stateDevice.extent(1);
+
+    // build the scaled key for each cell and retrieve the increment when possible
+    const auto& statisticsBefore = isatTable->GetStatistics();
+    const auto hitsBefore = statisticsBefore.hits, growsBefore = statisticsBefore.grows, addsBefore = statisticsBefore.adds;
+    std::vector<double> keys(numberCells * (stateVecDim + 1));
+    std::vector<double> increment(stateVecDim);
+    std::vector<std::size_t> missedCells;
+    for (std::size_t chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+        auto key = keys.data() + chemIndex * (stateVecDim + 1);
+        for (std::size_t s = 0; s < stateVecDim; ++s) {
+            key[s] = stateHost(chemIndex, s) / isatScale[s];
+        }
+        key[stateVecDim] = std::log(dt);
+
+        if (isatTable->Retrieve(key, increment.data())) {
+            for (std::size_t s = 0; s < stateVecDim; ++s) {
+                endStateHost(chemIndex, s) = stateHost(chemIndex, s) + increment[s] * isatScale[s];
+            }
+        } else {
+            missedCells.push_back(chemIndex);
+        }
+    }
+
+    // integrate only the missed cells
+    if (!missedCells.empty()) {
+        const std::size_t batchSize = missedCells.size();
+        real_type_2d_view batchState("tabulatedState", batchSize, stateVecDim);
+        real_type_1d_view batchDtView("tabulatedDeltaTime", batchSize);
+        auto batchStateHost = Kokkos::create_mirror_view(batchState);
+        auto batchDtViewHost = Kokkos::create_mirror_view(batchDtView);
+        for (std::size_t b = 0; b < batchSize; ++b) {
+            for (std::size_t s = 0; s < stateVecDim; ++s) {
+                batchStateHost(b, s) = stateHost(missedCells[b], s);
+            }
+            batchDtViewHost(b) = dtViewHost(missedCells[b]);
+        }
+        Kokkos::deep_copy(batchState, batchStateHost);
+        Kokkos::deep_copy(batchDtView, batchDtViewHost);
+
+        real_type_2d_view batchFac("tabulatedFac", batchSize, facDevice.extent(1));
+        time_advance_type_1d_view batchTimeAdvance("tabulatedTimeAdvance", batchSize);
+        Kokkos::deep_copy(batchTimeAdvance, timeAdvanceDefault);
+        real_type_1d_view batchTimeView("tabulatedTime", batchSize);
+        real_type_2d_view batchEndState("tabulatedEndState", batchSize, stateVecDim);
+        IntegrateWithRetry((ordinal_type)batchSize, batchFac, batchTimeAdvance, batchState, batchTimeView, batchDtView, batchEndState, time, dt);
+
+        // copy back the results and add the converged increments to the table
+        auto batchEndStateHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), batchEndState);
+        Kokkos::deep_copy(batchDtViewHost, batchDtView);
+        for (std::size_t b = 0; b < batchSize; ++b) {
+            const auto chemIndex = missedCells[b];
+            for (std::size_t s = 0; s < stateVecDim; ++s) {
+                endStateHost(chemIndex, s) = batchEndStateHost(b, s);
+                increment[s] = (batchEndStateHost(b, s) - stateHost(chemIndex, s)) / isatScale[s];
+            }
+            dtViewHost(chemIndex) = batchDtViewHost(b);
+
+            const auto endStateAtI = Kokkos::subview(endStateHost, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view_host> endStateVector(kineticModelGasConstDataDevice.nSpec, endStateAtI);
+            if (endStateVector.Pressure() > 0) {
+                isatTable->Add(keys.data() + chemIndex * (stateVecDim + 1), increment.data());
+            }
+        }
+    }
+
+    Kokkos::deep_copy(endStateDevice, endStateHost);
+    Kokkos::deep_copy(dtViewDevice, dtViewHost);
+
+    const auto& statistics = isatTable->GetStatistics();
+    PetscInfo(nullptr,
+              "ISAT table with %zu records: %zu hits, %zu grows, %zu adds\n",
+              isatTable->Size(),
+              statistics.hits - hitsBefore,
+              statistics.grows - growsBefore,
+              statistics.adds - addsBefore) >>
+        utilities::PetscUtilities::checkError;
+}
+
 void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::domain::Range& cellRange, PetscReal time, PetscReal dt, Vec globFlowVec) {
     StartEvent("tChem::SourceCalculator::ComputeSource");
     // Get the valid cell range over this region
@@ -203,132 +712,20 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::domain::R
     // Compute the pressure into the state field in the device
     ablate::eos::tChem::Pressure::runDeviceBatch(pressureFunctionPolicy, stateDevice, kineticModelGasConstDataDevice);
 
-    auto timeAdvanceDeviceLocal = timeAdvanceDevice;
-    auto dtViewDeviceLocal = dtViewDevice;
-    auto chemistryConstraintsLocal = chemistryConstraints;
-    auto timeViewDeviceLocal = timeViewDevice;
-
-    double minimumPressure = 0;
-    for (int attempt = 0; (attempt < chemistryConstraints.maxAttempts) && minimumPressure == 0; ++attempt) {
-        auto factor = PetscPowInt(2, attempt);
-        // Use a parallel for updating timeAdvanceDevice dt
-        Kokkos::parallel_for(
-            "timeAdvanceUpdate", Kokkos::RangePolicy<tChemLib::exec_space>(0, numberCells), KOKKOS_LAMBDA(const ordinal_type& i) {
-                auto& tAdvAtI = timeAdvanceDeviceLocal(i);
-
-                tAdvAtI._tbeg = time;
-                tAdvAtI._tend = time + dt;
-                tAdvAtI._dt = Kokkos::max(Kokkos::min(Kokkos::min(dtViewDeviceLocal(i) * chemistryConstraintsLocal.dtEstimateFactor, dt), tAdvAtI._dtmax) / factor, tAdvAtI._dtmin);
-                // set the default time information
-                timeViewDeviceLocal(i) = time;
-            });
-
-        auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberCells, Kokkos::AUTO());
-
-        // determine the required team size
-        switch (chemistryConstraints.reactorType) {
-            case ReactorType::ConstantPressure:
-                chemistryFunctionPolicy.set_scratch_size(
-                    1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
-                break;
-            case ReactorType::ConstantVolume:
-                chemistryFunctionPolicy.set_scratch_size(
-                    1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::ConstantVolumeIgnitionReactor::getWorkSpaceSize(solveTla, kineticModelGasConstDataDevice))));
-                break;
-        }
-
-        // assume a constant pressure zero D reaction for each cell
-        switch (chemistryConstraints.reactorType) {
-            case ReactorType::ConstantPressure:
-                if (chemistryConstraints.thresholdTemperature != 0.0) {
-                    // If there is a thresholdTemperature, use the modified version of IgnitionZeroDTemperatureThreshold
-                    ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
-                                                                                          tolNewtonDevice,
-                                                                                          tolTimeDevice,
-                                                                                          facDevice,
-                                                                                          timeAdvanceDevice,
-                                                                                          stateDevice,
-                                                                                          timeViewDevice,
-                                                                                          dtViewDevice,
-                                                                                          endStateDevice,
-                                                                                          kineticModelGasConstDataDevices,
-                                                                                          chemistryConstraints.thresholdTemperature);
-                } else {
-                    // else fall back to the default tChem version
-                    tChemLib::IgnitionZeroD::runDeviceBatch(chemistryFunctionPolicy,
-                                                            tolNewtonDevice,
-                                                            tolTimeDevice,
-                                                            facDevice,
-                                                            timeAdvanceDevice,
-                                                            stateDevice,
-                                                            timeViewDevice,
-                                                            dtViewDevice,
-                                                            endStateDevice,
-                                                            kineticModelGasConstDataDevices);
-                }
-                break;
-            case ReactorType::ConstantVolume:
-                // These arrays are not used when solveTla is false
-                real_type_3d_view state_z;
-                if (chemistryConstraints.thresholdTemperature != 0.0) {
-                    ablate::eos::tChem::ConstantVolumeIgnitionReactorTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
-                                                                                                          solveTla,
-                                                                                                          thetaTla,
-                                                                                                          tolNewtonDevice,
-                                                                                                          tolTimeDevice,
-                                                                                                          facDevice,
-                                                                                                          timeAdvanceDevice,
-                                                                                                          stateDevice,
-                                                                                                          state_z,
-                                                                                                          timeViewDevice,
-                                                                                                          dtViewDevice,
-                                                                                                          endStateDevice,
-                                                                                                          state_z,
-                                                                                                          kineticModelGasConstDataDevices,
-                                                                                                          chemistryConstraints.thresholdTemperature);
-                } else {
-                    ConstantVolumeIgnitionReactor::runDeviceBatch(chemistryFunctionPolicy,
-                                                                  solveTla,
-                                                                  thetaTla,
-                                                                  tolNewtonDevice,
-                                                                  tolTimeDevice,
-                                                                  facDevice,
-                                                                  timeAdvanceDevice,
-                                                                  stateDevice,
-                                                                  state_z,
-                                                                  timeViewDevice,
-                                                                  dtViewDevice,
-                                                                  endStateDevice,
-                                                                  state_z,
-                                                                  kineticModelGasConstDataDevices);
-                }
-
-                break;
-        }
-
-        // check the output pressure, if it is zero the integration failed
-        auto endStateDeviceLocal = endStateDevice;
-        auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
-        Kokkos::parallel_reduce(
-            "pressureCheck",
-            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells),
-            KOKKOS_LAMBDA(const int& chemIndex, double& pressureMin) {
-                // cast the state at i to a state vector
-                const auto stateAtI = Kokkos::subview(endStateDeviceLocal, chemIndex, Kokkos::ALL());
-                Impl::StateVector<real_type_1d_view> stateVector(nSpecLocal, stateAtI);
-                auto pressureAtI = stateVector.Pressure();
-                if (pressureAtI < pressureMin) {
-                    pressureMin = pressureAtI;
-                }
-            },
-            Kokkos::Min<double>(minimumPressure));
+    // integrate the chemistry, optionally sharing the work with other ranks
+    if (isatTable) {
+        IntegrateTabulated(numberCells, time, dt);
+    } else if (chemistryConstraints.loadBalanceTolerance > 0) {
+        IntegrateBalanced(PetscObjectComm((PetscObject)solutionDm), numberCells, time, dt);
+    } else {
+        IntegrateWithRetry(numberCells, facDevice, timeAdvanceDevice, stateDevice, timeViewDevice, dtViewDevice, endStateDevice, time, dt);
     }
 
     // Get the local copies
+    auto sourceTermsDeviceLocal = sourceTermsDevice;
     auto stateDeviceLocal = stateDevice;
     auto endStateDeviceLocal = endStateDevice;
     auto nSpecLocal = kineticModelGasConstDataDevice.nSpec;
-    auto sourceTermsDeviceLocal = sourceTermsDevice;
     auto cellRangeStartLocal = cellRange.start;
     // Use a parallel for computing the source term
     auto enthalpyOfFormationLocal = eos->GetEnthalpyOfFormation();
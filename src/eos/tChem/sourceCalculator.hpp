@@ -3,6 +3,7 @@
 
 #include <TChem_KineticModelGasConstData.hpp>
 #include "eos/chemistryModel.hpp"
+#include "isatTable.hpp"
 
 namespace tChemLib = TChem;
 
@@ -44,6 +45,15 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
         // store an optional threshold temperature.  Only compute the reactions if the temperature is above thresholdTemperature
         double thresholdTemperature = 0.0;
 
+        // when positive, cells are moved between ranks if the most loaded rank exceeds the mean chemistry cost by this factor
+        double loadBalanceTolerance = 0.0;
+
+        // when positive, reactor increments are tabulated with this tolerance and retrieved instead of integrated.  This cannot be combined with load balancing
+        double isatTolerance = 0.0;
+        // the initial radius of each tabulated region of accuracy in the scaled state space
+        double isatRadius = 1.0E-3;
+        int isatMaxRecords = 100000;
+
         void Set(const std::shared_ptr<ablate::parameters::Parameters>&);
     };
 
@@ -70,6 +80,13 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
      */
     void AddSource(const ablate::domain::Range& cellRange, Vec localXVec, Vec localFVec) override;
 
+   protected:
+    /**
+     * Integrates the reactor for the first batchSize entries of the supplied views.  A failed entry is marked with a zero end state pressure.
+     */
+    virtual void IntegrateBatch(ordinal_type batchSize, const real_type_2d_view& fac, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state, const real_type_1d_view& timeView,
+                                const real_type_1d_view& dtView, const real_type_2d_view& endState);
+
    private:
     //! copy of constraints
     ChemistryConstraints chemistryConstraints;
@@ -115,6 +132,21 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     real_type_1d_view timeViewDevice;
     real_type_1d_view dtViewDevice;
 
+    // the optional table of reactor increments and the scale applied to each state vector component
+    std::unique_ptr<IsatTable> isatTable;
+    std::vector<double> isatScale;
+
+    // the chemIndex of each cell that failed to integrate, compacted into the front of the view for the retry batch
+    ordinal_type_1d_view failedCellsDevice;
+
+    // the retry batch views, sized for the largest number of failed cells seen so far and reused between attempts
+    real_type_2d_view retryFacDevice;
+    time_advance_type_1d_view retryTimeAdvanceDevice;
+    real_type_2d_view retryStateDevice;
+    real_type_1d_view retryTimeViewDevice;
+    real_type_1d_view retryDtViewDevice;
+    real_type_2d_view retryEndStateDevice;
+
     // Hard code some values needed for the constant volume reactor
     static inline constexpr bool solveTla = false;   // do not calculate tangent linear approximation (TLA) for the const volume reactions
     static inline constexpr real_type thetaTla = 0;  // this is not used when solveTla is false
@@ -123,6 +155,22 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     tChemLib::KineticModelConstData<typename Tines::UseThisDevice<exec_space>::type> kineticModelGasConstDataDevice;
     kmd_type_1d_view_host kineticModelDataClone;
     Kokkos::View<KineticModelGasConstData<typename Tines::UseThisDevice<exec_space>::type>*, typename Tines::UseThisDevice<exec_space>::type> kineticModelGasConstDataDevices;
+
+    /**
+     * Integrates the batch and retries only the entries that failed with a smaller initial dt
+     */
+    void IntegrateWithRetry(ordinal_type batchSize, const real_type_2d_view& fac, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state, const real_type_1d_view& timeView,
+                            const real_type_1d_view& dtView, const real_type_2d_view& endState, double time, double dt);
+
+    /**
+     * Integrates the local cells after moving reactor states from overloaded ranks to underloaded ranks.  The end states are returned to the owning rank.
+     */
+    void IntegrateBalanced(MPI_Comm comm, std::size_t numberCells, double time, double dt);
+
+    /**
+     * Retrieves the end state of each local cell from the isat table and only integrates the cells that miss
+     */
+    void IntegrateTabulated(std::size_t numberCells, double time, double dt);
 };
 
 /**
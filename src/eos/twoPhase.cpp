@@ -13,10 +13,10 @@ static inline void SimpleGasGasDecode(PetscInt dim, ablate::eos::TwoPhase::Decod
     PetscReal alpha1rho1 = in->alphaRho1;
     PetscReal rho = in->rho;
     PetscReal e = in->e;
-    PetscReal gamma1 = in->parameters.gamma1;
-    PetscReal gamma2 = in->parameters.gamma2;
-    PetscReal R1 = in->parameters.rGas1;
-    PetscReal R2 = in->parameters.rGas2;
+    PetscReal gamma1 = in->parameters->gamma1;
+    PetscReal gamma2 = in->parameters->gamma2;
+    PetscReal R1 = in->parameters->rGas1;
+    PetscReal R2 = in->parameters->rGas2;
     PetscReal cv1 = R1 / (gamma1 - 1);
     PetscReal cv2 = R2 / (gamma2 - 1);
     PetscReal Y1 = alpha1rho1 / rho;
@@ -58,11 +58,11 @@ static inline void SimpleGasStiffDecode(PetscInt dim, ablate::eos::TwoPhase::Dec
     PetscReal alpha1rho1 = in->alphaRho1;
     PetscReal rho = in->rho;
     PetscReal e = in->e;
-    PetscReal gamma1 = in->parameters.gamma1;
-    PetscReal gamma2 = in->parameters.gamma2;
-    PetscReal R1 = in->parameters.rGas1;
-    PetscReal cp2 = in->parameters.Cp2;
-    PetscReal p02 = in->parameters.p02;
+    PetscReal gamma1 = in->parameters->gamma1;
+    PetscReal gamma2 = in->parameters->gamma2;
+    PetscReal R1 = in->parameters->rGas1;
+    PetscReal cp2 = in->parameters->Cp2;
+    PetscReal p02 = in->parameters->p02;
     PetscReal cv1 = R1 / (gamma1 - 1);
     PetscReal Y1 = alpha1rho1 / rho;
     PetscReal Y2 = (rho - alpha1rho1) / rho;
@@ -103,12 +103,12 @@ static inline void SimpleStiffStiffDecode(PetscInt dim, ablate::eos::TwoPhase::D
     PetscReal alpha1rho1 = in->alphaRho1;
     PetscReal rho = in->rho;
     PetscReal e = in->e;
-    PetscReal gamma1 = in->parameters.gamma1;
-    PetscReal gamma2 = in->parameters.gamma2;
-    PetscReal cp1 = in->parameters.Cp1;
-    PetscReal cp2 = in->parameters.Cp2;
-    PetscReal p01 = in->parameters.p01;
-    PetscReal p02 = in->parameters.p02;
+    PetscReal gamma1 = in->parameters->gamma1;
+    PetscReal gamma2 = in->parameters->gamma2;
+    PetscReal cp1 = in->parameters->Cp1;
+    PetscReal cp2 = in->parameters->Cp2;
+    PetscReal p01 = in->parameters->p01;
+    PetscReal p02 = in->parameters->p02;
     PetscReal Y1 = alpha1rho1 / rho;
     PetscReal Y2 = (rho - alpha1rho1) / rho;
     PetscReal T, p, rho1, rho2, e1, e2;  // initiate output variables
@@ -305,6 +305,30 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::TwoPhase::GetThermody
     }
 }
 
+ablate::eos::TwoPhase::DecodeStateFunction ablate::eos::TwoPhase::GetDecodeStateFunction(const std::vector<domain::Field> &fields) const {
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    auto densityVFField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::processes::TwoPhaseEulerAdvection::DENSITY_VF_FIELD; });
+    auto volumeFractionField =
+        std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::processes::TwoPhaseEulerAdvection::VOLUME_FRACTION_FIELD; });
+    if (eulerField == fields.end() || densityVFField == fields.end() || volumeFractionField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::TwoPhase decode state function requires the EULER_FIELD, DENSITY_VF_FIELD, and VOLUME_FRACTION_FIELD Fields");
+    }
+
+    auto context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2,
+                                                                     .eulerOffset = eulerField->offset,
+                                                                     .densityVFOffset = densityVFField->offset,
+                                                                     .volumeFractionOffset = volumeFractionField->offset,
+                                                                     .parameters = parameters});
+
+    if (parameters.p01 == 0 && parameters.p02 == 0) {  // GasGas case
+        return DecodeStateFunction{.function = DecodeStateFunctionGasGas, .context = context};
+    } else if (parameters.p01 != 0 && parameters.p02 != 0) {  // LiquidLiquid case
+        return DecodeStateFunction{.function = DecodeStateFunctionLiquidLiquid, .context = context};
+    } else {  // GasLiquid case, also the default air/water
+        return DecodeStateFunction{.function = DecodeStateFunctionGasLiquid, .context = context};
+    }
+}
+
 ablate::eos::EOSFunction ablate::eos::TwoPhase::GetFieldFunctionFunction(const std::string &field, ablate::eos::ThermodynamicProperty property1, ablate::eos::ThermodynamicProperty property2,
                                                                          std::vector<std::string> otherProperties) const {
     if (otherProperties != std::vector<std::string>{VF} && otherProperties != std::vector<std::string>{VF, YI}) {  // VF not in otherProperties){
@@ -655,7 +679,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureFunctionGasGas(const PetscReal *co
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -681,7 +705,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureFunctionGasLiquid(const PetscReal
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -707,7 +731,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureFunctionLiquidLiquid(const PetscRe
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -734,7 +758,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureTemperatureFunctionGasGas(const Pe
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -760,7 +784,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureTemperatureFunctionGasLiquid(const
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -786,7 +810,7 @@ PetscErrorCode ablate::eos::TwoPhase::PressureTemperatureFunctionLiquidLiquid(co
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -813,7 +837,7 @@ PetscErrorCode ablate::eos::TwoPhase::TemperatureFunctionGasGas(const PetscReal
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
     *temperature = decodeOut.T;
@@ -839,7 +863,7 @@ PetscErrorCode ablate::eos::TwoPhase::TemperatureFunctionGasLiquid(const PetscRe
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *temperature = decodeOut.T;
@@ -865,7 +889,7 @@ PetscErrorCode ablate::eos::TwoPhase::TemperatureFunctionLiquidLiquid(const Pets
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     *temperature = decodeOut.T;
@@ -931,7 +955,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyFunctionGasGas(const Petsc
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -955,7 +979,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyFunctionGasLiquid(const Pe
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -979,7 +1003,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyFunctionLiquidLiquid(const
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -1004,7 +1028,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyTemperatureFunctionGasGas(
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -1028,7 +1052,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyTemperatureFunctionGasLiqu
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -1052,7 +1076,7 @@ PetscErrorCode ablate::eos::TwoPhase::SensibleEnthalpyTemperatureFunctionLiquidL
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = sensibleInternalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
     PetscReal p = decodeOut.p;  // [rho1, rho2, e1, e2, p, T]
@@ -1084,7 +1108,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeFunctionGasGas(c
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1131,7 +1155,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeFunctionGasLiqui
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1177,7 +1201,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeFunctionLiquidLi
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1223,7 +1247,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeTemperatureFunct
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1269,7 +1293,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeTemperatureFunct
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1314,7 +1338,7 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantVolumeTemperatureFunct
     decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
     decodeIn.rho = density;
     decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+    decodeIn.parameters = &functionContext->parameters;
 
     PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
 
@@ -1435,145 +1459,84 @@ PetscErrorCode ablate::eos::TwoPhase::SpecificHeatConstantPressureTemperatureFun
 PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionGasGas(const PetscReal *conserved, PetscReal *a, void *ctx) {
     PetscFunctionBeginUser;
     // isentropic sound speed a_mix
+    DecodedState state;
+    PetscCall(DecodeStateFunctionGasGas(conserved, &state, ctx));
+    *a = state.speedOfSound;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionGasLiquid(const PetscReal *conserved, PetscReal *a, void *ctx) {
+    PetscFunctionBeginUser;
+    // isentropic sound speed a_mix
+    DecodedState state;
+    PetscCall(DecodeStateFunctionGasLiquid(conserved, &state, ctx));
+    *a = state.speedOfSound;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionLiquidLiquid(const PetscReal *conserved, PetscReal *a, void *ctx) {
+    PetscFunctionBeginUser;
+    // isentropic sound speed a_mix
+    DecodedState state;
+    PetscCall(DecodeStateFunctionLiquidLiquid(conserved, &state, ctx));
+    *a = state.speedOfSound;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionGasGas(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
+    PetscFunctionBeginUser;
+    // same as speedOfSoundFunction, isentropic sound speed a_mix at the supplied temperature
     auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-
-    // get kinetic energy for internal energy calculation
-    PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-    }
-    ke *= 0.5;
-
-    // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
     DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
-
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
-
     SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
-    // isothermal sound speeds
-    cv1 = functionContext->parameters.rGas1 / (functionContext->parameters.gamma1 - 1);
-    cv2 = functionContext->parameters.rGas2 / (functionContext->parameters.gamma2 - 1);
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) * cv1 * decodeOut.T);  // ideal gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) * cv2 * decodeOut.T);  // ideal gas eos
-
-    PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;
-    PetscReal T = decodeOut.T;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
-
-    // mixed specific heat constant volume
-    PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
-    PetscReal w2 = Y2 / PetscSqr(rho2 * at2);
-    PetscReal cv_mix = Y1 * cv1 + Y2 * cv2 + (w1 * w2) / (w1 + w2) * PetscSqr(cv1 * (gamma1 - 1) * rho1 - cv2 * (gamma2 - 1) * rho2) * T;
-    // mixed isothermal sound speed
-    PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
-    PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
-    // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
+    *a = SpeedOfSoundGasGas(decodeIn, decodeOut, T);
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionGasLiquid(const PetscReal *conserved, PetscReal *a, void *ctx) {
+PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionGasLiquid(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
     PetscFunctionBeginUser;
-    // isentropic sound speed a_mix
+    // same as speedOfSoundFunction, isentropic sound speed a_mix at the supplied temperature
     auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-
-    // get kinetic energy for internal energy calculation
-    PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-    }
-    ke *= 0.5;
-
-    // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
     DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
-
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
-
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
-    cv1 = functionContext->parameters.rGas1 / (functionContext->parameters.gamma1 - 1);
-    cv2 = functionContext->parameters.Cp2 / functionContext->parameters.gamma2;
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) * cv1 * decodeOut.T);                                                                   // ideal gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) / functionContext->parameters.gamma2 * functionContext->parameters.Cp2 * decodeOut.T);  // stiffened gas eos
-
-    PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;
-    PetscReal T = decodeOut.T;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
-
-    // mixed specific heat constant volume
-    PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
-    PetscReal w2 = Y2 / PetscSqr(rho2 * at2);
-    PetscReal cv_mix = Y1 * cv1 + Y2 * cv2 + (w1 * w2) / (w1 + w2) * PetscSqr(cv1 * (gamma1 - 1) * rho1 - cv2 * (gamma2 - 1) * rho2) * T;
-    // mixed isothermal sound speed
-    PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
-    PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
-    // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
+    *a = SpeedOfSoundGasLiquid(decodeIn, decodeOut, T);
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionLiquidLiquid(const PetscReal *conserved, PetscReal *a, void *ctx) {
+PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionLiquidLiquid(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
     PetscFunctionBeginUser;
-    // isentropic sound speed a_mix
+    // same as speedOfSoundFunction, isentropic sound speed a_mix at the supplied temperature
     auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
+    DecodeOut decodeOut;
+    SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
+    *a = SpeedOfSoundLiquidLiquid(decodeIn, decodeOut, T);
+    PetscFunctionReturn(0);
+}
 
-    // get kinetic energy for internal energy calculation
+ablate::eos::TwoPhase::DecodeIn ablate::eos::TwoPhase::CreateDecodeIn(const PetscReal *conserved, const FunctionContext &functionContext) {
+    // get the velocity for kinetic energy
+    PetscReal density = conserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
     PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+    for (PetscInt d = 0; d < functionContext.dim; d++) {
+        ke += PetscSqr(conserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
     }
     ke *= 0.5;
 
     // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
-    DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
-
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
-
-    SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
-    cv1 = functionContext->parameters.Cp1 / functionContext->parameters.gamma1;
-    cv2 = functionContext->parameters.Cp2 / functionContext->parameters.gamma2;
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) / functionContext->parameters.gamma1 * functionContext->parameters.Cp1 * decodeOut.T);  // stiffened gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) / functionContext->parameters.gamma2 * functionContext->parameters.Cp2 * decodeOut.T);  // stiffened gas eos
+    PetscReal internalEnergy = conserved[functionContext.eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
+    return DecodeIn{.alpha = conserved[functionContext.volumeFractionOffset],
+                    .alphaRho1 = conserved[functionContext.densityVFOffset],
+                    .rho = density,
+                    .e = internalEnergy,
+                    .parameters = &functionContext.parameters};
+}
 
+PetscReal ablate::eos::TwoPhase::MixtureSpeedOfSound(const DecodeIn &decodeIn, const DecodeOut &decodeOut, PetscReal T, PetscReal cv1, PetscReal cv2, PetscReal at1, PetscReal at2) {
+    PetscReal density = decodeIn.rho;
     PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;
-    PetscReal T = decodeOut.T;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
+    PetscReal rho2 = decodeOut.rho2;  // [rho1, rho2, e1, e2, p, T]
+    PetscReal gamma1 = decodeIn.parameters->gamma1;
+    PetscReal gamma2 = decodeIn.parameters->gamma2;
+    PetscReal Y1 = decodeIn.alphaRho1 / density;
+    PetscReal Y2 = (density - decodeIn.alphaRho1) / density;
 
     // mixed specific heat constant volume
     PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
@@ -1583,158 +1546,79 @@ PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundFunctionLiquidLiquid(const Pet
     PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
     PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
     // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
-    PetscFunctionReturn(0);
+    return PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
 }
-PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionGasGas(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
-    PetscFunctionBeginUser;
-    // same as speedOfSoundFunction, isentropic sound speed a_mix
-    auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-
-    // get kinetic energy for internal energy calculation
-    PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-    }
-    ke *= 0.5;
 
-    // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
-    DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
+PetscReal ablate::eos::TwoPhase::SpeedOfSoundGasGas(const DecodeIn &decodeIn, const DecodeOut &decodeOut, PetscReal T) {
+    const auto &parameters = *decodeIn.parameters;
+    // isothermal sound speeds
+    PetscReal cv1 = parameters.rGas1 / (parameters.gamma1 - 1);
+    PetscReal cv2 = parameters.rGas2 / (parameters.gamma2 - 1);
+    PetscReal at1 = PetscSqrtReal((parameters.gamma1 - 1) * cv1 * T);  // ideal gas eos
+    PetscReal at2 = PetscSqrtReal((parameters.gamma2 - 1) * cv2 * T);  // ideal gas eos
+    return MixtureSpeedOfSound(decodeIn, decodeOut, T, cv1, cv2, at1, at2);
+}
 
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
+PetscReal ablate::eos::TwoPhase::SpeedOfSoundGasLiquid(const DecodeIn &decodeIn, const DecodeOut &decodeOut, PetscReal T) {
+    const auto &parameters = *decodeIn.parameters;
+    // isothermal sound speeds
+    PetscReal cv1 = parameters.rGas1 / (parameters.gamma1 - 1);
+    PetscReal cv2 = parameters.Cp2 / parameters.gamma2;
+    PetscReal at1 = PetscSqrtReal((parameters.gamma1 - 1) * cv1 * T);                                 // ideal gas eos
+    PetscReal at2 = PetscSqrtReal((parameters.gamma2 - 1) / parameters.gamma2 * parameters.Cp2 * T);  // stiffened gas eos
+    return MixtureSpeedOfSound(decodeIn, decodeOut, T, cv1, cv2, at1, at2);
+}
 
-    SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
+PetscReal ablate::eos::TwoPhase::SpeedOfSoundLiquidLiquid(const DecodeIn &decodeIn, const DecodeOut &decodeOut, PetscReal T) {
+    const auto &parameters = *decodeIn.parameters;
     // isothermal sound speeds
-    cv1 = functionContext->parameters.rGas1 / (functionContext->parameters.gamma1 - 1);
-    cv2 = functionContext->parameters.rGas2 / (functionContext->parameters.gamma2 - 1);
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) * cv1 * T);  // ideal gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) * cv2 * T);  // ideal gas eos
+    PetscReal cv1 = parameters.Cp1 / parameters.gamma1;
+    PetscReal cv2 = parameters.Cp2 / parameters.gamma2;
+    PetscReal at1 = PetscSqrtReal((parameters.gamma1 - 1) / parameters.gamma1 * parameters.Cp1 * T);  // stiffened gas eos
+    PetscReal at2 = PetscSqrtReal((parameters.gamma2 - 1) / parameters.gamma2 * parameters.Cp2 * T);  // stiffened gas eos
+    return MixtureSpeedOfSound(decodeIn, decodeOut, T, cv1, cv2, at1, at2);
+}
 
-    PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
+void ablate::eos::TwoPhase::FillDecodedState(const DecodeIn &decodeIn, const DecodeOut &decodeOut, PetscReal speedOfSound, DecodedState *state) {
+    state->density = decodeIn.rho;
+    state->internalEnergy = decodeIn.e;
+    state->alpha = decodeIn.alpha;
+    state->rho1 = decodeOut.rho1;
+    state->rho2 = decodeOut.rho2;
+    state->e1 = decodeOut.e1;
+    state->e2 = decodeOut.e2;
+    state->p = decodeOut.p;
+    state->T = decodeOut.T;
+    state->speedOfSound = speedOfSound;
+}
 
-    // mixed specific heat constant volume
-    PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
-    PetscReal w2 = Y2 / PetscSqr(rho2 * at2);
-    PetscReal cv_mix = Y1 * cv1 + Y2 * cv2 + (w1 * w2) / (w1 + w2) * PetscSqr(cv1 * (gamma1 - 1) * rho1 - cv2 * (gamma2 - 1) * rho2) * T;
-    // mixed isothermal sound speed
-    PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
-    PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
-    // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
+PetscErrorCode ablate::eos::TwoPhase::DecodeStateFunctionGasGas(const PetscReal *conserved, DecodedState *state, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
+    DecodeOut decodeOut;
+    SimpleGasGasDecode(functionContext->dim, &decodeIn, &decodeOut);
+    FillDecodedState(decodeIn, decodeOut, SpeedOfSoundGasGas(decodeIn, decodeOut, decodeOut.T), state);
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionGasLiquid(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
+
+PetscErrorCode ablate::eos::TwoPhase::DecodeStateFunctionGasLiquid(const PetscReal *conserved, DecodedState *state, void *ctx) {
     PetscFunctionBeginUser;
-    // same as speedOfSoundFunction, isentropic sound speed a_mix
     auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-
-    // get kinetic energy for internal energy calculation
-    PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-    }
-    ke *= 0.5;
-
-    // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
     DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
-
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
-
     SimpleGasStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
-    cv1 = functionContext->parameters.rGas1 / (functionContext->parameters.gamma1 - 1);
-    cv2 = functionContext->parameters.Cp2 / functionContext->parameters.gamma2;
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) * cv1 * T);                                                                   // ideal gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) / functionContext->parameters.gamma2 * functionContext->parameters.Cp2 * T);  // stiffened gas eos
-
-    PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
-
-    // mixed specific heat constant volume
-    PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
-    PetscReal w2 = Y2 / PetscSqr(rho2 * at2);
-    PetscReal cv_mix = Y1 * cv1 + Y2 * cv2 + (w1 * w2) / (w1 + w2) * PetscSqr(cv1 * (gamma1 - 1) * rho1 - cv2 * (gamma2 - 1) * rho2) * T;
-    // mixed isothermal sound speed
-    PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
-    PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
-    // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
+    FillDecodedState(decodeIn, decodeOut, SpeedOfSoundGasLiquid(decodeIn, decodeOut, decodeOut.T), state);
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::eos::TwoPhase::SpeedOfSoundTemperatureFunctionLiquidLiquid(const PetscReal *conserved, PetscReal T, PetscReal *a, void *ctx) {
+
+PetscErrorCode ablate::eos::TwoPhase::DecodeStateFunctionLiquidLiquid(const PetscReal *conserved, DecodedState *state, void *ctx) {
     PetscFunctionBeginUser;
-    // same as speedOfSoundFunction, isentropic sound speed a_mix
     auto functionContext = (FunctionContext *)ctx;
-    PetscReal density = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-
-    // get kinetic energy for internal energy calculation
-    PetscReal ke = 0.0;
-    for (PetscInt d = 0; d < functionContext->dim; d++) {
-        ke += PetscSqr(conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-    }
-    ke *= 0.5;
-
-    // compute internal energy
-    PetscReal internalEnergy = conserved[functionContext->eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
-    // simple decode to compute pressure
+    DecodeIn decodeIn = CreateDecodeIn(conserved, *functionContext);
     DecodeOut decodeOut;
-    DecodeIn decodeIn;
-    decodeIn.alpha = conserved[functionContext->volumeFractionOffset];
-    decodeIn.alphaRho1 = conserved[functionContext->densityVFOffset];
-    decodeIn.rho = density;
-    decodeIn.e = internalEnergy;
-    decodeIn.parameters = functionContext->parameters;
-
-    PetscReal cv1, cv2, at1, at2;  // initialize variables for at_mix
-
     SimpleStiffStiffDecode(functionContext->dim, &decodeIn, &decodeOut);
-    cv1 = functionContext->parameters.Cp1 / functionContext->parameters.gamma1;
-    cv2 = functionContext->parameters.Cp2 / functionContext->parameters.gamma2;
-    at1 = PetscSqrtReal((functionContext->parameters.gamma1 - 1) / functionContext->parameters.gamma1 * functionContext->parameters.Cp1 * T);  // stiffened gas eos
-    at2 = PetscSqrtReal((functionContext->parameters.gamma2 - 1) / functionContext->parameters.gamma2 * functionContext->parameters.Cp2 * T);  // stiffened gas eos
-
-    PetscReal rho1 = decodeOut.rho1;
-    PetscReal rho2 = decodeOut.rho2;  // [rho1, rho2, e1, e2, p, T]
-    PetscReal gamma1 = functionContext->parameters.gamma1;
-    PetscReal gamma2 = functionContext->parameters.gamma2;
-    PetscReal Y1 = conserved[functionContext->densityVFOffset] / density;
-    PetscReal Y2 = (density - conserved[functionContext->densityVFOffset]) / density;
-
-    // mixed specific heat constant volume
-    PetscReal w1 = Y1 / PetscSqr(rho1 * at1);
-    PetscReal w2 = Y2 / PetscSqr(rho2 * at2);
-    PetscReal cv_mix = Y1 * cv1 + Y2 * cv2 + (w1 * w2) / (w1 + w2) * PetscSqr(cv1 * (gamma1 - 1) * rho1 - cv2 * (gamma2 - 1) * rho2) * T;
-    // mixed isothermal sound speed
-    PetscReal at_mix = PetscSqrtReal(1 / (w1 + w2)) / density;
-    PetscReal Gamma = (w1 * cv1 * (gamma1 - 1) * rho1 + w2 * cv2 * (gamma2 - 1) * rho2) / ((w1 + w2) * cv_mix * density);
-    // mixed isentropic sound speed
-    *a = PetscSqrtReal(PetscSqr(at_mix) + PetscSqr(Gamma) * cv_mix * T);
+    FillDecodedState(decodeIn, decodeOut, SpeedOfSoundLiquidLiquid(decodeIn, decodeOut, decodeOut.T), state);
     PetscFunctionReturn(0);
 }
 
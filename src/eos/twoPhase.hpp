@@ -46,7 +46,7 @@ class TwoPhase : public EOS {  // , public std::enabled_shared_from_this<TwoPhas
         PetscReal alphaRho1;
         PetscReal rho;
         PetscReal e;
-        Parameters parameters;
+        const Parameters* parameters;
     };
     struct DecodeOut {
         PetscReal rho1;
@@ -57,7 +57,46 @@ class TwoPhase : public EOS {  // , public std::enabled_shared_from_this<TwoPhas
         PetscReal T;
     };
 
+    /**
+     * All of the mixture quantities computed from a single decode of the conserved state
+     */
+    struct DecodedState {
+        PetscReal density;
+        PetscReal internalEnergy;
+        PetscReal alpha;
+        PetscReal rho1;
+        PetscReal rho2;
+        PetscReal e1;
+        PetscReal e2;
+        PetscReal p;
+        PetscReal T;
+        PetscReal speedOfSound;
+    };
+
+    /**
+     * Simple struct representing the context and function for decoding all mixture quantities at once
+     */
+    struct DecodeStateFunction {
+        //! function to be called
+        PetscErrorCode (*function)(const PetscReal conserved[], DecodedState* state, void* ctx) = nullptr;
+        //! optional context to pass into the function
+        std::shared_ptr<void> context = nullptr;
+    };
+
    private:
+    // shared helpers for the decode
+    static DecodeIn CreateDecodeIn(const PetscReal conserved[], const FunctionContext& functionContext);
+    static PetscReal MixtureSpeedOfSound(const DecodeIn& decodeIn, const DecodeOut& decodeOut, PetscReal T, PetscReal cv1, PetscReal cv2, PetscReal at1, PetscReal at2);
+    static PetscReal SpeedOfSoundGasGas(const DecodeIn& decodeIn, const DecodeOut& decodeOut, PetscReal T);
+    static PetscReal SpeedOfSoundGasLiquid(const DecodeIn& decodeIn, const DecodeOut& decodeOut, PetscReal T);
+    static PetscReal SpeedOfSoundLiquidLiquid(const DecodeIn& decodeIn, const DecodeOut& decodeOut, PetscReal T);
+    static void FillDecodedState(const DecodeIn& decodeIn, const DecodeOut& decodeOut, PetscReal speedOfSound, DecodedState* state);
+
+    // decode all functions
+    static PetscErrorCode DecodeStateFunctionGasGas(const PetscReal conserved[], DecodedState* state, void* ctx);
+    static PetscErrorCode DecodeStateFunctionGasLiquid(const PetscReal conserved[], DecodedState* state, void* ctx);
+    static PetscErrorCode DecodeStateFunctionLiquidLiquid(const PetscReal conserved[], DecodedState* state, void* ctx);
+
     // functions for all cases
     static PetscErrorCode DensityFunction(const PetscReal conserved[], PetscReal* property, void* ctx);
     static PetscErrorCode InternalSensibleEnergyFunction(const PetscReal conserved[], PetscReal* property, void* ctx);
@@ -164,6 +203,14 @@ class TwoPhase : public EOS {  // , public std::enabled_shared_from_this<TwoPhas
 
     ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Produces a function that decodes the mixture once and returns all of the decoded quantities.  This should be used instead of the individual property functions when more than one
+     * property is needed for the same state.
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] DecodeStateFunction GetDecodeStateFunction(const std::vector<domain::Field>& fields) const;
+
     EOSFunction GetFieldFunctionFunction(const std::string& field, ThermodynamicProperty property1, ThermodynamicProperty property2, std::vector<std::string> otherProperties) const override;
     const std::vector<std::string>& GetFieldFunctionProperties() const override { return otherPropertiesList; }  // list of other properties i.e. VF;
 
@@ -1,9 +1,11 @@
 #include "cellInterpolant.hpp"
 #include <petsc/private/dmpleximpl.h>
+#include <functional>
 #include <utility>
 
-ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomainIn, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec)
-    : subDomain(std::move(std::move(subDomainIn))) {
+ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomainIn, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec,
+                                                       bool overlapGradientCommunication)
+    : subDomain(std::move(std::move(subDomainIn))), overlapGradientCommunication(overlapGradientCommunication) {
     auto getGradientDm = [this, solverRegion, faceGeomVec, cellGeomVec](const domain::Field& fieldInfo, std::vector<DM>& gradDMs) {
         auto petscField = subDomain->GetPetscFieldObject(fieldInfo);
         auto petscFieldFV = (PetscFV)petscField;
@@ -86,20 +88,55 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
 
     // there must be a separate gradient vector/dm for field because they can be different sizes
     std::vector<Vec> locGradVecs(nf, nullptr);
+    std::vector<Vec> globGradVecs(nf, nullptr);
+
+    // The face connectivity only depends upon the mesh, so only compute it when the dm, aux dm, or face range changes
+    PetscObjectId dmId, auxDmId = -1;
+    PetscObjectState dmState, auxDmState = -1;
+    PetscObjectGetId((PetscObject)dm, &dmId) >> utilities::PetscUtilities::checkError;
+    PetscObjectStateGet((PetscObject)dm, &dmState) >> utilities::PetscUtilities::checkError;
+    if (dmAux) {
+        PetscObjectGetId((PetscObject)dmAux, &auxDmId) >> utilities::PetscUtilities::checkError;
+        PetscObjectStateGet((PetscObject)dmAux, &auxDmState) >> utilities::PetscUtilities::checkError;
+    }
+    if (faceConnectivityDmId != dmId || faceConnectivityDmState != dmState || faceConnectivityAuxDmId != auxDmId || faceConnectivityAuxDmState != auxDmState ||
+        faceConnectivityStart != faceRange.start || faceConnectivityEnd != faceRange.end) {
+        BuildFaceConnectivity(faceRange, faceDM, cellDM, solverRegion);
+        faceConnectivityDmId = dmId;
+        faceConnectivityDmState = dmState;
+        faceConnectivityAuxDmId = auxDmId;
+        faceConnectivityAuxDmState = auxDmState;
+        faceConnectivityStart = faceRange.start;
+        faceConnectivityEnd = faceRange.end;
+    }
 
     /* Reconstruct and limit cell gradients */
-    // for each field compute the gradient in the localGrads vector
+    // for each field compute the gradient in the global gradient vector and start the communication to the localGrads vector
     for (const auto& field : subDomain->GetFields()) {
-        ComputeFieldGradients(field, locXVec, locGradVecs[field.subId], gradientCellDms[field.subId], cellGeomVec, faceGeomVec, faceRange, cellRange);
+        ComputeFieldGradients(field, locXVec, locGradVecs[field.subId], globGradVecs[field.subId], gradientCellDms[field.subId], cellGeomVec, faceGeomVec, faceRange, cellRange);
     }
 
-    std::vector<const PetscScalar*> locGradArrays(nf, nullptr);
+    // the owned gradients are complete in the global vector and can be used while the gradient communication is in flight
+    std::vector<const PetscScalar*> globGradArrays(nf, nullptr);
     for (const auto& field : subDomain->GetFields()) {
-        if (locGradVecs[field.subId]) {
-            VecGetArrayRead(locGradVecs[field.subId], &locGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
+        if (globGradVecs[field.subId]) {
+            VecGetArrayRead(globGradVecs[field.subId], &globGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
         }
     }
 
+    // finish the gradient communication, this is called after the flux is computed on the faces that only need owned gradients
+    std::vector<const PetscScalar*> locGradArrays(nf, nullptr);
+    auto completeGradientCommunication = [&]() {
+        for (const auto& field : subDomain->GetFields()) {
+            if (globGradVecs[field.subId]) {
+                VecRestoreArrayRead(globGradVecs[field.subId], &globGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
+                DMGlobalToLocalEnd(gradientCellDms[field.subId], globGradVecs[field.subId], INSERT_VALUES, locGradVecs[field.subId]) >> utilities::PetscUtilities::checkError;
+                DMRestoreGlobalVector(gradientCellDms[field.subId], &globGradVecs[field.subId]) >> utilities::PetscUtilities::checkError;
+                VecGetArrayRead(locGradVecs[field.subId], &locGradArrays[field.subId]) >> utilities::PetscUtilities::checkError;
+            }
+        }
+    };
+
     ComputeFluxSourceTerms(dm,
                            ds,
                            totDim,
@@ -113,7 +150,9 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
                            cellDM,
                            cellGeomArray,
                            gradientCellDms,
+                           globGradArrays,
                            locGradArrays,
+                           completeGradientCommunication,
                            locFArray,
                            solverRegion,
                            rhsFunctions,
@@ -272,6 +311,158 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
         VecRestoreArrayRead(locAuxVec, &auxArray) >> utilities::PetscUtilities::checkError;
     }
 
+    VecRestoreArray(locFVec, &locFArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(faceGeomVec, (const PetscScalar**)&faceGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(cellGeomVec, (const PetscScalar**)&cellGeomArray) >> utilities::PetscUtilities::checkError;
+}
+
+void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
+                                                       std::vector<CellInterpolant::PointFunctionDescription>& rhsFunctions, const ablate::domain::Range& cellRange, Vec cellGeomVec) {
+    auto dm = subDomain->GetDM();
+    auto dmAux = subDomain->GetAuxDM();
+
+    /* 1: Get sizes from dm and dmAux */
+    PetscSection section = nullptr;
+    DMGetLocalSection(dm, &section) >> utilities::PetscUtilities::checkError;
+
+    // Get the ds from he subDomain and required info
+    auto ds = subDomain->GetDiscreteSystem();
+    PetscInt nf, totDim;
+    PetscDSGetNumFields(ds, &nf) >> utilities::PetscUtilities::checkError;
+    PetscDSGetTotalDimension(ds, &totDim) >> utilities::PetscUtilities::checkError;
+
+    // Check to see if the dm has an auxVec/auxDM associated with it.  If it does, extract it
+    PetscDS dsAux = subDomain->GetAuxDiscreteSystem();
+    PetscInt naf = 0, totDimAux = 0;
+    if (locAuxVec) {
+        PetscDSGetTotalDimension(dsAux, &totDimAux) >> utilities::PetscUtilities::checkError;
+        PetscDSGetNumFields(dsAux, &naf) >> utilities::PetscUtilities::checkError;
+    }
+
+    // We can use a single call for the geometry data because it does not depend on the fv object
+    const PetscScalar* cellGeomArray = nullptr;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    DM cellDM;
+    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
+
+    // Get raw access to the computed values
+    const PetscScalar *xArray, *auxArray = nullptr;
+    VecGetArrayRead(locXVec, &xArray) >> utilities::PetscUtilities::checkError;
+    if (locAuxVec) {
+        VecGetArrayRead(locAuxVec, &auxArray) >> utilities::PetscUtilities::checkError;
+    }
+
+    // get raw access to the locF
+    PetscScalar* locFArray;
+    VecGetArray(locFVec, &locFArray) >> utilities::PetscUtilities::checkError;
+
+    // Compute the source terms from flux across the interface for cell based gradient functions
+    // Precompute the offsets to pass into the rhsFluxFunctionDescriptions
+    std::vector<std::vector<PetscInt>> fluxComponentSize(rhsFunctions.size());
+    std::vector<std::vector<PetscInt>> fluxComponentOffset(rhsFunctions.size());
+    std::vector<std::vector<PetscInt>> uOff(rhsFunctions.size());
+    std::vector<std::vector<PetscInt>> aOff(rhsFunctions.size());
+
+    // Get the full set of offsets from the ds
+    PetscInt* uOffTotal;
+    PetscDSGetComponentOffsets(ds, &uOffTotal) >> utilities::PetscUtilities::checkError;
+
+    for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+        for (std::size_t f = 0; f < rhsFunctions[fun].fields.size(); f++) {
+            const auto& field = subDomain->GetField(rhsFunctions[fun].fields[f]);
+
+            PetscInt fieldSize, fieldOffset;
+            PetscDSGetFieldSize(ds, field.subId, &fieldSize) >> utilities::PetscUtilities::checkError;
+            PetscDSGetFieldOffset(ds, field.subId, &fieldOffset) >> utilities::PetscUtilities::checkError;
+            fluxComponentSize[fun].push_back(fieldSize);
+            fluxComponentOffset[fun].push_back(fieldOffset);
+        }
+
+        for (std::size_t f = 0; f < rhsFunctions[fun].inputFields.size(); f++) {
+            uOff[fun].push_back(uOffTotal[rhsFunctions[fun].inputFields[f]]);
+        }
+    }
+
+    if (dsAux) {
+        PetscInt* auxOffTotal;
+        PetscDSGetComponentOffsets(dsAux, &auxOffTotal) >> utilities::PetscUtilities::checkError;
+        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+            for (std::size_t f = 0; f < rhsFunctions[fun].auxFields.size(); f++) {
+                aOff[fun].push_back(auxOffTotal[rhsFunctions[fun].auxFields[f]]);
+            }
+        }
+    }
+
+    // check to see if there is a ghost label
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
+
+    PetscInt dim = subDomain->GetDimensions();
+
+    // compute and add the point functions for a single cell using the supplied scratch space
+    auto computeCellSource = [&](const PetscFVCellGeom* cg, const PetscScalar* u, const PetscScalar* a, PetscScalar* rhs, PetscScalar* fScratch) {
+        // March over each functionDescriptions
+        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+            rhsFunctions[fun].function(dim, time, cg, uOff[fun].data(), u, aOff[fun].data(), a, fScratch, rhsFunctions[fun].context) >> utilities::PetscUtilities::checkError;
+
+            // copy over each result flux field
+            PetscInt r = 0;
+            for (std::size_t ff = 0; ff < rhsFunctions[fun].fields.size(); ff++) {
+                for (PetscInt d = 0; d < fluxComponentSize[fun][ff]; ++d) {
+                    rhs[fluxComponentOffset[fun][ff] + d] += fScratch[r++];
+                }
+            }
+        }
+    };
+
+    // extract the point locations for each cell that is not a ghost cell
+    struct CellPointers {
+        const PetscFVCellGeom* cg;
+        const PetscScalar* u;
+        const PetscScalar* a;
+        PetscScalar* rhs;
+    };
+    std::vector<CellPointers> cellPointers;
+    cellPointers.reserve(cellRange.end - cellRange.start);
+
+    // March over each cell
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        // if there is a cell array, use it, otherwise it is just c
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+        // make sure that this is not a ghost cell
+        if (ghostLabel) {
+            PetscInt ghostVal;
+
+            DMLabelGetValue(ghostLabel, cell, &ghostVal) >> utilities::PetscUtilities::checkError;
+            if (ghostVal > 0) continue;
+        }
+
+        // extract the point locations for this cell
+        CellPointers pointers{.cg = nullptr, .u = nullptr, .a = nullptr, .rhs = nullptr};
+        DMPlexPointLocalRead(cellDM, cell, cellGeomArray, &pointers.cg) >> utilities::PetscUtilities::checkError;
+        DMPlexPointLocalRead(dm, cell, xArray, &pointers.u) >> utilities::PetscUtilities::checkError;
+        DMPlexPointLocalRef(dm, cell, locFArray, &pointers.rhs) >> utilities::PetscUtilities::checkError;
+
+        // if there is an aux field, get it
+        if (auxArray) {
+            DMPlexPointLocalRead(dmAux, cell, auxArray, &pointers.a) >> utilities::PetscUtilities::checkError;
+        }
+        cellPointers.push_back(pointers);
+    }
+
+    // Size up a scratch variable
+    std::vector<PetscScalar> fScratch(totDim);
+    for (const auto& pointers : cellPointers) {
+        computeCellSource(pointers.cg, pointers.u, pointers.a, pointers.rhs, fScratch.data());
+    }
+
+    // cleanup (restore access to locGradVecs, locAuxGradVecs with DMRestoreLocalVector)
+    VecRestoreArrayRead(locXVec, &xArray) >> utilities::PetscUtilities::checkError;
+    if (locAuxVec) {
+        VecRestoreArrayRead(locAuxVec, &auxArray) >> utilities::PetscUtilities::checkError;
+    }
+
     VecRestoreArray(locFVec, &locFArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
 }
@@ -324,7 +515,7 @@ static PetscErrorCode DMPlexApplyLimiter_Internal(DM dm, DM dmCell, PetscLimiter
     PetscFunctionReturn(0);
 }
 
-void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec,
+void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, Vec& gradGlobVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec,
                                                                   const ablate::domain::Range& faceRange, const ablate::domain::Range& cellRange) {
     // get the FVM petsc field associated with this field
     auto fvm = (PetscFV)subDomain->GetPetscFieldObject(field);
@@ -340,18 +531,11 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
     DMGetLocalVector(dmGrad, &gradLocVec) >> utilities::PetscUtilities::checkError;
 
     // Get the correct sized vec (gradient for this field)
-    Vec gradGlobVec;
     DMGetGlobalVector(dmGrad, &gradGlobVec) >> utilities::PetscUtilities::checkError;
     VecZeroEntries(gradGlobVec) >> utilities::PetscUtilities::checkError;
 
-    // check to see if there is a ghost label
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
-
     // Get the face geometry
-    DM dmFace;
     const PetscScalar* faceGeometryArray;
-    VecGetDM(faceGeomVec, &dmFace) >> utilities::PetscUtilities::checkError;
     VecGetArrayRead(faceGeomVec, &faceGeometryArray);
 
     // extract the local x array
@@ -366,38 +550,18 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
     PetscInt dim = subDomain->GetDimensions();
     PetscInt dof = field.numberComponents;
 
-    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
-        PetscInt face = faceRange.points ? faceRange.points[f] : f;
-
+    for (const auto& connectivity : faceConnectivity) {
         // make sure that this is a face we should use
-        PetscBool boundary;
-        PetscInt ghost = -1;
-        if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, face, &ghost);
-        }
-        DMIsBoundaryPoint(dm, face, &boundary);
-        PetscInt numChildren;
-        DMPlexGetTreeChildren(dm, face, &numChildren, nullptr);
-        if (ghost >= 0 || boundary || numChildren) continue;
-
-        // Do a sanity check on the number of cells connected to this face
-        PetscInt numCells;
-        DMPlexGetSupportSize(dm, face, &numCells);
-        if (numCells != 2) {
-            throw std::runtime_error("face " + std::to_string(face) + " has " + std::to_string(numCells) + " support points (cells): expected 2");
-        }
+        if (!(connectivity.flags & GradientFace)) continue;
 
         // add in the contributions from this face
-        const PetscInt* cells;
-        PetscFVFaceGeom* fg;
+        auto fg = (const PetscFVFaceGeom*)(faceGeometryArray + connectivity.faceGeomOffset);
         PetscScalar* cx[2];
         PetscScalar* cgrad[2];
 
-        DMPlexGetSupport(dm, face, &cells);
-        DMPlexPointLocalRead(dmFace, face, faceGeometryArray, &fg);
         for (PetscInt c = 0; c < 2; ++c) {
-            DMPlexPointLocalFieldRead(dm, cells[c], field.id, xLocalArray, &cx[c]) >> utilities::PetscUtilities::checkError;
-            DMPlexPointGlobalRef(dmGrad, cells[c], gradGlobArray, &cgrad[c]) >> utilities::PetscUtilities::checkError;
+            DMPlexPointLocalFieldRead(dm, connectivity.cells[c], field.id, xLocalArray, &cx[c]) >> utilities::PetscUtilities::checkError;
+            DMPlexPointGlobalRef(dmGrad, connectivity.cells[c], gradGlobArray, &cgrad[c]) >> utilities::PetscUtilities::checkError;
         }
         for (PetscInt pd = 0; pd < dof; ++pd) {
             PetscScalar delta = cx[1][pd] - cx[0][pd];
@@ -464,20 +628,20 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
         DMRestoreWorkArray(dm, dof, MPIU_REAL, &cellPhi) >> utilities::PetscUtilities::checkError;
         VecRestoreArrayRead(cellGeomVec, &cellGeometryArray);
     }
-    // Communicate gradient values
+    // Start communicating the gradient values, the caller is responsible for ending the communication and restoring the gradGlobVec
     VecRestoreArray(gradGlobVec, &gradGlobArray) >> utilities::PetscUtilities::checkError;
     DMGlobalToLocalBegin(dmGrad, gradGlobVec, INSERT_VALUES, gradLocVec) >> utilities::PetscUtilities::checkError;
-    DMGlobalToLocalEnd(dmGrad, gradGlobVec, INSERT_VALUES, gradLocVec) >> utilities::PetscUtilities::checkError;
 
     // cleanup
     VecRestoreArrayRead(xLocalVec, &xLocalArray) >> utilities::PetscUtilities::checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeometryArray) >> utilities::PetscUtilities::checkError;
-    DMRestoreGlobalVector(dmGrad, &gradGlobVec) >> utilities::PetscUtilities::checkError;
 }
 
 void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux,
                                                                    const PetscScalar* auxArray, DM faceDM, const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray,
-                                                                   std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays, PetscScalar* locFArray,
+                                                                   std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& globGradArrays,
+                                                                   const std::vector<const PetscScalar*>& locGradArrays, const std::function<void()>& completeGradientCommunication,
+                                                                   PetscScalar* locFArray,
                                                                    const std::shared_ptr<domain::Region>& solverRegion,
                                                                    std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const ablate::domain::Range& faceRange,
                                                                    const ablate::domain::Range& cellRange) {
@@ -496,11 +660,11 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
     DMGetWorkArray(dm, dim * totDim, MPIU_SCALAR, &gradR) >> utilities::PetscUtilities::checkError;
 
     // size up the aux variables
-    PetscScalar *auxL = nullptr, *auxR = nullptr;
+    const PetscScalar *auxL = nullptr, *auxR = nullptr;
 
     // Precompute the offsets to pass into the rhsFluxFunctionDescriptions
     std::vector<PetscInt> fluxComponentSize(rhsFunctions.size());
-    std::vector<PetscInt> fluxId(rhsFunctions.size());
+    std::vector<PetscInt> fluxSubId(rhsFunctions.size());
     std::vector<std::vector<PetscInt>> uOff(rhsFunctions.size());
     std::vector<std::vector<PetscInt>> aOff(rhsFunctions.size());
 
@@ -511,7 +675,7 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
     for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
         const auto& field = subDomain->GetField(rhsFunctions[fun].field);
         fluxComponentSize[fun] = field.numberComponents;
-        fluxId[fun] = field.id;
+        fluxSubId[fun] = field.subId;
         for (std::size_t f = 0; f < rhsFunctions[fun].inputFields.size(); f++) {
             uOff[fun].push_back(uOffTotal[rhsFunctions[fun].inputFields[f]]);
         }
@@ -526,81 +690,58 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
             }
         }
     }
-    // check for ghost cells
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
-
-    // get the label for this region
-    DMLabel regionLabel = nullptr;
-    PetscInt regionValue = 0;
-    domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
-
-    // March over each face in this region
-    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
-        const PetscInt face = faceRange.points ? faceRange.points[f] : f;
-
-        // make sure that this is a valid face
-        PetscInt ghost, nsupp, nchild;
-        DMLabelGetValue(ghostLabel, face, &ghost) >> utilities::PetscUtilities::checkError;
-        DMPlexGetSupportSize(dm, face, &nsupp) >> utilities::PetscUtilities::checkError;
-        DMPlexGetTreeChildren(dm, face, &nchild, nullptr) >> utilities::PetscUtilities::checkError;
-        if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
-
-        // Get the face geometry
-        const PetscInt* faceCells;
-        PetscFVFaceGeom* fg;
-        PetscFVCellGeom *cgL, *cgR;
-        DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> utilities::PetscUtilities::checkError;
-        DMPlexGetSupport(dm, face, &faceCells) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[0], cellGeomArray, &cgL) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[1], cellGeomArray, &cgR) >> utilities::PetscUtilities::checkError;
-
-        PetscInt leftFlowLabelValue = regionValue;
-        PetscInt rightFlowLabelValue = regionValue;
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[0], &leftFlowLabelValue);
-            DMLabelGetValue(regionLabel, faceCells[1], &rightFlowLabelValue);
-        }
-        // compute the left/right face values
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[0], *cgL, dm, xArray, dmGrads, locGradArrays, uL, gradL, leftFlowLabelValue == regionValue);
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[1], *cgR, dm, xArray, dmGrads, locGradArrays, uR, gradR, rightFlowLabelValue == regionValue);
 
-        // determine the left/right cells
-        if (auxArray) {
-            // Get the field values at this cell
-            DMPlexPointLocalRead(dmAux, faceCells[0], auxArray, &auxL) >> utilities::PetscUtilities::checkError;
-            DMPlexPointLocalRead(dmAux, faceCells[1], auxArray, &auxR) >> utilities::PetscUtilities::checkError;
+    // compute the faces that only need owned gradients, then complete the gradient communication and compute the remaining faces
+    const auto& fields = subDomain->GetFields();
+    const auto nf = (PetscInt)fields.size();
+    for (auto gradientCommunicationComplete : {false, true}) {
+        if (gradientCommunicationComplete) {
+            completeGradientCommunication();
         }
-
-        // March over each source function
-        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
-            PetscArrayzero(flux, totDim) >> utilities::PetscUtilities::checkError;
-            const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
-            rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux, rhsFluxFunctionDescription.context) >> utilities::PetscUtilities::checkError;
-
-            // add the flux back to the cell
-            PetscScalar *fL = nullptr, *fR = nullptr;
-            PetscInt cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[0], &ghost) >> utilities::PetscUtilities::checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[0], &cellLabelValue) >> utilities::PetscUtilities::checkError;
-            }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[0], fluxId[fun], locFArray, &fL) >> utilities::PetscUtilities::checkError;
+        const auto& gradArrays = gradientCommunicationComplete ? locGradArrays : globGradArrays;
+        const auto& gradientOffsets = gradientCommunicationComplete ? faceGradientOffsets : faceGlobalGradientOffsets;
+
+        // March over each face in this region
+        for (std::size_t i = 0; i < faceConnectivity.size(); ++i) {
+            const auto& connectivity = faceConnectivity[i];
+
+            // make sure that this is a valid face for this phase, before the gradient communication is complete only the faces that need owned gradients can be computed
+            if (!(connectivity.flags & FluxFace)) continue;
+            const bool ownedGradientFace = overlapGradientCommunication && (connectivity.flags & OwnedGradientFace);
+            if (gradientCommunicationComplete == ownedGradientFace) continue;
+
+            // Get the face geometry
+            auto fg = (const PetscFVFaceGeom*)(faceGeomArray + connectivity.faceGeomOffset);
+            auto cgL = (const PetscFVCellGeom*)(cellGeomArray + connectivity.cellGeomOffsets[0]);
+            auto cgR = (const PetscFVCellGeom*)(cellGeomArray + connectivity.cellGeomOffsets[1]);
+            const PetscInt leftOffset = (PetscInt)(2 * i) * nf;
+            const PetscInt rightOffset = (PetscInt)(2 * i + 1) * nf;
+
+            // compute the left/right face values
+            ProjectToFace(fields, ds, *fg, *cgL, xArray, &faceFieldOffsets[leftOffset], gradArrays, &gradientOffsets[leftOffset], uL, gradL, connectivity.flags & ProjectLeft);
+            ProjectToFace(fields, ds, *fg, *cgR, xArray, &faceFieldOffsets[rightOffset], gradArrays, &gradientOffsets[rightOffset], uR, gradR, connectivity.flags & ProjectRight);
+
+            // determine the left/right cells
+            if (auxArray) {
+                // Get the field values at this cell
+                auxL = auxArray + connectivity.auxOffsets[0];
+                auxR = auxArray + connectivity.auxOffsets[1];
             }
 
-            cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[1], &ghost) >> utilities::PetscUtilities::checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[1], &cellLabelValue) >> utilities::PetscUtilities::checkError;
-            }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[1], fluxId[fun], locFArray, &fR) >> utilities::PetscUtilities::checkError;
-            }
+            // March over each source function
+            for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+                PetscArrayzero(flux, totDim) >> utilities::PetscUtilities::checkError;
+                const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
+                rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux, rhsFluxFunctionDescription.context) >> utilities::PetscUtilities::checkError;
 
-            for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
-                if (fL) fL[d] -= flux[d] / cgL->volume;
-                if (fR) fR[d] += flux[d] / cgR->volume;
+                // add the flux back to the cell
+                PetscScalar* fL = connectivity.flags & UpdateLeft ? locFArray + faceFluxOffsets[leftOffset + fluxSubId[fun]] : nullptr;
+                PetscScalar* fR = connectivity.flags & UpdateRight ? locFArray + faceFluxOffsets[rightOffset + fluxSubId[fun]] : nullptr;
+
+                for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
+                    if (fL) fL[d] -= flux[d] / cgL->volume;
+                    if (fR) fR[d] += flux[d] / cgR->volume;
+                }
             }
         }
     }
@@ -861,9 +1002,9 @@ PetscErrorCode ablate::finiteVolume::CellInterpolant::ComputeGradientFVM(DM dm,
     PetscCall(PetscSectionDestroy(&sectionGrad));
     PetscFunctionReturn(0);
 }
-void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, PetscInt cellId, const PetscFVCellGeom& cellGeom,
-                                                          DM dm, const PetscScalar* xArray, const std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& gradArrays, PetscScalar* u,
-                                                          PetscScalar* grad, bool projectField) {
+void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, const PetscFVCellGeom& cellGeom,
+                                                          const PetscScalar* xArray, const PetscInt* fieldOffsets, const std::vector<const PetscScalar*>& gradArrays, const PetscInt* gradientOffsets,
+                                                          PetscScalar* u, PetscScalar* grad, bool projectField) {
     const auto dim = subDomain->GetDimensions();
 
     // Keep track of derivative offset
@@ -875,15 +1016,13 @@ void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<doma
     // March over each field
     for (const auto& field : fields) {
         PetscReal dx[3];
-        PetscScalar* xCell;
-        PetscScalar* gradCell;
 
         // Get the field values at this cell
-        DMPlexPointLocalFieldRead(dm, cellId, field.subId, xArray, &xCell) >> utilities::PetscUtilities::checkError;
+        const PetscScalar* xCell = xArray + fieldOffsets[field.subId];
 
         // If we need to project the field
-        if (projectField && dmGrads[field.subId]) {
-            DMPlexPointLocalRead(dmGrads[field.subId], cellId, gradArrays[field.subId], &gradCell) >> utilities::PetscUtilities::checkError;
+        if (projectField && gradientOffsets[field.subId] >= 0) {
+            const PetscScalar* gradCell = gradArrays[field.subId] + gradientOffsets[field.subId];
             DMPlex_WaxpyD_Internal(dim, -1, cellGeom.centroid, faceGeom.centroid, dx);
 
             // Project the cell centered value onto the face
@@ -896,9 +1035,9 @@ void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<doma
                 }
             }
 
-        } else if (dmGrads[field.subId]) {
+        } else if (gradientOffsets[field.subId] >= 0) {
             // Project the cell centered value onto the face
-            DMPlexPointLocalRead(dmGrads[field.subId], cellId, gradArrays[field.subId], &gradCell) >> utilities::PetscUtilities::checkError;
+            const PetscScalar* gradCell = gradArrays[field.subId] + gradientOffsets[field.subId];
             // Project the cell centered value onto the face
             for (PetscInt c = 0; c < field.numberComponents; ++c) {
                 u[offsets[field.subId] + c] = xCell[c];
@@ -922,3 +1061,139 @@ void ablate::finiteVolume::CellInterpolant::ProjectToFace(const std::vector<doma
         }
     }
 }
+
+void ablate::finiteVolume::CellInterpolant::BuildFaceConnectivity(const ablate::domain::Range& faceRange, DM faceDM, DM cellDM, const std::shared_ptr<domain::Region>& solverRegion) {
+    DM dm = subDomain->GetDM();
+    DM dmAux = subDomain->GetAuxDM();
+    const auto& fields = subDomain->GetFields();
+    const auto nf = (PetscInt)fields.size();
+
+    // Get the sections used to compute the offsets into each local array
+    PetscSection section, faceSection, cellSection, auxSection = nullptr;
+    DMGetLocalSection(dm, &section) >> utilities::PetscUtilities::checkError;
+    DMGetLocalSection(faceDM, &faceSection) >> utilities::PetscUtilities::checkError;
+    DMGetLocalSection(cellDM, &cellSection) >> utilities::PetscUtilities::checkError;
+    if (dmAux) {
+        DMGetLocalSection(dmAux, &auxSection) >> utilities::PetscUtilities::checkError;
+    }
+    std::vector<PetscSection> gradientSections(nf, nullptr);
+    std::vector<PetscSection> globalGradientSections(nf, nullptr);
+    std::vector<PetscInt> globalGradientStarts(nf, 0);
+    for (const auto& field : fields) {
+        if (gradientCellDms[field.subId]) {
+            DMGetLocalSection(gradientCellDms[field.subId], &gradientSections[field.subId]) >> utilities::PetscUtilities::checkError;
+            DMGetGlobalSection(gradientCellDms[field.subId], &globalGradientSections[field.subId]) >> utilities::PetscUtilities::checkError;
+
+            // the global section offsets are relative to the start of this rank
+            Vec gradGlobVec;
+            DMGetGlobalVector(gradientCellDms[field.subId], &gradGlobVec) >> utilities::PetscUtilities::checkError;
+            VecGetOwnershipRange(gradGlobVec, &globalGradientStarts[field.subId], nullptr) >> utilities::PetscUtilities::checkError;
+            DMRestoreGlobalVector(gradientCellDms[field.subId], &gradGlobVec) >> utilities::PetscUtilities::checkError;
+        }
+    }
+
+    // check for ghost cells
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
+
+    // get the label for this region
+    DMLabel regionLabel = nullptr;
+    PetscInt regionValue = 0;
+    domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
+
+    faceConnectivity.clear();
+    faceFieldOffsets.clear();
+    faceFluxOffsets.clear();
+    faceGradientOffsets.clear();
+    faceGlobalGradientOffsets.clear();
+
+    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
+        const PetscInt face = faceRange.GetPoint(f);
+
+        // ghost faces are never used
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, face, &ghost) >> utilities::PetscUtilities::checkError;
+        }
+        if (ghost >= 0) continue;
+
+        PetscInt numberSupport, numberChildren;
+        PetscBool boundary;
+        DMPlexGetSupportSize(dm, face, &numberSupport) >> utilities::PetscUtilities::checkError;
+        DMPlexGetTreeChildren(dm, face, &numberChildren, nullptr) >> utilities::PetscUtilities::checkError;
+        DMIsBoundaryPoint(dm, face, &boundary) >> utilities::PetscUtilities::checkError;
+        if (numberChildren) continue;
+
+        PetscInt flags = 0;
+        if (numberSupport == 2) {
+            flags |= FluxFace;
+        }
+        if (!boundary) {
+            // Do a sanity check on the number of cells connected to this face
+            if (numberSupport != 2) {
+                throw std::runtime_error("face " + std::to_string(face) + " has " + std::to_string(numberSupport) + " support points (cells): expected 2");
+            }
+            flags |= GradientFace;
+        }
+        if (!flags) continue;
+
+        const PetscInt* cells;
+        DMPlexGetSupport(dm, face, &cells) >> utilities::PetscUtilities::checkError;
+
+        FaceConnectivity connectivity{.face = face, .cells = {cells[0], cells[1]}, .flags = flags, .faceGeomOffset = 0, .cellGeomOffsets = {0, 0}, .auxOffsets = {-1, -1}};
+        PetscSectionGetOffset(faceSection, face, &connectivity.faceGeomOffset) >> utilities::PetscUtilities::checkError;
+        bool ownedGradients = true;
+
+        for (PetscInt side = 0; side < 2; ++side) {
+            const PetscInt cell = cells[side];
+            PetscSectionGetOffset(cellSection, cell, &connectivity.cellGeomOffsets[side]) >> utilities::PetscUtilities::checkError;
+            if (auxSection) {
+                PetscSectionGetOffset(auxSection, cell, &connectivity.auxOffsets[side]) >> utilities::PetscUtilities::checkError;
+            }
+
+            // only project and update cells in this region
+            PetscInt cellLabelValue = regionValue;
+            if (regionLabel) {
+                DMLabelGetValue(regionLabel, cell, &cellLabelValue) >> utilities::PetscUtilities::checkError;
+            }
+            PetscInt cellGhost = -1;
+            if (ghostLabel) {
+                DMLabelGetValue(ghostLabel, cell, &cellGhost) >> utilities::PetscUtilities::checkError;
+            }
+            if (cellLabelValue == regionValue) {
+                connectivity.flags |= side == 0 ? ProjectLeft : ProjectRight;
+                if (cellGhost <= 0) {
+                    connectivity.flags |= side == 0 ? UpdateLeft : UpdateRight;
+                }
+            }
+
+            // store the offsets for each field
+            const auto sideOffset = (PetscInt)faceFieldOffsets.size();
+            faceFieldOffsets.resize(sideOffset + nf, 0);
+            faceFluxOffsets.resize(sideOffset + nf, 0);
+            faceGradientOffsets.resize(sideOffset + nf, -1);
+            faceGlobalGradientOffsets.resize(sideOffset + nf, -1);
+            for (const auto& field : fields) {
+                PetscSectionGetFieldOffset(section, cell, field.subId, &faceFieldOffsets[sideOffset + field.subId]) >> utilities::PetscUtilities::checkError;
+                PetscSectionGetFieldOffset(section, cell, field.id, &faceFluxOffsets[sideOffset + field.subId]) >> utilities::PetscUtilities::checkError;
+                if (gradientSections[field.subId]) {
+                    PetscSectionGetOffset(gradientSections[field.subId], cell, &faceGradientOffsets[sideOffset + field.subId]) >> utilities::PetscUtilities::checkError;
+
+                    // unowned cells have a negative global offset and must wait for the gradient communication
+                    PetscInt globalOffset;
+                    PetscSectionGetOffset(globalGradientSections[field.subId], cell, &globalOffset) >> utilities::PetscUtilities::checkError;
+                    if (globalOffset >= 0) {
+                        faceGlobalGradientOffsets[sideOffset + field.subId] = globalOffset - globalGradientStarts[field.subId];
+                    } else {
+                        ownedGradients = false;
+                    }
+                }
+            }
+        }
+        if (ownedGradients) {
+            connectivity.flags |= OwnedGradientFace;
+        }
+
+        faceConnectivity.push_back(connectivity);
+    }
+}
@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_CELLINTERPOLANT_HPP
 
 #include <petsc.h>
+#include <functional>
 #include <vector>
 #include "domain/range.hpp"
 #include "domain/region.hpp"
@@ -50,32 +51,99 @@ class CellInterpolant {
     //! store the dmGrad, these are specific to this finite volume solver
     std::vector<DM> gradientCellDms;
 
+    //! when true the faces that only need owned gradients are computed while the gradient communication is in flight
+    const bool overlapGradientCommunication;
+
+    /**
+     * Flags describing how each face and its neighboring cells are used
+     */
+    enum FaceFlags : PetscInt {
+        //! the face is used to compute the flux
+        FluxFace = 1 << 0,
+        //! the face is used to compute the cell gradients
+        GradientFace = 1 << 1,
+        //! the left/right cell value should be projected to the face
+        ProjectLeft = 1 << 2,
+        ProjectRight = 1 << 3,
+        //! the flux should be added to the left/right cell
+        UpdateLeft = 1 << 4,
+        UpdateRight = 1 << 5,
+        //! every gradient used by the face is owned by this rank, so the flux can be computed before the gradient communication is complete
+        OwnedGradientFace = 1 << 6
+    };
+
+    /**
+     * Precomputed connectivity for a single face.  The offsets are into the local arrays so no dm lookups are needed in the hot loops.
+     */
+    struct FaceConnectivity {
+        PetscInt face;
+        PetscInt cells[2];
+        PetscInt flags;
+        PetscInt faceGeomOffset;
+        PetscInt cellGeomOffsets[2];
+        PetscInt auxOffsets[2];
+    };
+
+    //! the dm, aux dm, and face range the connectivity was built for
+    PetscObjectId faceConnectivityDmId = -1;
+    PetscObjectState faceConnectivityDmState = -1;
+    PetscObjectId faceConnectivityAuxDmId = -1;
+    PetscObjectState faceConnectivityAuxDmState = -1;
+    PetscInt faceConnectivityStart = -1;
+    PetscInt faceConnectivityEnd = -1;
+
+    //! the connectivity for each flux or gradient face in the face range
+    std::vector<FaceConnectivity> faceConnectivity;
+
+    //! offsets to each field (by subId) in the local solution array for each side of each face, [face][side][field]
+    std::vector<PetscInt> faceFieldOffsets;
+
+    //! offsets to each field (by subId) in the local rhs array for each side of each face, [face][side][field]
+    std::vector<PetscInt> faceFluxOffsets;
+
+    //! offsets to each field gradient (by subId) in the local gradient arrays for each side of each face, -1 when there is no gradient, [face][side][field]
+    std::vector<PetscInt> faceGradientOffsets;
+
+    //! offsets to each field gradient (by subId) in the global gradient arrays for each side of each face, -1 when there is no gradient or the cell is not owned, [face][side][field]
+    std::vector<PetscInt> faceGlobalGradientOffsets;
+
+    /**
+     * Build the face connectivity table.  The mesh and geometry do not change between steps so this is only done when the dm or face range changes.
+     * @param faceRange
+     * @param faceDM
+     * @param cellDM
+     * @param solverRegion
+     */
+    void BuildFaceConnectivity(const ablate::domain::Range& faceRange, DM faceDM, DM cellDM, const std::shared_ptr<domain::Region>& solverRegion);
+
     /**
      * Function to compute the flux source terms
      */
     void ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux, const PetscScalar* auxArray, DM faceDM,
-                                const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray, std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays,
-                                PetscScalar* locFArray, const std::shared_ptr<domain::Region>& solverRegion, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                                const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray, std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& globGradArrays,
+                                const std::vector<const PetscScalar*>& locGradArrays, const std::function<void()>& completeGradientCommunication, PetscScalar* locFArray,
+                                const std::shared_ptr<domain::Region>& solverRegion, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
                                 const ablate::domain::Range& faceRange, const ablate::domain::Range& cellRange);
 
     /**
      * support call to project to a single face from a side
      */
-    void ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, PetscInt cellId, const PetscFVCellGeom& cellGeom, DM dm, const PetscScalar* xArray,
-                       const std::vector<DM>& dmGrads, const std::vector<const PetscScalar*>& gradArrays, PetscScalar* u, PetscScalar* grad, bool projectField = true);
+    void ProjectToFace(const std::vector<domain::Field>& fields, PetscDS ds, const PetscFVFaceGeom& faceGeom, const PetscFVCellGeom& cellGeom, const PetscScalar* xArray, const PetscInt* fieldOffsets,
+                       const std::vector<const PetscScalar*>& gradArrays, const PetscInt* gradientOffsets, PetscScalar* u, PetscScalar* grad, bool projectField = true);
 
     /**
-     * computes the cell gradients
+     * computes the cell gradients and starts the communication to the gradLocVec.  The caller must end the communication and restore the gradGlobVec.
      * @param field
      * @param xLocalVec
      * @param gradLocVec
+     * @param gradGlobVec
      * @param dmGrad
      * @param cellGeomVec
      * @param faceGeomVec
      * @param faceRange
      * @param cellRange
      */
-    void ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec, const ablate::domain::Range& faceRange,
+    void ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, Vec& gradGlobVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec, const ablate::domain::Range& faceRange,
                                const ablate::domain::Range& cellRange);
 
     /**
@@ -98,8 +166,10 @@ class CellInterpolant {
      * @param solverRegion
      * @param faceGeomVec
      * @param cellGeomVec
+     * @param overlapGradientCommunication compute the faces that only need owned gradients before the gradient communication is complete
      */
-    CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomain, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec);
+    CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomain, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec,
+                    bool overlapGradientCommunication = true);
     ~CellInterpolant();
 
     /**
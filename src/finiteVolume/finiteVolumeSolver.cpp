@@ -36,6 +36,9 @@ void ablate::finiteVolume::FiniteVolumeSolver::Setup() {
     // Set the flux calculator solver for each component
     PetscDSSetFromOptions(subDomain->GetDiscreteSystem()) >> utilities::PetscUtilities::checkError;
 
+    // check if the gradient communication should be overlapped with the flux computation
+    PetscOptionsGetBool(petscOptions, nullptr, "-overlapGradientCommunication", &overlapGradientCommunication, nullptr) >> utilities::PetscUtilities::checkError;
+
     // Some petsc code assumes that a ghostLabel has created, so create one
     PetscBool ghostLabel;
     DMHasLabel(subDomain->GetDM(), "ghost", &ghostLabel) >> utilities::PetscUtilities::checkError;
@@ -231,7 +234,7 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
         StartEvent("FiniteVolumeSolver::ComputeRHSFunction::discontinuousFluxFunction");
         if (!discontinuousFluxFunctionDescriptions.empty()) {
             if (cellInterpolant == nullptr) {
-                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, overlapGradientCommunication);
             }
 
             cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec);
@@ -245,7 +248,7 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
         StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
         if (!pointFunctionDescriptions.empty()) {
             if (cellInterpolant == nullptr) {
-                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, overlapGradientCommunication);
             }
 
             cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
@@ -429,21 +432,24 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::Restore(PetscViewer vie
 }
 
 void ablate::finiteVolume::FiniteVolumeSolver::GetCellRangeWithoutGhost(ablate::domain::Range& faceRange) const {
-    // Get the point range
-    DMLabel solverRegionMinusGhostLabel;
-    PetscInt solverRegionMinusGhostValue;
-    domain::Region::GetLabel(solverRegionMinusGhost, GetSubDomain().GetDM(), solverRegionMinusGhostLabel, solverRegionMinusGhostValue);
-
-    DMLabelGetStratumIS(solverRegionMinusGhostLabel, solverRegionMinusGhostValue, &faceRange.is) >> utilities::PetscUtilities::checkError;
-    if (faceRange.is == nullptr) {
-        // There are no points in this region, so skip
-        faceRange.start = 0;
-        faceRange.end = 0;
-        faceRange.points = nullptr;
-    } else {
-        // Get the range
-        ISGetPointRange(faceRange.is, &faceRange.start, &faceRange.end, &faceRange.points) >> utilities::PetscUtilities::checkError;
-    }
+    auto computeRange = [this](ablate::domain::Range& computedRange) {
+        // Get the point range
+        DMLabel solverRegionMinusGhostLabel;
+        PetscInt solverRegionMinusGhostValue;
+        domain::Region::GetLabel(solverRegionMinusGhost, GetSubDomain().GetDM(), solverRegionMinusGhostLabel, solverRegionMinusGhostValue);
+
+        DMLabelGetStratumIS(solverRegionMinusGhostLabel, solverRegionMinusGhostValue, &computedRange.is) >> utilities::PetscUtilities::checkError;
+        if (computedRange.is == nullptr) {
+            // There are no points in this region, so skip
+            computedRange.start = 0;
+            computedRange.end = 0;
+            computedRange.points = nullptr;
+        } else {
+            // Get the range
+            ISGetPointRange(computedRange.is, &computedRange.start, &computedRange.end, &computedRange.points) >> utilities::PetscUtilities::checkError;
+        }
+    };
+    GetCachedRange("cellWithoutGhost", solverRegionMinusGhost, computeRange, faceRange);
 }
 
 PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeBoundary(PetscReal time, Vec locX, Vec locX_t) {
@@ -70,6 +70,9 @@ class FiniteVolumeSolver : public solver::CellSolver,
     //! hold the class responsible for compute cell based values;
     std::unique_ptr<CellInterpolant> cellInterpolant = nullptr;
 
+    //! overlap the flux computation with the gradient communication, can be disabled with the -overlapGradientCommunication false solver option
+    PetscBool overlapGradientCommunication = PETSC_TRUE;
+
     //! Store an region of all cells not in the ghost for faster iteration
     std::shared_ptr<domain::Region> solverRegionMinusGhost;
 
@@ -39,7 +39,14 @@ void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::F
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
             advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
 
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {});
+            // The cell temperature is computed once per rhs evaluation in the aux field.  If available, use it as the starting guess when decoding each face state
+            if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+                advectionData.computeTemperatureFromGuess = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+                flow.RegisterRHSFunction(
+                    AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {CompressibleFlowFields::TEMPERATURE_FIELD});
+            } else {
+                flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {});
+            }
         }
 
         if (transportModel) {
@@ -130,6 +137,7 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::AdvectionFlux(Petsc
 
     const int EULER_FIELD = 0;
     const int DENSITY_EV_FIELD = 1;
+    const int TEMPERATURE_FIELD = 0;
 
     // Decode the left and right states
     PetscReal densityL;
@@ -142,7 +150,12 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::AdvectionFlux(Petsc
         densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureL;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldL, auxL[aOff[TEMPERATURE_FIELD]], &temperatureL, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityL = 0.0;
@@ -166,7 +179,12 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::AdvectionFlux(Petsc
         densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureR;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldR, auxR[aOff[TEMPERATURE_FIELD]], &temperatureR, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityR = 0.0;
@@ -1,4 +1,5 @@
 #include "navierStokesTransport.hpp"
+#include <algorithm>
 #include <utility>
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/fluxCalculator/ausm.hpp"
@@ -35,7 +36,13 @@ ablate::finiteVolume::processes::NavierStokesTransport::NavierStokesTransport(co
 void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
     // Register the euler source terms
     if (fluxCalculator) {
-        flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {});
+        // The cell temperature is computed once per rhs evaluation in the aux field.  If available, use it as the starting guess when decoding each face state
+        if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {CompressibleFlowFields::TEMPERATURE_FIELD});
+            advectionData.computeTemperatureFromGuess = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        } else {
+            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {});
+        }
 
         // PetscErrorCode PetscOptionsGetBool(PetscOptions options,const char pre[],const char name[],PetscBool *ivalue,PetscBool *set)
         flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
@@ -44,6 +51,9 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
         advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
         advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
         advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+
+        timeStepData.computeTemperature = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        timeStepData.computeSpeedOfSound = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
     }
 
     // if there are any coefficients for diffusion, compute diffusion
@@ -83,14 +93,14 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
     }
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
         // set decode state functions
-        computeTemperatureFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        computeTemperatureBatchData.function = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         // add in aux update variables
-        flow.RegisterAuxFieldUpdate(UpdateAuxTemperatureField, &computeTemperatureFunction, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {});
+        flow.RegisterAuxFieldUpdate(UpdateAuxTemperatureFieldBatch, &computeTemperatureBatchData, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {});
     }
 
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
-        computePressureFunction = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
-        flow.RegisterAuxFieldUpdate(UpdateAuxPressureField, &computePressureFunction, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {});
+        computePressureBatchData.function = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+        flow.RegisterAuxFieldUpdate(UpdateAuxPressureFieldBatch, &computePressureBatchData, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {});
     }
 }
 
@@ -102,6 +112,7 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
     auto eulerAdvectionData = (AdvectionData*)ctx;
 
     const int EULER_FIELD = 0;
+    const int TEMPERATURE_FIELD = 0;
 
     // Compute the norm
     PetscReal norm[3];
@@ -121,7 +132,12 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
         densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureL;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldL, auxL[aOff[TEMPERATURE_FIELD]], &temperatureL, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityL = 0.0;
@@ -146,7 +162,12 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
         densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureR;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldR, auxR[aOff[TEMPERATURE_FIELD]], &temperatureR, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityR = 0.0;
@@ -239,8 +260,18 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeSte
         pgsAlpha = timeStepData->pgs->GetAlpha();
     }
 
-    // March over each cell
-    PetscReal dtMin = ablate::utilities::Constants::large;
+    // Size the buffers for the batched eos calls
+    PetscInt totDim;
+    PetscDSGetTotalDimension(flow.GetSubDomain().GetDiscreteSystem(), &totDim) >> utilities::PetscUtilities::checkError;
+    const auto maxCells = (std::size_t)(cellRange.end - cellRange.start);
+    timeStepData->conserved.resize(maxCells * totDim);
+    timeStepData->temperature.resize(maxCells);
+    timeStepData->speedOfSound.resize(maxCells);
+    timeStepData->dx.resize(maxCells);
+    timeStepData->velocitySum.resize(maxCells);
+
+    // Gather each real cell
+    PetscInt numberCells = 0;
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         auto cell = cellRange.GetPoint(c);
 
@@ -253,24 +284,32 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeCflTimeSte
 
         if (euler) {  // must be real cell and not ghost
             PetscReal rho = euler[CompressibleFlowFields::RHO];
+            std::copy_n(conserved, totDim, timeStepData->conserved.begin() + numberCells * totDim);
 
-            // Get the speed of sound from the eos
-            PetscReal temperature;
-            advectionData->computeTemperature.function(conserved, &temperature, advectionData->computeTemperature.context.get()) >> utilities::PetscUtilities::checkError;
-            PetscReal a;
-            advectionData->computeSpeedOfSound.function(conserved, temperature, &a, advectionData->computeSpeedOfSound.context.get()) >> utilities::PetscUtilities::checkError;
-
-            PetscReal dx = 2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS];
+            timeStepData->dx[numberCells] = 2.0 * cellCharacteristics[FiniteVolumeSolver::MIN_CELL_RADIUS];
 
             PetscReal velSum = 0.0;
             for (PetscInt d = 0; d < dim; d++) {
                 velSum += PetscAbsReal(euler[CompressibleFlowFields::RHOU + d]) / rho;
             }
-            PetscReal dt = advectionData->cfl * dx / (a / pgsAlpha + velSum);
-
-            dtMin = PetscMin(dtMin, dt);
+            timeStepData->velocitySum[numberCells] = velSum;
+            numberCells++;
         }
     }
+
+    // Get the speed of sound from the eos for every cell at once
+    timeStepData->computeTemperature.function(numberCells, timeStepData->conserved.data(), totDim, timeStepData->temperature.data(), timeStepData->computeTemperature.context.get()) >>
+        utilities::PetscUtilities::checkError;
+    timeStepData->computeSpeedOfSound.function(
+        numberCells, timeStepData->conserved.data(), totDim, timeStepData->temperature.data(), timeStepData->speedOfSound.data(), timeStepData->computeSpeedOfSound.context.get()) >>
+        utilities::PetscUtilities::checkError;
+
+    // March over each cell
+    PetscReal dtMin = ablate::utilities::Constants::large;
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscReal dt = advectionData->cfl * timeStepData->dx[c] / (timeStepData->speedOfSound[c] / pgsAlpha + timeStepData->velocitySum[c]);
+        dtMin = PetscMin(dtMin, dt);
+    }
     VecRestoreArrayRead(v, &x) >> utilities::PetscUtilities::checkError;
     flow.RestoreRange(cellRange);
     VecRestoreArrayRead(locCharacteristicsVec, &locCharacteristicsArray) >> utilities::PetscUtilities::checkError;
@@ -559,6 +598,40 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAux
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxTemperatureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride,
+                                                                                                      const PetscScalar* conservedValues, const PetscInt aOff[], PetscInt aStride,
+                                                                                                      PetscScalar* auxField, void* ctx) {
+    PetscFunctionBeginUser;
+    auto batchData = (AuxTemperatureBatchData*)ctx;
+    batchData->values.resize(2 * numberCells);
+    PetscReal* temperatureGuess = batchData->values.data();
+    PetscReal* temperature = batchData->values.data() + numberCells;
+
+    // use the current temperature as the guess
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        temperatureGuess[c] = auxField[c * aStride + aOff[0]];
+    }
+    PetscCall(batchData->function.function(numberCells, conservedValues, uStride, temperatureGuess, temperature, batchData->function.context.get()));
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        auxField[c * aStride + aOff[0]] = temperature[c];
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxPressureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride,
+                                                                                                   const PetscScalar* conservedValues, const PetscInt aOff[], PetscInt aStride, PetscScalar* auxField,
+                                                                                                   void* ctx) {
+    PetscFunctionBeginUser;
+    auto batchData = (AuxPressureBatchData*)ctx;
+    batchData->values.resize(numberCells);
+
+    PetscCall(batchData->function.function(numberCells, conservedValues, uStride, batchData->values.data(), batchData->function.context.get()));
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        auxField[c * aStride + aOff[0]] = batchData->values[c];
+    }
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::NavierStokesTransport, "build advection/diffusion for the euler field",
          OPT(ablate::parameters::Parameters, "parameters", "the parameters used by advection/diffusion: cfl(.5), conductionStabilityFactor(0), viscousStabilityFactor(0)"),
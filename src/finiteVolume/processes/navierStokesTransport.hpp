@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_NAVIERSTOKESTRANSPORT_HPP
 
 #include <petsc.h>
+#include <vector>
 #include "eos/transport/transportModel.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
@@ -21,6 +22,8 @@ class NavierStokesTransport : public FlowProcess {
 
         // EOS function calls
         eos::ThermodynamicFunction computeTemperature;
+        //! optional temperature function that uses the cell temperature (aux) as the initial guess for the face temperature
+        eos::ThermodynamicTemperatureFunction computeTemperatureFromGuess;
         eos::ThermodynamicTemperatureFunction computeInternalEnergy;
         eos::ThermodynamicTemperatureFunction computeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction computePressure;
@@ -44,11 +47,20 @@ class NavierStokesTransport : public FlowProcess {
     const std::shared_ptr<eos::transport::TransportModel> transportModel;
     AdvectionData advectionData;
 
-    eos::ThermodynamicTemperatureFunction computeTemperatureFunction;
+    // Store the batched eos function and a reusable buffer for the aux updates
+    struct AuxTemperatureBatchData {
+        eos::ThermodynamicTemperatureBatchFunction function;
+        std::vector<PetscReal> values;
+    };
+    AuxTemperatureBatchData computeTemperatureBatchData;
 
     DiffusionData diffusionData;
 
-    eos::ThermodynamicFunction computePressureFunction;
+    struct AuxPressureBatchData {
+        eos::ThermodynamicBatchFunction function;
+        std::vector<PetscReal> values;
+    };
+    AuxPressureBatchData computePressureBatchData;
 
     // Store the required ctx for time stepping
     struct CflTimeStepData {
@@ -59,6 +71,17 @@ class NavierStokesTransport : public FlowProcess {
          * pressure gradient scaling
          */
         std::shared_ptr<ablate::finiteVolume::processes::PressureGradientScaling> pgs;
+
+        //! batched eos functions used to compute the speed of sound for every cell at once
+        eos::ThermodynamicBatchFunction computeTemperature;
+        eos::ThermodynamicTemperatureBatchFunction computeSpeedOfSound;
+
+        //! reusable buffers for the batched calls
+        std::vector<PetscReal> conserved;
+        std::vector<PetscReal> temperature;
+        std::vector<PetscReal> speedOfSound;
+        std::vector<PetscReal> dx;
+        std::vector<PetscReal> velocitySum;
     };
     CflTimeStepData timeStepData;
 
@@ -108,6 +131,18 @@ class NavierStokesTransport : public FlowProcess {
     static PetscErrorCode UpdateAuxPressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues, const PetscInt aOff[],
                                                  PetscScalar* auxField, void* ctx);
 
+    /**
+     * Batched version of UpdateAuxTemperatureField using the existing aux temperature as the initial guess
+     */
+    static PetscErrorCode UpdateAuxTemperatureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* conservedValues,
+                                                         const PetscInt aOff[], PetscInt aStride, PetscScalar* auxField, void* ctx);
+
+    /**
+     * Batched version of UpdateAuxPressureField
+     */
+    static PetscErrorCode UpdateAuxPressureFieldBatch(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* conservedValues,
+                                                      const PetscInt aOff[], PetscInt aStride, PetscScalar* auxField, void* ctx);
+
     /**
      *
      * public constructor for euler advection
@@ -124,7 +159,7 @@ class NavierStokesTransport : public FlowProcess {
     /**
      * This Computes the Flow Euler flow for rho, rhoE, and rhoVel.
      * u = {"euler"} or {"euler", "densityYi"} if species are tracked
-     * a = {}
+     * a = {} or {"temperature"} if the temperature is cached in the aux field
      * ctx = FlowData_CompressibleFlow
      * @return
      */
@@ -9,37 +9,21 @@ ablate::finiteVolume::processes::Soot::Soot(const std::shared_ptr<eos::EOS>& eos
         throw std::invalid_argument("ablate::finiteVolume::processes::Soot only accepts EOS of type eos::TChem");
     }
 
-    // Set the options if provided
+    // Set the options if provided, the integrator settings use the same names as the petsc ts
     if (options) {
         PetscOptionsCreate(&petscOptions) >> utilities::PetscUtilities::checkError;
         options->Fill(petscOptions);
+        PetscOptionsGetReal(petscOptions, nullptr, "-ts_dt", &dtInit, nullptr) >> utilities::PetscUtilities::checkError;
+        PetscOptionsGetReal(petscOptions, nullptr, "-ts_adapt_dt_min", &dtMin, nullptr) >> utilities::PetscUtilities::checkError;
+        PetscOptionsGetReal(petscOptions, nullptr, "-ts_adapt_dt_max", &dtMax, nullptr) >> utilities::PetscUtilities::checkError;
+        PetscOptionsGetReal(petscOptions, nullptr, "-ts_atol", &absoluteTolerance, nullptr) >> utilities::PetscUtilities::checkError;
+        PetscOptionsGetReal(petscOptions, nullptr, "-ts_rtol", &relativeTolerance, nullptr) >> utilities::PetscUtilities::checkError;
     }
-
-    // Create a vector and mat for local ode calculation
-    VecCreateSeq(PETSC_COMM_SELF, TotalEquations, &pointData) >> utilities::PetscUtilities::checkError;
-    MatCreateSeqDense(PETSC_COMM_SELF, TotalEquations, TotalEquations, nullptr, &pointJacobian) >> utilities::PetscUtilities::checkError;
-    MatSetFromOptions(pointJacobian) >> utilities::PetscUtilities::checkError;
-
-    /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-          Create timestepping solver context
-          - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
-    TSCreate(PETSC_COMM_SELF, &pointTs) >> utilities::PetscUtilities::checkError;
-    PetscObjectSetOptions((PetscObject)pointTs, petscOptions) >> utilities::PetscUtilities::checkError;
-    TSSetType(pointTs, TSARKIMEX) >> utilities::PetscUtilities::checkError;
-    TSARKIMEXSetFullyImplicit(pointTs, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
-    TSARKIMEXSetType(pointTs, TSARKIMEX4) >> utilities::PetscUtilities::checkError;
-    TSSetRHSFunction(pointTs, nullptr, SinglePointSootChemistryRHS, &pointInformation) >> utilities::PetscUtilities::checkError;
-    TSSetExactFinalTime(pointTs, TS_EXACTFINALTIME_MATCHSTEP) >> utilities::PetscUtilities::checkError;
-
-    // set the adapting control
-    TSSetSolution(pointTs, pointData) >> utilities::PetscUtilities::checkError;
-    TSSetTimeStep(pointTs, dtInitDefault) >> utilities::PetscUtilities::checkError;
-    TSAdapt adapt;
-    TSGetAdapt(pointTs, &adapt) >> utilities::PetscUtilities::checkError;
-    TSAdaptSetStepLimits(adapt, 1e-12, 1E-4) >> utilities::PetscUtilities::checkError; /* Also available with -ts_adapt_dt_min/-ts_adapt_dt_max */
-    TSSetMaxSNESFailures(pointTs, -1) >> utilities::PetscUtilities::checkError;        /* Retry step an unlimited number of times */
-    TSSetFromOptions(pointTs) >> utilities::PetscUtilities::checkError;
-    TSGetTimeStep(pointTs, &dtInit) >> utilities::PetscUtilities::checkError;
+    if (dtMin <= 0.0 || dtMax < dtMin) {
+        throw std::invalid_argument("ablate::finiteVolume::processes::Soot requires 0 < ts_adapt_dt_min <= ts_adapt_dt_max");
+    }
+    dtInit = PetscMin(PetscMax(dtInit, dtMin), dtMax);
+    integrator = std::make_unique<utilities::BatchedRosenbrockIntegrator<TotalEquations>>(dtMin, dtMax, absoluteTolerance, relativeTolerance);
 }
 ablate::finiteVolume::processes::Soot::~Soot() {
     if (sourceDm) {
@@ -49,16 +33,7 @@ ablate::finiteVolume::processes::Soot::~Soot() {
         VecDestroy(&sourceVec) >> utilities::PetscUtilities::checkError;
     }
     if (petscOptions) {
-        utilities::PetscUtilities::PetscOptionsDestroyAndCheck("TChemReactions", &petscOptions);
-    }
-    if (pointTs) {
-        TSDestroy(&pointTs) >> utilities::PetscUtilities::checkError;
-    }
-    if (pointData) {
-        VecDestroy(&pointData) >> utilities::PetscUtilities::checkError;
-    }
-    if (pointJacobian) {
-        MatDestroy(&pointJacobian) >> utilities::PetscUtilities::checkError;
+        utilities::PetscUtilities::PetscOptionsDestroyAndCheck("Soot", &petscOptions);
     }
 }
 
@@ -106,8 +81,7 @@ void ablate::finiteVolume::processes::Soot::Initialize(ablate::finiteVolume::Fin
         pointInformation.mw[s] = mw[OdeSpeciesNames[s]];
     }
 
-    // size up the yiScratch
-    pointInformation.yiScratch.resize(eos->GetSpeciesVariables().size());
+    // size up the scratch
     pointInformation.speciesSensibleEnthalpyScratch.resize(eos->GetSpeciesVariables().size());
 
     // create a mock field, where density/euler as zero offset.  This only works because we know we are using tchem
@@ -165,10 +139,13 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeSootChemistryPreSte
     PetscScalar* sourceArray;
     PetscCall(VecGetArray(soot->sourceVec, &sourceArray));
 
-    // get an easy reference to the point information
+    // get an easy reference to the point information and batch
     auto& pointInformation = soot->pointInformation;
+    auto& batch = soot->batch;
 
-    // March over each cell
+    // March over each cell to determine which cells are integrated
+    std::vector<PetscInt> batchCells;
+    batchCells.reserve(cellRange.end - cellRange.start);
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         // if there is a cell array, use it, otherwise it is just c
         const PetscInt cell = cellRange.GetPoint(c);
@@ -179,65 +156,12 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeSootChemistryPreSte
 
         // If a real cell (not ghost)
         if (conserved) {
-            // store the data for the chemistry ts (T, Yi...)
             PetscReal* temperature;
             PetscCall(DMPlexPointLocalFieldRead(temperatureDm, cell, temperatureField.id, temperatureArray, &temperature));
 
             if (*temperature > soot->thresholdTemperature) {
-                // get access to the point ode solver
-                PetscScalar* pointArray;
-                PetscCall(VecGetArray(soot->pointData, &pointArray));
-                PetscReal density = conserved[flowEulerId.offset + ablate::finiteVolume::CompressibleFlowFields::RHO];
-                pointInformation.currentDensity = density;
-                pointArray[ODE_T] = *temperature;
-                pointArray[ODE_NDD] = (conserved[flowDensityProgressId.offset] / density) / NddScaling;
-
-                // Fill the yi scratch
-                for (PetscInt s = 0; s < flowDensityYiId.numberComponents; s++) {
-                    pointInformation.yiScratch[s] = PetscMin(PetscMax(0.0, conserved[flowDensityYiId.offset + s] / density), 1.0);
-                }
-
-                for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
-                    pointArray[s] = pointInformation.yiScratch[pointInformation.speciesIndex[s]];
-                }
-
-                // Compute the Cv,mix
-                PetscCall(VecRestoreArray(soot->pointData, &pointArray));
-
-                // Do a soft reset on the ode solver
-                PetscCall(TSSetTime(soot->pointTs, time));
-                PetscCall(TSSetMaxTime(soot->pointTs, time + dt));
-                PetscCall(TSSetTimeStep(soot->pointTs, soot->dtInit));
-                PetscCall(TSSetStepNumber(soot->pointTs, 0));
-
-                // solver for this point
-                PetscCall(TSSolve(soot->pointTs, soot->pointData));
-
-                // Use the updated values to compute the source terms for euler and species transport
-                PetscScalar* fieldSource;
-                PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
-
-                // get the array data again
-                PetscCall(VecGetArray(soot->pointData, &pointArray));
-
-                // store the computed source terms
-                fieldSource[ODE_T] = 0.0;
-                for (PetscInt s = 0; s < TOTAL_ODE_SPECIES; ++s) {
-                    fieldSource[ODE_T] += (conserved[pointInformation.speciesOffset[s]] / density - pointArray[s]) * pointInformation.enthalpyOfFormation[s];
-                    fieldSource[s] = pointArray[s] - conserved[pointInformation.speciesOffset[s]] / density;
-                }
-                // Add in the source term for the change in ndd
-                fieldSource[ODE_NDD] = pointArray[ODE_NDD] * NddScaling - conserved[flowDensityProgressId.offset] / density;
-
-                // Now scale everything by density/dt
-                for (PetscInt i = 0; i < TotalEquations; i++) {
-                    // for constant density problem, d Yi rho/dt = rho * d Yi/dt + Yi*d rho/dt = rho*dYi/dt ~~ rho*(Yi+1 - Y1)/dt
-                    fieldSource[i] *= density / dt;
-                }
-
-                PetscCall(VecRestoreArray(soot->pointData, &pointArray));
+                batchCells.push_back(cell);
             } else {
-                // Use the updated values to compute the source terms for euler and species transport
                 PetscScalar* fieldSource;
                 PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
                 PetscArrayzero(fieldSource, TotalEquations);
@@ -245,6 +169,65 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeSootChemistryPreSte
         }
     }
 
+    // Fill the batch with the initial state of each cell
+    batch.Resize((PetscInt)batchCells.size(), flowDensityYiId.numberComponents);
+    auto& integrator = *soot->integrator;
+    integrator.Resize(batch.size);
+    for (PetscInt i = 0; i < batch.size; ++i) {
+        const PetscInt cell = batchCells[i];
+        const PetscScalar* conserved = nullptr;
+        PetscCall(DMPlexPointGlobalRead(flow.GetSubDomain().GetDM(), cell, solutionArray, &conserved));
+        PetscReal* temperature;
+        PetscCall(DMPlexPointLocalFieldRead(temperatureDm, cell, temperatureField.id, temperatureArray, &temperature));
+
+        PetscReal density = conserved[flowEulerId.offset + ablate::finiteVolume::CompressibleFlowFields::RHO];
+        batch.cells[i] = cell;
+        batch.density[i] = density;
+        integrator.Time(i) = time;
+        integrator.TimeStep(i) = soot->dtInit;
+        integrator.Value(i, ODE_T) = *temperature;
+        integrator.Value(i, ODE_NDD) = (conserved[flowDensityProgressId.offset] / density) / NddScaling;
+
+        // Fill the full yi for this cell
+        PetscReal* yi = batch.yi.data() + i * batch.numberSpecies;
+        for (PetscInt s = 0; s < flowDensityYiId.numberComponents; s++) {
+            yi[s] = PetscMin(PetscMax(0.0, conserved[flowDensityYiId.offset + s] / density), 1.0);
+        }
+        for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
+            integrator.Value(i, (PetscInt)s) = yi[pointInformation.speciesIndex[s]];
+        }
+    }
+
+    // Advance all cells together over this dt
+    PetscCall(soot->IntegrateBatch(time + dt));
+
+    // Use the updated values to compute the source terms for euler and species transport
+    for (PetscInt i = 0; i < batch.size; ++i) {
+        const PetscInt cell = batch.cells[i];
+        const PetscScalar* conserved = nullptr;
+        PetscCall(DMPlexPointGlobalRead(flow.GetSubDomain().GetDM(), cell, solutionArray, &conserved));
+        const PetscReal density = batch.density[i];
+
+        PetscScalar* fieldSource;
+        PetscCall(DMPlexPointLocalRef(soot->sourceDm, cell, sourceArray, &fieldSource));
+
+        // store the computed source terms
+        fieldSource[ODE_T] = 0.0;
+        for (PetscInt s = 0; s < TOTAL_ODE_SPECIES; ++s) {
+            const PetscReal value = integrator.Value(i, s);
+            fieldSource[ODE_T] += (conserved[pointInformation.speciesOffset[s]] / density - value) * pointInformation.enthalpyOfFormation[s];
+            fieldSource[s] = value - conserved[pointInformation.speciesOffset[s]] / density;
+        }
+        // Add in the source term for the change in ndd
+        fieldSource[ODE_NDD] = integrator.Value(i, ODE_NDD) * NddScaling - conserved[flowDensityProgressId.offset] / density;
+
+        // Now scale everything by density/dt
+        for (PetscInt e = 0; e < TotalEquations; e++) {
+            // for constant density problem, d Yi rho/dt = rho * d Yi/dt + Yi*d rho/dt = rho*dYi/dt ~~ rho*(Yi+1 - Y1)/dt
+            fieldSource[e] *= density / dt;
+        }
+    }
+
     // cleanup
     flow.RestoreRange(cellRange);
     PetscCall(VecRestoreArray(soot->sourceVec, &sourceArray));
@@ -306,97 +289,127 @@ PetscErrorCode ablate::finiteVolume::processes::Soot::AddSootChemistrySourceToFl
 
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::finiteVolume::processes::Soot::SinglePointSootChemistryRHS(TS ts, PetscReal t, Vec xVec, Vec fVec, void* ctx) {
+PetscErrorCode ablate::finiteVolume::processes::Soot::SinglePointSootChemistryRHS(OdePointInformation& pointInfo, PetscReal density, const PetscReal x[], PetscReal yi[], PetscReal f[]) {
     PetscFunctionBeginUser;
-    auto pointInfo = (OdePointInformation*)ctx;
+    PetscCall(PetscArrayzero(f, TotalEquations));
 
-    // extract the read/write arrays
-    const PetscScalar* xArray;
-    PetscCall(VecGetArrayRead(xVec, &xArray));
-    PetscCall(VecZeroEntries(fVec));
-    PetscScalar* fArray;
-    PetscCall(VecGetArray(fVec, &fArray));
-
-    // copy over the updated to the scratch variable for now
+    // copy over the updated values to the yi for this point
     PetscReal localOdeValues[TotalEquations];
     for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
-        localOdeValues[s] = PetscMax(PetscMin(xArray[s], 1.0), 0.0);
-        pointInfo->yiScratch[pointInfo->speciesIndex[s]] = localOdeValues[s];
+        localOdeValues[s] = PetscMax(PetscMin(x[s], 1.0), 0.0);
+        yi[pointInfo.speciesIndex[s]] = localOdeValues[s];
     }
-    localOdeValues[ODE_T] = PetscMax(xArray[ODE_T], 0);
-    localOdeValues[ODE_NDD] = PetscMax(xArray[ODE_NDD], 0);
+    localOdeValues[ODE_T] = PetscMax(x[ODE_T], 0);
+    localOdeValues[ODE_NDD] = PetscMax(x[ODE_NDD], 0);
 
     // Add in the Soot Reaction Sources
-    PetscReal SVF = localOdeValues[C_s] * pointInfo->currentDensity / solidCarbonDensity;
+    PetscReal SVF = localOdeValues[C_s] * density / solidCarbonDensity;
 
     // compute ndd that is not scalled
     PetscReal ndd = PetscMax(localOdeValues[ODE_NDD], 0) * NddScaling;
 
     // Total S.A. of soot / unit volume
-    PetscReal SA_V = calculateSurfaceArea_V(localOdeValues[C_s], ndd, pointInfo->currentDensity);
+    PetscReal SA_V = calculateSurfaceArea_V(localOdeValues[C_s], ndd, density);
 
     // Need the Concentrations of C2H2, O2, O, and OH
     // It is unclear in the formulations of the Reaction Rates whether to use to concentration in regards to the total mixture or just the gas phace, There is a difference due to the density relation
     //-> For now we will use the concentration to be the concentration in the gas phase as it makes more physical sense
-    PetscReal C2H2Conc = pointInfo->currentDensity * PetscMax(0, localOdeValues[C2H2]) / pointInfo->mw[C2H2];
-    PetscReal O2Conc = pointInfo->currentDensity * PetscMax(0, localOdeValues[O2]) / pointInfo->mw[O2];
-    PetscReal OConc = pointInfo->currentDensity * PetscMax(0, localOdeValues[O]) / pointInfo->mw[O];
-    PetscReal OHConc = pointInfo->currentDensity * PetscMax(0, localOdeValues[OH]) / pointInfo->mw[OH];
+    PetscReal C2H2Conc = density * PetscMax(0, localOdeValues[C2H2]) / pointInfo.mw[C2H2];
+    PetscReal O2Conc = density * PetscMax(0, localOdeValues[O2]) / pointInfo.mw[O2];
+    PetscReal OConc = density * PetscMax(0, localOdeValues[O]) / pointInfo.mw[O];
+    PetscReal OHConc = density * PetscMax(0, localOdeValues[OH]) / pointInfo.mw[OH];
 
     // Now plug in and solve the Nucleation, Surface Growth, Agglomeration, and Oxidation sources
     PetscReal NucRate = calculateNucleationReactionRate(localOdeValues[ODE_T], C2H2Conc, SVF);
     PetscReal SGRate = calculateSurfaceGrowthReactionRate(localOdeValues[ODE_T], C2H2Conc, SA_V);
 
-    PetscReal AggRate = calculateAgglomerationRate(localOdeValues[C_s], ndd, localOdeValues[ODE_T], pointInfo->currentDensity);
-    PetscReal O2OxRate = calculateO2OxidationRate(localOdeValues[C_s], ndd, O2Conc, pointInfo->currentDensity, localOdeValues[ODE_T], SA_V);
+    PetscReal AggRate = calculateAgglomerationRate(localOdeValues[C_s], ndd, localOdeValues[ODE_T], density);
+    PetscReal O2OxRate = calculateO2OxidationRate(localOdeValues[C_s], ndd, O2Conc, density, localOdeValues[ODE_T], SA_V);
     PetscReal OOxRate = calculateOOxidationRate(OConc, localOdeValues[ODE_T], SA_V, SVF);
     PetscReal OHOxRate = calculateOHOxidationRate(OHConc, localOdeValues[ODE_T], SA_V, SVF);
 
     // Now Add these rates correctly to the appropriate species sources (solving Yidot, i.e. also have to divide by the total density.
     // Keep in mind all these rates are kmol/m^3, need to convert to kg/m^3 for each appropriate species as well!
-    PetscReal O_totDens = 1. / pointInfo->currentDensity;
+    PetscReal O_totDens = 1. / density;
     // C2H2 (Loss from Nucleation and Surface Growth)
-    fArray[C2H2] += O_totDens * pointInfo->mw[C2H2] * (-NucRate - SGRate);
+    f[C2H2] += O_totDens * pointInfo.mw[C2H2] * (-NucRate - SGRate);
     // O ( Loss from O Oxidation)
-    fArray[O] += O_totDens * pointInfo->mw[O] * (-OOxRate);
+    f[O] += O_totDens * pointInfo.mw[O] * (-OOxRate);
     // O2 (Loss from O2 Oxidation)
-    fArray[O2] += O_totDens * pointInfo->mw[O2] * (-.5 * O2OxRate);
+    f[O2] += O_totDens * pointInfo.mw[O2] * (-.5 * O2OxRate);
     // OH ( Loss from OH Oxidation)
-    fArray[OH] += O_totDens * pointInfo->mw[OH] * (-OHOxRate);
+    f[OH] += O_totDens * pointInfo.mw[OH] * (-OHOxRate);
     // CO ( Generation From All Oxidations)
-    fArray[CO] += O_totDens * pointInfo->mw[CO] * (OHOxRate + O2OxRate + OOxRate);
+    f[CO] += O_totDens * pointInfo.mw[CO] * (OHOxRate + O2OxRate + OOxRate);
     // H2 ( Generation From Nucleation and SG)
-    fArray[H2] += O_totDens * pointInfo->mw[H2] * (NucRate + SGRate);
+    f[H2] += O_totDens * pointInfo.mw[H2] * (NucRate + SGRate);
     // H (Generation from OH Oxidation)
-    fArray[H] += O_totDens * pointInfo->mw[H] * (OHOxRate);
+    f[H] += O_totDens * pointInfo.mw[H] * (OHOxRate);
 
     // Now Onto The Solid Carbon and Ndd source terms
     // SC ( generation from Surface growth and Nucleation and loss from all oxidation's)
-    fArray[C_s] += O_totDens * pointInfo->mw[C_s] * (2 * (NucRate + SGRate) - O2OxRate - OOxRate - OHOxRate);
-    fArray[ODE_NDD] += O_totDens * (NdNuclationConversionTerm * NucRate - AggRate);
-    fArray[ODE_NDD] /= NddScaling;
+    f[C_s] += O_totDens * pointInfo.mw[C_s] * (2 * (NucRate + SGRate) - O2OxRate - OOxRate - OHOxRate);
+    f[ODE_NDD] += O_totDens * (NdNuclationConversionTerm * NucRate - AggRate);
+    f[ODE_NDD] /= NddScaling;
 
     // compute the specific heat at constant volume.  We set this up to allow density to be the only conserved
     PetscReal cv;
-    pointInfo->specificHeatConstantVolumeFunction.function(
-        &(pointInfo->currentDensity), pointInfo->yiScratch.data(), localOdeValues[ODE_T], &cv, pointInfo->specificHeatConstantVolumeFunction.context.get());
+    PetscCall(pointInfo.specificHeatConstantVolumeFunction.function(&density, yi, localOdeValues[ODE_T], &cv, pointInfo.specificHeatConstantVolumeFunction.context.get()));
 
     // compute the speciesSensibleEnthalpy and turn into internal energy
-    pointInfo->speciesSensibleEnthalpyFunction.function(
-        &(pointInfo->currentDensity), pointInfo->yiScratch.data(), localOdeValues[ODE_T], pointInfo->speciesSensibleEnthalpyScratch.data(), pointInfo->speciesSensibleEnthalpyFunction.context.get());
+    PetscCall(pointInfo.speciesSensibleEnthalpyFunction.function(
+        &density, yi, localOdeValues[ODE_T], pointInfo.speciesSensibleEnthalpyScratch.data(), pointInfo.speciesSensibleEnthalpyFunction.context.get()));
 
     // compute the temperature source term
     for (std::size_t s = 0; s < TOTAL_ODE_SPECIES; s++) {
-        fArray[ODE_T] += fArray[s] * (pointInfo->speciesSensibleEnthalpyScratch[pointInfo->speciesIndex[s]] + pointInfo->enthalpyOfFormation[s] - RUNIV * 1.0e3 / pointInfo->mw[s]);
+        f[ODE_T] += f[s] * (pointInfo.speciesSensibleEnthalpyScratch[pointInfo.speciesIndex[s]] + pointInfo.enthalpyOfFormation[s] - RUNIV * 1.0e3 / pointInfo.mw[s]);
     }
-    fArray[ODE_T] /= -cv;
+    f[ODE_T] /= -cv;
+    PetscFunctionReturn(0);
+}
 
-    PetscCall(VecRestoreArrayRead(xVec, &xArray));
-    PetscCall(VecRestoreArray(fVec, &fArray));
+void ablate::finiteVolume::processes::Soot::OdeBatch::Resize(PetscInt sizeIn, PetscInt numberSpeciesIn) {
+    size = sizeIn;
+    numberSpecies = numberSpeciesIn;
+    cells.resize(size);
+    density.resize(size);
+    yi.resize(size * numberSpecies);
+    failedEntries.reserve(size);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Soot::ComputeBatchRHS(const std::vector<PetscInt>& entries, const std::vector<PetscReal>& values, std::vector<PetscReal>& rhs) {
+    PetscFunctionBeginUser;
+    const PetscInt size = batch.size;
+    PetscReal x[TotalEquations];
+    PetscReal f[TotalEquations];
+    for (const auto i : entries) {
+        for (PetscInt e = 0; e < TotalEquations; ++e) {
+            x[e] = values[e * size + i];
+        }
+        PetscCall(SinglePointSootChemistryRHS(pointInformation, batch.density[i], x, batch.yi.data() + i * batch.numberSpecies, f));
+        for (PetscInt e = 0; e < TotalEquations; ++e) {
+            rhs[e * size + i] = f[e];
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Soot::IntegrateBatch(PetscReal endTime) {
+    PetscFunctionBeginUser;
+    PetscCall(integrator->Integrate(endTime, [this](const auto& entries, const auto& values, auto& rhs) { return ComputeBatchRHS(entries, values, rhs); }, batch.failedEntries));
+
+    // report each cell that keeps its last accepted values
+    for (const auto i : batch.failedEntries) {
+        PetscCall(PetscInfo(nullptr,
+                            "Soot integration failed for cell %" PetscInt_FMT " at time %g (T = %g), using the last accepted values\n",
+                            batch.cells[i],
+                            (double)integrator->Time(i),
+                            (double)integrator->Value(i, ODE_T)));
+    }
     PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::Soot, "Soot only reactions", ARG(ablate::eos::EOS, "eos", "the tChem eos"),
-         OPT(ablate::parameters::Parameters, "options", "any PETSc options for the chemistry ts"),
+         OPT(ablate::parameters::Parameters, "options", "options for the batched soot integrator (ts_dt, ts_atol, ts_rtol, ts_adapt_dt_min, ts_adapt_dt_max)"),
          OPT(double, "thresholdTemperature", "set a minimum temperature for the chemical kinetics ode integration"));
@@ -3,6 +3,7 @@
 
 #include "eos/tChem.hpp"
 #include "process.hpp"
+#include "utilities/batchedRosenbrockIntegrator.hpp"
 #include "utilities/constants.hpp"
 
 namespace ablate::finiteVolume::processes {
@@ -20,18 +21,29 @@ class Soot : public Process {
     // create a separate vec to hold the sources
     Vec sourceVec = nullptr;
 
-    // Petsc options specific to the chemTs. These may be null by default
+    // Petsc options specific to the soot integrator. These may be null by default
     PetscOptions petscOptions = nullptr;
 
     // the eos used to species the species and compute properties
     std::shared_ptr<eos::TChem> eos;
 
-    // store the default dtInit
+    // store the default integrator parameters, these can be changed with the same petsc options used for a ts
     inline const static PetscReal dtInitDefault = 1E-6;
+    inline const static PetscReal dtMinDefault = 1E-12;
+    inline const static PetscReal dtMaxDefault = 1E-4;
+    inline const static PetscReal toleranceDefault = 1E-4;
 
     // store the dtInit, this may be different from default if set with petsc options
     PetscReal dtInit = dtInitDefault;
 
+    // store the adaptive step limits (-ts_adapt_dt_min/-ts_adapt_dt_max)
+    PetscReal dtMin = dtMinDefault;
+    PetscReal dtMax = dtMaxDefault;
+
+    // store the absolute and relative tolerance used to adapt each cell's dt (-ts_atol/-ts_rtol)
+    PetscReal absoluteTolerance = toleranceDefault;
+    PetscReal relativeTolerance = toleranceDefault;
+
     // store an optional threshold temperature.  Only compute the reactions if the temperature is above thresholdTemperature
     double thresholdTemperature = 0.0;
 
@@ -50,19 +62,9 @@ class Soot : public Process {
     // compute the number of ode species
     inline static const PetscInt TotalEquations = TOTAL_ODE_SPECIES + 2;
 
-    // Hold the single point TS
-    TS pointTs = nullptr;
-    Vec pointData = nullptr;
-    Mat pointJacobian = nullptr;
-
     // Store a struct with the ode point information
     struct OdePointInformation {
-        // pass the current density into the ode solver
-        PetscReal currentDensity;
-        // hold a vector of all yi for scratch to allow
-        std::vector<PetscReal> yiScratch;
-
-        // hold a vector of all yi for scratch to allow
+        // hold a vector of all species sensible enthalpy for scratch
         std::vector<PetscReal> speciesSensibleEnthalpyScratch;
 
         // Hold the function for SpecificHeatConstantVolume
@@ -84,16 +86,60 @@ class Soot : public Process {
         std::array<PetscReal, TOTAL_ODE_SPECIES> mw;
     };
     OdePointInformation pointInformation;
+
     /**
-     * Private function to integrate single point soot chemistry in time
-     * @param ts
-     * @param t
-     * @param X
-     * @param F
-     * @param ptr
+     * Hold the state for every cell integrated over this step.  The full yi is stored per cell because it is passed to the eos.
+     */
+    struct OdeBatch {
+        //! the number of cells in the batch
+        PetscInt size = 0;
+        //! the number of species in the full yi
+        PetscInt numberSpecies = 0;
+        //! the cell point for each entry
+        std::vector<PetscInt> cells;
+        //! the density for each entry, it is held constant over the integration
+        std::vector<PetscReal> density;
+        //! the full yi for each entry, the ode species are updated in place when computing the rhs
+        std::vector<PetscReal> yi;
+        //! the entries that could not be integrated over the last step
+        std::vector<PetscInt> failedEntries;
+
+        /**
+         * Resize all storage for the number of cells
+         */
+        void Resize(PetscInt size, PetscInt numberSpecies);
+    };
+    OdeBatch batch;
+
+    //! advances all cells in the batch together, each with its own adaptive dt
+    std::unique_ptr<utilities::BatchedRosenbrockIntegrator<TotalEquations>> integrator;
+
+    /**
+     * Compute the soot chemistry rhs for a single point
+     * @param pointInfo
+     * @param density the constant density
+     * @param x the ode values
+     * @param yi the full yi for this point, the ode species are updated from x
+     * @param f the computed rhs
+     * @return
+     */
+    static PetscErrorCode SinglePointSootChemistryRHS(OdePointInformation &pointInfo, PetscReal density, const PetscReal x[], PetscReal yi[], PetscReal f[]);
+
+    /**
+     * Compute the rhs for the specified entries in the batch
+     * @param entries the batch entries to compute
+     * @param values the ode values stored equation major
+     * @param rhs the rhs stored equation major
+     * @return
+     */
+    PetscErrorCode ComputeBatchRHS(const std::vector<PetscInt> &entries, const std::vector<PetscReal> &values, std::vector<PetscReal> &rhs);
+
+    /**
+     * Advance every cell in the batch to endTime and log any cells that could not be integrated
+     * @param endTime
      * @return
      */
-    static PetscErrorCode SinglePointSootChemistryRHS(TS ts, PetscReal t, Vec X, Vec F, void *ptr);
+    PetscErrorCode IntegrateBatch(PetscReal endTime);
 
     /**
      * Add the pre computed soot source to the flow
@@ -35,7 +35,18 @@ ablate::finiteVolume::processes::SpeciesTransport::SpeciesTransport(std::shared_
 void ablate::finiteVolume::processes::SpeciesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
     if (!eos->GetSpeciesVariables().empty()) {
         if (fluxCalculator) {
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD}, {});
+            // The cell temperature is computed once per rhs evaluation in the aux field.  If available, use it as the starting guess when decoding each face state
+            if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+                flow.RegisterRHSFunction(AdvectionFlux,
+                                         &advectionData,
+                                         CompressibleFlowFields::DENSITY_YI_FIELD,
+                                         {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD},
+                                         {CompressibleFlowFields::TEMPERATURE_FIELD});
+                advectionData.computeTemperatureFromGuess = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+            } else {
+                flow.RegisterRHSFunction(
+                    AdvectionFlux, &advectionData, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD}, {});
+            }
             advectionData.computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
             advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
@@ -268,6 +279,7 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(
 
     const int EULER_FIELD = 0;
     const int YI_FIELD = 1;
+    const int TEMPERATURE_FIELD = 0;
 
     // Decode the left and right states
     PetscReal densityL;
@@ -280,7 +292,12 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(
         densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureL;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldL, auxL[aOff[TEMPERATURE_FIELD]], &temperatureL, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityL = 0.0;
@@ -302,7 +319,12 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(
         densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         PetscReal temperatureR;
 
-        PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        if (eulerAdvectionData->computeTemperatureFromGuess.function) {
+            PetscCall(eulerAdvectionData->computeTemperatureFromGuess.function(
+                fieldR, auxR[aOff[TEMPERATURE_FIELD]], &temperatureR, eulerAdvectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get()));
+        }
 
         // Get the velocity in this direction
         normalVelocityR = 0.0;
@@ -20,6 +20,8 @@ class SpeciesTransport : public FlowProcess {
 
         // EOS function calls
         eos::ThermodynamicFunction computeTemperature;
+        //! optional temperature function that uses the cell temperature (aux) as the initial guess for the face temperature
+        eos::ThermodynamicTemperatureFunction computeTemperatureFromGuess;
         eos::ThermodynamicTemperatureFunction computeInternalEnergy;
         eos::ThermodynamicTemperatureFunction computeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction computePressure;
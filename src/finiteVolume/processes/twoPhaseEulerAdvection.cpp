@@ -1,5 +1,6 @@
 #include "twoPhaseEulerAdvection.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
@@ -27,170 +28,37 @@ static inline PetscReal MagVector(PetscInt dim, const PetscReal *in) {
     return PetscSqrtReal(mag);
 }
 
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormFunctionGas(SNES snes, Vec x, Vec F, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructGas *)ctx;
-    const PetscReal *ax;
-    PetscReal *aF;
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    PetscReal e = decodeDataStruct->etot;
-    PetscReal cv1 = decodeDataStruct->cvg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    VecGetArray(F, &aF);
-    aF[0] = (gamma1 - 1) * eG * rhoG - (gamma2 - 1) * eL * rhoL + gamma2 * p02;  // pG - pL = 0, pressure equilibrium
-    // aF[0] = (gamma1 - 1) * eG * rhoG - (gamma2 - 1) * eL * rhoL + gamma2 * p02 + 1;  // pG - pL + sigma*kappa = 0, manual set sigmaKappa=1
-    aF[1] = eG * rhoL / cv1 - gamma2 / cp2 * (eL * rhoL - p02);  // TG - TL = 0, temperature equilibrium
-    aF[2] = Y1 * rho * rhoL + Y2 * rho * rhoG - rhoG * rhoL;
-    aF[3] = Y1 * eG + Y2 * eL - e;
-
-    VecRestoreArrayRead(x, &ax);
-    VecRestoreArray(F, &aF);
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormJacobianGas(SNES snes, Vec x, Mat J, Mat P, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructGas *)ctx;
-    const PetscReal *ax;
-    PetscReal v[16];
-    PetscInt row[4] = {0, 1, 2, 3}, col[4] = {0, 1, 2, 3};
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    //    PetscReal e = decodeDataStruct->etot;
-    PetscReal cv1 = decodeDataStruct->cvg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    //    PetscReal p02 = decodeDataStruct->p0l;
-
-    v[0] = (gamma1 - 1) * eG;
-    v[1] = -(gamma2 - 1) * eL;
-    v[2] = (gamma1 - 1) * rhoG;
-    v[3] = -(gamma2 - 1) * rhoL;
-    v[4] = 0.0;
-    v[5] = eG / cv1 - gamma2 * eG / cp2;
-    v[6] = rhoL / cv1;
-    v[7] = -gamma2 * rhoL / cp2;
-    v[8] = Y2 * rho - rhoL;
-    v[9] = Y1 * rho - rhoG;
-    v[10] = 0.0;
-    v[11] = 0.0;
-    v[12] = 0.0;
-    v[13] = 0.0;
-    v[14] = Y1;
-    v[15] = Y2;
-    VecRestoreArrayRead(x, &ax);
-    MatSetValues(P, 4, row, 4, col, v, INSERT_VALUES);
-    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
-    if (J != P) {
-        MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-    }
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormFunctionStiff(SNES snes, Vec x, Vec F, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructStiff *)ctx;
-    const PetscReal *ax;
-    PetscReal *aF;
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    PetscReal e = decodeDataStruct->etot;
-    PetscReal cp1 = decodeDataStruct->cpg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p01 = decodeDataStruct->p0g;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    VecGetArray(F, &aF);
-    aF[0] = (gamma1 - 1) * eG * rhoG - gamma1 * p01 - (gamma2 - 1) * eL * rhoL + gamma2 * p02;  // pG - pL = 0, pressure equilibrium
-    aF[1] = gamma1 / cp1 * rhoL * (eG * rhoG - p01) - gamma2 / cp2 * rhoG * (eL * rhoL - p02);  // TG - TL = 0, temperature equilibrium
-    aF[2] = Y1 * rho * rhoL + Y2 * rho * rhoG - rhoG * rhoL;
-    aF[3] = Y1 * eG + Y2 * eL - e;
-
-    VecRestoreArrayRead(x, &ax);
-    VecRestoreArray(F, &aF);
-    return 0;
-}
-
-PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormJacobianStiff(SNES snes, Vec x, Mat J, Mat P, void *ctx) {
-    auto decodeDataStruct = (DecodeDataStructStiff *)ctx;
-    const PetscReal *ax;
-    PetscReal v[16];
-    PetscInt row[4] = {0, 1, 2, 3}, col[4] = {0, 1, 2, 3};
-    VecGetArrayRead(x, &ax);
-    // ax = [rhog, rhol, eg, el]
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    PetscReal gamma1 = decodeDataStruct->gam1;
-    PetscReal gamma2 = decodeDataStruct->gam2;
-    PetscReal Y1 = decodeDataStruct->Yg;
-    PetscReal Y2 = decodeDataStruct->Yl;
-    PetscReal rho = decodeDataStruct->rhotot;
-    //    PetscReal e = decodeDataStruct->etot;
-    PetscReal cp1 = decodeDataStruct->cpg;
-    PetscReal cp2 = decodeDataStruct->cpl;
-    PetscReal p01 = decodeDataStruct->p0g;
-    PetscReal p02 = decodeDataStruct->p0l;
-
-    // need to check Jacobian, not getting correct solution
-    v[0] = (gamma1 - 1) * eG;
-    v[1] = -(gamma2 - 1) * eL;
-    v[2] = (gamma1 - 1) * rhoG;
-    v[3] = -(gamma2 - 1) * rhoL;
-    v[4] = gamma1 / cp1 * eG * rhoL - gamma2 / cp2 * eL * rhoL + gamma2 / cp2 * p02;
-    v[5] = gamma1 / cp1 * eG * rhoG - gamma1 / cp1 * p01 - gamma2 / cp2 * eL * rhoG;
-    v[6] = gamma1 / cp1 * rhoG * rhoL;
-    v[7] = -gamma2 / cp2 * rhoG * rhoL;
-    v[8] = Y2 * rho - rhoL;
-    v[9] = Y1 * rho - rhoG;
-    v[10] = 0.0;
-    v[11] = 0.0;
-    v[12] = 0.0;
-    v[13] = 0.0;
-    v[14] = Y1;
-    v[15] = Y2;
-    VecRestoreArrayRead(x, &ax);
-    MatSetValues(P, 4, row, 4, col, v, INSERT_VALUES);
-    MatAssemblyBegin(P, MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(P, MAT_FINAL_ASSEMBLY);
-    if (J != P) {
-        MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-    }
-    return 0;
+void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormEquilibriumStiff(const DecodeDataStructStiff &decodeDataStruct, const EquilibriumSolver::Vector &x, EquilibriumSolver::Vector &F,
+                                                                                   EquilibriumSolver::Matrix &J) {
+    // x = [rhog, rhol, eg, el]
+    PetscReal rhoG = x[0];
+    PetscReal rhoL = x[1];
+    PetscReal eG = x[2];
+    PetscReal eL = x[3];
+
+    PetscReal gamma1 = decodeDataStruct.gam1;
+    PetscReal gamma2 = decodeDataStruct.gam2;
+    PetscReal Y1 = decodeDataStruct.Yg;
+    PetscReal Y2 = decodeDataStruct.Yl;
+    PetscReal rho = decodeDataStruct.rhotot;
+    PetscReal e = decodeDataStruct.etot;
+    PetscReal cp1 = decodeDataStruct.cpg;
+    PetscReal cp2 = decodeDataStruct.cpl;
+    PetscReal p01 = decodeDataStruct.p0g;
+    PetscReal p02 = decodeDataStruct.p0l;
+
+    F[0] = (gamma1 - 1) * eG * rhoG - gamma1 * p01 - (gamma2 - 1) * eL * rhoL + gamma2 * p02;  // pG - pL = 0, pressure equilibrium
+    F[1] = gamma1 / cp1 * rhoL * (eG * rhoG - p01) - gamma2 / cp2 * rhoG * (eL * rhoL - p02);  // TG - TL = 0, temperature equilibrium
+    F[2] = Y1 * rho * rhoL + Y2 * rho * rhoG - rhoG * rhoL;
+    F[3] = Y1 * eG + Y2 * eL - e;
+
+    J[0] = {(gamma1 - 1) * eG, -(gamma2 - 1) * eL, (gamma1 - 1) * rhoG, -(gamma2 - 1) * rhoL};
+    J[1] = {gamma1 / cp1 * eG * rhoL - gamma2 / cp2 * eL * rhoL + gamma2 / cp2 * p02,
+            gamma1 / cp1 * eG * rhoG - gamma1 / cp1 * p01 - gamma2 / cp2 * eL * rhoG,
+            gamma1 / cp1 * rhoG * rhoL,
+            -gamma2 / cp2 * rhoG * rhoL};
+    J[2] = {Y2 * rho - rhoL, Y1 * rho - rhoG, 0.0, 0.0};
+    J[3] = {0.0, 0.0, Y1, Y2};
 }
 
 ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseEulerAdvection(std::shared_ptr<eos::EOS> eosTwoPhase, const std::shared_ptr<parameters::Parameters> &parametersIn,
@@ -235,18 +103,23 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Setup(ablate::fini
     flow.RegisterRHSFunction(CompressibleFlowComputeEulerFlux, this, CompressibleFlowFields::EULER_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterRHSFunction(CompressibleFlowComputeVFFlux, this, DENSITY_VF_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterComputeTimeStepFunction(ComputeCflTimeStep, &timeStepData, "cfl");
-    timeStepData.computeSpeedOfSound = eosTwoPhase->GetThermodynamicFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
+    timeStepData.decodeState = std::dynamic_pointer_cast<eos::TwoPhase>(eosTwoPhase)->GetDecodeStateFunction(flow.GetSubDomain().GetFields());
 
     // check to see if auxFieldUpdates needed to be added
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::VELOCITY_FIELD)) {
         flow.RegisterAuxFieldUpdate(UpdateAuxVelocityField2Gas, nullptr, std::vector<std::string>{CompressibleFlowFields::VELOCITY_FIELD}, {CompressibleFlowFields::EULER_FIELD});
     }
-    if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+    if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD) && flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
+        // decode each cell once for both the temperature and pressure
+        flow.RegisterAuxFieldUpdate(UpdateAuxTemperaturePressureField2Gas,
+                                    this,
+                                    std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD, CompressibleFlowFields::PRESSURE_FIELD},
+                                    {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
+    } else if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
         // add in aux update variables
         flow.RegisterAuxFieldUpdate(
             UpdateAuxTemperatureField2Gas, this, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
-    }
-    if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
+    } else if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
         // add in aux update variables
         flow.RegisterAuxFieldUpdate(
             UpdateAuxPressureField2Gas, this, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD});
@@ -362,8 +235,9 @@ double ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeCflTimeSt
             PetscReal rho = euler[CompressibleFlowFields::RHO];
 
             // Get the speed of sound from the eos
-            PetscReal a;
-            timeStepData->computeSpeedOfSound.function(conserved, &a, timeStepData->computeSpeedOfSound.context.get()) >> utilities::PetscUtilities::checkError;
+            eos::TwoPhase::DecodedState state;
+            timeStepData->decodeState.function(conserved, &state, timeStepData->decodeState.context.get()) >> utilities::PetscUtilities::checkError;
+            PetscReal a = state.speedOfSound;
 
             PetscReal velSum = 0.0;
             for (PetscInt d = 0; d < dim; d++) {
@@ -380,8 +254,8 @@ double ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ComputeCflTimeSt
 }
 
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CompressibleFlowComputeEulerFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL,
-                                                                                                         const PetscScalar *fieldR, const PetscInt *aOff, const PetscScalar *auxL,
-                                                                                                         const PetscScalar *auxR, PetscScalar *flux, void *ctx) {
+                                                                                       const PetscScalar *fieldR, const PetscInt *aOff, const PetscScalar *auxL,
+                                                                                       const PetscScalar *auxR, PetscScalar *flux, void *ctx) {
     PetscFunctionBeginUser;
     auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
     // Compute the norm of cell face
@@ -389,7 +263,7 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     NormVector(dim, fg->normal, norm);
     const PetscReal areaMag = MagVector(dim, fg->normal);
 
-    // Decode left and right states
+    // Decode left and right states, these are reused by the volume fraction flux for the same face
     PetscReal densityL;
     PetscReal densityG_L;
     PetscReal densityL_L;
@@ -405,25 +279,25 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscReal pL;  // pressure equilibrium
     PetscReal tL;
     PetscReal alphaL;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldL,
-                                                              norm,
-                                                              &densityL,
-                                                              &densityG_L,
-                                                              &densityL_L,
-                                                              &normalVelocityL,
-                                                              velocityL,
-                                                              &internalEnergyL,
-                                                              &internalEnergyG_L,
-                                                              &internalEnergyL_L,
-                                                              &aG_L,
-                                                              &aL_L,
-                                                              &MG_L,
-                                                              &ML_L,
-                                                              &pL,
-                                                              &tL,
-                                                              &alphaL);
+    twoPhaseEulerAdvection->DecodeFaceState(dim,
+                                            uOff,
+                                            fieldL,
+                                            norm,
+                                            &densityL,
+                                            &densityG_L,
+                                            &densityL_L,
+                                            &normalVelocityL,
+                                            velocityL,
+                                            &internalEnergyL,
+                                            &internalEnergyG_L,
+                                            &internalEnergyL_L,
+                                            &aG_L,
+                                            &aL_L,
+                                            &MG_L,
+                                            &ML_L,
+                                            &pL,
+                                            &tL,
+                                            &alphaL);
 
     PetscReal densityR;
     PetscReal densityG_R;
@@ -440,25 +314,25 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscReal pR;
     PetscReal tR;
     PetscReal alphaR;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldR,
-                                                              norm,
-                                                              &densityR,
-                                                              &densityG_R,
-                                                              &densityL_R,
-                                                              &normalVelocityR,
-                                                              velocityR,
-                                                              &internalEnergyR,
-                                                              &internalEnergyG_R,
-                                                              &internalEnergyL_R,
-                                                              &aG_R,
-                                                              &aL_R,
-                                                              &MG_R,
-                                                              &ML_R,
-                                                              &pR,
-                                                              &tR,
-                                                              &alphaR);
+    twoPhaseEulerAdvection->DecodeFaceState(dim,
+                                            uOff,
+                                            fieldR,
+                                            norm,
+                                            &densityR,
+                                            &densityG_R,
+                                            &densityL_R,
+                                            &normalVelocityR,
+                                            velocityR,
+                                            &internalEnergyR,
+                                            &internalEnergyG_R,
+                                            &internalEnergyL_R,
+                                            &aG_R,
+                                            &aL_R,
+                                            &MG_R,
+                                            &ML_R,
+                                            &pR,
+                                            &tR,
+                                            &alphaR);
 
     // get the face values
     PetscReal massFluxGG;
@@ -621,8 +495,8 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscFunctionReturn(0);
 }
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CompressibleFlowComputeVFFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL,
-                                                                                                      const PetscScalar *fieldR, const PetscInt *aOff, const PetscScalar *auxL, const PetscScalar *auxR,
-                                                                                                      PetscScalar *flux, void *ctx) {
+                                                                                    const PetscScalar *fieldR, const PetscInt *aOff, const PetscScalar *auxL, const PetscScalar *auxR,
+                                                                                    PetscScalar *flux, void *ctx) {
     PetscFunctionBeginUser;
     auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
 
@@ -631,7 +505,7 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     NormVector(dim, fg->normal, norm);
     const PetscReal areaMag = MagVector(dim, fg->normal);
 
-    //     Decode left and right states
+    //     Decode left and right states, these are reused from the euler flux for the same face
     PetscReal densityL;
     PetscReal densityG_L;
     PetscReal densityL_L;
@@ -647,25 +521,25 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscReal pL;  // pressure equilibrium
     PetscReal tL;
     PetscReal alphaL;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldL,
-                                                              norm,
-                                                              &densityL,
-                                                              &densityG_L,
-                                                              &densityL_L,
-                                                              &normalVelocityL,
-                                                              velocityL,
-                                                              &internalEnergyL,
-                                                              &internalEnergyG_L,
-                                                              &internalEnergyL_L,
-                                                              &aG_L,
-                                                              &aL_L,
-                                                              &MG_L,
-                                                              &ML_L,
-                                                              &pL,
-                                                              &tL,
-                                                              &alphaL);
+    twoPhaseEulerAdvection->DecodeFaceState(dim,
+                                            uOff,
+                                            fieldL,
+                                            norm,
+                                            &densityL,
+                                            &densityG_L,
+                                            &densityL_L,
+                                            &normalVelocityL,
+                                            velocityL,
+                                            &internalEnergyL,
+                                            &internalEnergyG_L,
+                                            &internalEnergyL_L,
+                                            &aG_L,
+                                            &aL_L,
+                                            &MG_L,
+                                            &ML_L,
+                                            &pL,
+                                            &tL,
+                                            &alphaL);
 
     PetscReal densityR;
     PetscReal densityG_R;
@@ -682,25 +556,25 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscReal pR;
     PetscReal tR;
     PetscReal alphaR;
-    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(dim,
-                                                              uOff,
-                                                              fieldR,
-                                                              norm,
-                                                              &densityR,
-                                                              &densityG_R,
-                                                              &densityL_R,
-                                                              &normalVelocityR,
-                                                              velocityR,
-                                                              &internalEnergyR,
-                                                              &internalEnergyG_R,
-                                                              &internalEnergyL_R,
-                                                              &aG_R,
-                                                              &aL_R,
-                                                              &MG_R,
-                                                              &ML_R,
-                                                              &pR,
-                                                              &tR,
-                                                              &alphaR);
+    twoPhaseEulerAdvection->DecodeFaceState(dim,
+                                            uOff,
+                                            fieldR,
+                                            norm,
+                                            &densityR,
+                                            &densityG_R,
+                                            &densityL_R,
+                                            &normalVelocityR,
+                                            velocityR,
+                                            &internalEnergyR,
+                                            &internalEnergyG_R,
+                                            &internalEnergyL_R,
+                                            &aG_R,
+                                            &aL_R,
+                                            &MG_R,
+                                            &ML_R,
+                                            &pR,
+                                            &tR,
+                                            &alphaR);
 
     // get the face values
     PetscReal massFlux;
@@ -797,6 +671,106 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAu
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAuxTemperaturePressureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[],
+                                                                                                              const PetscScalar *conservedValues, const PetscInt aOff[], PetscScalar *auxField,
+                                                                                                              void *ctx) {
+    PetscFunctionBeginUser;
+    auto twoPhaseEulerAdvection = (TwoPhaseEulerAdvection *)ctx;
+
+    // For cell center, the norm is unity
+    PetscReal norm[3];
+    norm[0] = 1;
+    norm[1] = 1;
+    norm[2] = 1;
+
+    PetscReal density;
+    PetscReal densityG;
+    PetscReal densityL;
+    PetscReal normalVelocity;  // uniform velocity in cell
+    PetscReal velocity[3];
+    PetscReal internalEnergy;
+    PetscReal internalEnergyG;
+    PetscReal internalEnergyL;
+    PetscReal aG;
+    PetscReal aL;
+    PetscReal MG;
+    PetscReal ML;
+    PetscReal p;  // pressure equilibrium
+    PetscReal T;  // temperature equilibrium, Tg = TL
+    PetscReal alpha;
+    twoPhaseEulerAdvection->decoder->DecodeTwoPhaseEulerState(
+        dim, uOff, conservedValues, norm, &density, &densityG, &densityL, &normalVelocity, velocity, &internalEnergy, &internalEnergyG, &internalEnergyL, &aG, &aL, &MG, &ML, &p, &T, &alpha);
+    auxField[aOff[0]] = T;
+    auxField[aOff[1]] = p;
+    PetscFunctionReturn(0);
+}
+
+void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::DecodeFaceState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density,
+                                                                            PetscReal *densityG, PetscReal *densityL, PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy,
+                                                                            PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL, PetscReal *MG, PetscReal *ML,
+                                                                            PetscReal *p, PetscReal *T, PetscReal *alpha) {
+    // the decode only depends upon the volume fraction, densityVF, and euler values and the normal
+    std::array<PetscReal, 10> inputs;
+    std::size_t numberInputs = 0;
+    inputs[numberInputs++] = conservedValues[uOff[0]];
+    inputs[numberInputs++] = conservedValues[uOff[1]];
+    for (PetscInt c = 0; c < dim + 2; c++) {
+        inputs[numberInputs++] = conservedValues[uOff[2] + c];
+    }
+    for (PetscInt d = 0; d < dim; d++) {
+        inputs[numberInputs++] = normal[d];
+    }
+
+    auto state = std::find_if(decodedFaceStates.begin(), decodedFaceStates.end(), [&inputs, numberInputs](const auto &decodedFaceState) {
+        return decodedFaceState.numberInputs == numberInputs && std::equal(inputs.begin(), inputs.begin() + numberInputs, decodedFaceState.inputs.begin());
+    });
+    if (state == decodedFaceStates.end()) {
+        // replace the oldest decode, it is only marked valid once the decode succeeds
+        state = decodedFaceStates.begin() + nextDecodedFaceState;
+        nextDecodedFaceState = (nextDecodedFaceState + 1) % decodedFaceStates.size();
+        state->numberInputs = 0;
+        decoder->DecodeTwoPhaseEulerState(dim,
+                                          uOff,
+                                          conservedValues,
+                                          normal,
+                                          &state->density,
+                                          &state->densityG,
+                                          &state->densityL,
+                                          &state->normalVelocity,
+                                          state->velocity,
+                                          &state->internalEnergy,
+                                          &state->internalEnergyG,
+                                          &state->internalEnergyL,
+                                          &state->aG,
+                                          &state->aL,
+                                          &state->MG,
+                                          &state->ML,
+                                          &state->p,
+                                          &state->T,
+                                          &state->alpha);
+        state->inputs = inputs;
+        state->numberInputs = numberInputs;
+    }
+
+    *density = state->density;
+    *densityG = state->densityG;
+    *densityL = state->densityL;
+    *normalVelocity = state->normalVelocity;
+    for (PetscInt d = 0; d < dim; d++) {
+        velocity[d] = state->velocity[d];
+    }
+    *internalEnergy = state->internalEnergy;
+    *internalEnergyG = state->internalEnergyG;
+    *internalEnergyL = state->internalEnergyL;
+    *aG = state->aG;
+    *aL = state->aL;
+    *MG = state->MG;
+    *ML = state->ML;
+    *p = state->p;
+    *T = state->T;
+    *alpha = state->alpha;
+}
+
 std::shared_ptr<ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseDecoder> ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(
     PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid) {
     // check if both perfect gases, use analytical solution
@@ -1198,21 +1172,6 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
     PetscReal gamma1 = eosGas->GetSpecificHeatRatio();
     PetscReal gamma2 = eosLiquid->GetSpecificHeatRatio();
 
-    SNES snes;
-    Vec x, r;
-    Mat J;
-    VecCreate(PETSC_COMM_SELF, &x);
-    VecSetSizes(x, PETSC_DECIDE, 4);
-    VecSetFromOptions(x);
-    VecSet(x, (*density));  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
-    VecDuplicate(x, &r);
-
-    MatCreate(PETSC_COMM_SELF, &J);
-    MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, 4, 4);
-    MatSetFromOptions(J);
-    MatSetUp(J);
-
-    SNESCreate(PETSC_COMM_SELF, &snes);
     DecodeDataStructStiff decodeDataStruct{
         .etot = (*internalEnergy),
         .rhotot = (*density),
@@ -1225,23 +1184,30 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
         .p0g = p01,
         .p0l = p02,
     };
-    SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct);
-    SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct);
-    SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000);  // refine relative tolerance for more accurate pressure value
-    SNESSetFromOptions(snes);
-    SNESSolve(snes, NULL, x);
-
-    const PetscScalar *ax;
-    VecGetArrayRead(x, &ax);
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    SNESDestroy(&snes);
-    VecDestroy(&x);
-    VecDestroy(&r);
-    MatDestroy(&J);
+    auto equilibrium = [&decodeDataStruct](const EquilibriumSolver::Vector &x, EquilibriumSolver::Vector &F, EquilibriumSolver::Matrix &J) {
+        FormEquilibriumStiff(decodeDataStruct, x, F, J);
+    };
+    auto physical = [](const EquilibriumSolver::Vector &x) { return x[0] > 0.0 && x[1] > 0.0 && x[2] > 0.0 && x[3] > 0.0; };
+
+    // start from the conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho], so the result does not depend on which cells/faces were decoded before.
+    // As with the previous SNES solve, the last iterate is used if the solve does not converge.
+    EquilibriumSolver::Vector x;
+    x.fill(*density);
+    auto result = EquilibriumSolver::Solve(equilibrium, x, 1E-8, 1E-12, 1E-8, 100, physical);
+    if (!result.converged) {
+        numberUnconvergedDecodes++;
+        PetscInfo(nullptr,
+                  "StiffenedGas/StiffenedGas DecodeState did not converge after %" PetscInt_FMT " iterations (residual norm %g), %" PetscInt_FMT " unconverged decodes\n",
+                  result.iterations,
+                  (double)result.residualNorm,
+                  numberUnconvergedDecodes) >>
+            utilities::PetscUtilities::checkError;
+    }
+
+    PetscReal rhoG = x[0];
+    PetscReal rhoL = x[1];
+    PetscReal eG = x[2];
+    PetscReal eL = x[3];
 
     PetscReal etG = eG + ke;
     PetscReal etL = eL + ke;
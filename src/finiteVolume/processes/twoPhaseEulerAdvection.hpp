@@ -2,12 +2,14 @@
 #define ABLATELIBRARY_TWOPHASEEULERADVECTION_HPP
 
 #include <petsc.h>
+#include <array>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
 #include "eos/twoPhase.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
 #include "process.hpp"
+#include "utilities/newtonSolver.hpp"
 
 namespace ablate::finiteVolume::processes {
 
@@ -18,22 +20,11 @@ class TwoPhaseEulerAdvection : public Process {
 
     struct TimeStepData {
         PetscReal cfl;
-        eos::ThermodynamicFunction computeSpeedOfSound;
+        eos::TwoPhase::DecodeStateFunction decodeState;
     };
     TimeStepData timeStepData;
 
    private:
-    struct DecodeDataStructGas {
-        PetscReal etot;
-        PetscReal rhotot;
-        PetscReal Yg;
-        PetscReal Yl;
-        PetscReal gam1;
-        PetscReal gam2;
-        PetscReal cvg;
-        PetscReal cpl;
-        PetscReal p0l;
-    };
     struct DecodeDataStructStiff {
         PetscReal etot;
         PetscReal rhotot;
@@ -46,10 +37,13 @@ class TwoPhaseEulerAdvection : public Process {
         PetscReal p0g;
         PetscReal p0l;
     };
-    static PetscErrorCode FormFunctionGas(SNES snes, Vec x, Vec F, void *ctx);
-    static PetscErrorCode FormJacobianGas(SNES snes, Vec x, Mat J, Mat P, void *ctx);
-    static PetscErrorCode FormFunctionStiff(SNES snes, Vec x, Vec F, void *ctx);
-    static PetscErrorCode FormJacobianStiff(SNES snes, Vec x, Mat J, Mat P, void *ctx);
+
+    using EquilibriumSolver = utilities::NewtonSolver<4>;
+
+    /**
+     * Computes the pressure/temperature equilibrium residual and analytic jacobian for two stiffened gases, x = [rhoG, rhoL, eG, eL]
+     */
+    static void FormEquilibriumStiff(const DecodeDataStructStiff &decodeDataStruct, const EquilibriumSolver::Vector &x, EquilibriumSolver::Vector &F, EquilibriumSolver::Matrix &J);
 
     PetscErrorCode MultiphaseFlowPreStage(TS flowTs, ablate::solver::Solver &flow, PetscReal stagetime);
     /**
@@ -60,6 +54,12 @@ class TwoPhaseEulerAdvection : public Process {
         virtual void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG,
                                               PetscReal *densityL, PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL,
                                               PetscReal *aG, PetscReal *aL, PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) = 0;
+
+        /**
+         * The number of decodes where the equilibrium solve did not converge and the last iterate was used
+         */
+        [[nodiscard]] virtual PetscInt GetNumberUnconvergedDecodes() const { return 0; }
+
         virtual ~TwoPhaseDecoder() = default;
     };
 
@@ -156,12 +156,17 @@ class TwoPhaseEulerAdvection : public Process {
         eos::ThermodynamicTemperatureFunction liquidComputeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction liquidComputePressure;
 
+        //! the number of decodes where the equilibrium solve did not converge
+        PetscInt numberUnconvergedDecodes = 0;
+
        public:
         StiffenedGasStiffenedGasDecoder(PetscInt dim, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos1, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos2);
 
         void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
                                       PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL,
                                       PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) override;
+
+        [[nodiscard]] PetscInt GetNumberUnconvergedDecodes() const override { return numberUnconvergedDecodes; }
     };
 
     const std::shared_ptr<eos::EOS> eosTwoPhase;
@@ -177,6 +182,41 @@ class TwoPhaseEulerAdvection : public Process {
      */
     std::shared_ptr<TwoPhaseDecoder> decoder;
 
+    /**
+     * A decoded face state and the face values used to compute it
+     */
+    struct DecodedFaceState {
+        //! the volume fraction, densityVF, euler, and normal values used for the decode
+        std::array<PetscReal, 10> inputs = {};
+        std::size_t numberInputs = 0;
+        PetscReal density;
+        PetscReal densityG;
+        PetscReal densityL;
+        PetscReal normalVelocity;
+        PetscReal velocity[3];
+        PetscReal internalEnergy;
+        PetscReal internalEnergyG;
+        PetscReal internalEnergyL;
+        PetscReal aG;
+        PetscReal aL;
+        PetscReal MG;
+        PetscReal ML;
+        PetscReal p;
+        PetscReal T;
+        PetscReal alpha;
+    };
+
+    //! the euler and volume fraction fluxes are computed one after the other with the same left/right face values, so the last two decodes are kept
+    std::array<DecodedFaceState, 2> decodedFaceStates;
+    std::size_t nextDecodedFaceState = 0;
+
+    /**
+     * Decode the face values with the decoder, reusing the result if the same face values (and normal) were one of the last two decodes
+     */
+    void DecodeFaceState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
+                         PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL, PetscReal *MG,
+                         PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha);
+
    public:
     static PetscErrorCode UpdateAuxTemperatureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
                                                         PetscScalar *auxField, void *ctx);
@@ -184,6 +224,9 @@ class TwoPhaseEulerAdvection : public Process {
     static PetscErrorCode UpdateAuxPressureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
                                                      PetscScalar *auxField, void *ctx);
 
+    static PetscErrorCode UpdateAuxTemperaturePressureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues,
+                                                                const PetscInt aOff[], PetscScalar *auxField, void *ctx);
+
     static PetscErrorCode UpdateAuxVelocityField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
                                                      PetscScalar *auxField, void *ctx);
 
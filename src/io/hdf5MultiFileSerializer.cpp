@@ -7,8 +7,9 @@
 #include "environment/runEnvironment.hpp"
 #include "generators.hpp"
 
-ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options)
-    : interval(std::move(interval)), rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()) {
+ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, const std::shared_ptr<parameters::Parameters>& options,
+                                                             const std::string& stagingDirectory)
+    : interval(std::move(interval)), rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory()), stagingDirectory(stagingDirectory) {
     // Load the metadata from the file is available, otherwise set to 0
     auto restartFilePath = rootOutputDirectory / "restart.rst";
 
@@ -43,6 +44,13 @@ ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<abl
 }
 
 ablate::io::Hdf5MultiFileSerializer::~Hdf5MultiFileSerializer() {
+    // make sure that the last output has been moved before generating the xdmf files.  A destructor cannot throw, so report any error from the background move
+    try {
+        WaitForPendingOutput();
+    } catch (std::exception& exception) {
+        std::cerr << "Error: unable to move the staged output to " << rootOutputDirectory << ", the restart file was not updated for this output: " << exception.what() << std::endl;
+    }
+
     // save each serializer
     for (const std::string& id : postProcessesIds) {
         std::vector<std::filesystem::path> inputFilePaths;
@@ -138,30 +146,61 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
         hdf5Serializer->sequenceNumber++;
         TSGetTimeStep(ts, &(hdf5Serializer->dt)) >> utilities::PetscUtilities::checkError;
 
-        // Save this to a file
-        hdf5Serializer->SaveMetadata(ts);
+        // the metadata is only written by the root once the output files are complete
+        PetscMPIInt rank;
+        PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank));
+        auto metadata = hdf5Serializer->CreateMetadata();
+
+        // apply back-pressure, the previous output must be moved out of the staging directory before writing again
+        const bool staged = !hdf5Serializer->stagingDirectory.empty();
+        if (staged) {
+            hdf5Serializer->StartEvent("WaitForPendingOutput");
+            try {
+                hdf5Serializer->WaitForPendingOutput();
+            } catch (std::exception& exception) {
+                SETERRQ(PETSC_COMM_SELF, PETSC_ERR_FILE_WRITE, "Unable to move the staged output: %s", exception.what());
+            }
+            hdf5Serializer->EndEvent();
+        }
+        std::vector<std::pair<std::filesystem::path, std::filesystem::path>> stagedFiles;
 
         // save each serializer
         for (auto& serializablePtr : hdf5Serializer->serializables) {
             if (auto serializableObject = serializablePtr.lock()) {
                 // Create an output path
-
-                PetscViewer petscViewer = nullptr;
-                hdf5Serializer->StartEvent("PetscViewerHDF5Open");
+                std::filesystem::path filePath;
+                MPI_Comm viewerComm;
                 switch (serializableObject->Serialize()) {
-                    case Serializable::SerializerType::collective: {
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
-                    } break;
-                    case Serializable::SerializerType::serial: {
-                        PetscMPIInt rank;
-                        MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank);
-                        auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId(), rank);
-                        PetscCall(PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
-                    } break;
+                    case Serializable::SerializerType::collective:
+                        filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
+                        viewerComm = PETSC_COMM_WORLD;
+                        break;
+                    case Serializable::SerializerType::serial:
+                        filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId(), rank);
+                        viewerComm = PETSC_COMM_SELF;
+                        break;
                     default:
                         throw std::invalid_argument("Unable to determine Serializer Type");
                 }
+
+                // collective files are written to the same relative location in the staging directory and moved by the root rank.  The per rank serial files are
+                // written directly so that the root can update the metadata without waiting on the other ranks
+                auto writePath = filePath;
+                if (staged && viewerComm == PETSC_COMM_WORLD) {
+                    writePath = hdf5Serializer->stagingDirectory / std::filesystem::relative(filePath, hdf5Serializer->rootOutputDirectory);
+                    std::error_code errorCode;
+                    std::filesystem::create_directories(writePath.parent_path(), errorCode);
+                    if (errorCode) {
+                        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_FILE_OPEN, "Unable to create the staging directory %s: %s", writePath.parent_path().string().c_str(), errorCode.message().c_str());
+                    }
+                    if (rank == 0) {
+                        stagedFiles.emplace_back(writePath, filePath);
+                    }
+                }
+
+                PetscViewer petscViewer = nullptr;
+                hdf5Serializer->StartEvent("PetscViewerHDF5Open");
+                PetscCall(PetscViewerHDF5Open(viewerComm, writePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
                 hdf5Serializer->EndEvent();
 
                 // set the petsc options if provided
@@ -179,12 +218,20 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
                 hdf5Serializer->EndEvent();
             }
         }
+
+        // Save the metadata to a file, or move the staged files and then save the metadata in the background
+        if (rank == 0) {
+            if (staged) {
+                hdf5Serializer->pendingOutput = std::async(std::launch::async, &Hdf5MultiFileSerializer::MoveStagedOutput, hdf5Serializer, std::move(stagedFiles), std::move(metadata));
+            } else {
+                hdf5Serializer->SaveMetadata(metadata);
+            }
+        }
     }
     PetscFunctionReturn(0);
 }
 
-void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(TS ts) const {
-    PetscFunctionBeginUser;
+std::string ablate::io::Hdf5MultiFileSerializer::CreateMetadata() const {
     YAML::Emitter out;
     out << YAML::BeginMap;
     out << YAML::Key << "time";
@@ -198,22 +245,38 @@ void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(TS ts) const {
     out << YAML::Key << "version";
     out << YAML::Value << std::string(environment::RunEnvironment::GetVersion());
     out << YAML::EndMap;
+    return out.c_str();
+}
 
-    int rank;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank) >> utilities::PetscUtilities::checkError;
-    if (rank == 0) {
-        auto restartFilePath = rootOutputDirectory / "restart.rst";
-        // keep a back of the restart file incase writing fails
-        if (exists(restartFilePath)) {
-            auto backupRestartFilePath = rootOutputDirectory / "restart.bak";
-            std::filesystem::copy(restartFilePath, backupRestartFilePath, std::filesystem::copy_options::overwrite_existing);
-        }
-        std::ofstream restartFile;
-        restartFile.open(restartFilePath);
-        restartFile << out.c_str();
-        restartFile.close();
+void ablate::io::Hdf5MultiFileSerializer::SaveMetadata(const std::string& metadata) const {
+    auto restartFilePath = rootOutputDirectory / "restart.rst";
+    // keep a back of the restart file incase writing fails
+    if (exists(restartFilePath)) {
+        auto backupRestartFilePath = rootOutputDirectory / "restart.bak";
+        std::filesystem::copy(restartFilePath, backupRestartFilePath, std::filesystem::copy_options::overwrite_existing);
+    }
+    std::ofstream restartFile;
+    restartFile.open(restartFilePath);
+    restartFile << metadata;
+    restartFile.close();
+}
+
+void ablate::io::Hdf5MultiFileSerializer::MoveStagedOutput(const std::vector<std::pair<std::filesystem::path, std::filesystem::path>>& stagedFiles, const std::string& metadata) const {
+    for (const auto& [stagingPath, outputPath] : stagedFiles) {
+        // copy to a temporary name so that a partial file is never seen in the output directory
+        auto temporaryPath = outputPath;
+        temporaryPath += ".staging";
+        std::filesystem::copy_file(stagingPath, temporaryPath, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::rename(temporaryPath, outputPath);
+        std::filesystem::remove(stagingPath);
+    }
+    SaveMetadata(metadata);
+}
+
+void ablate::io::Hdf5MultiFileSerializer::WaitForPendingOutput() {
+    if (pendingOutput.valid()) {
+        pendingOutput.get();
     }
-    PetscFunctionReturnVoid();
 }
 
 void ablate::io::Hdf5MultiFileSerializer::RestoreTS(TS ts) {
@@ -241,4 +304,6 @@ std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(con
 #include "registrar.hpp"
 REGISTER(ablate::io::Serializer, ablate::io::Hdf5MultiFileSerializer, "serializer for IO that writes each time to a separate hdf5 file",
          ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
-         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"));
+         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"),
+         OPT(std::string, "stagingDirectory",
+             "optional fast directory (such as a burst buffer) shared by all ranks.  Each output is written here and then moved to the output directory in the background."));
@@ -3,8 +3,10 @@
 
 #include <petscviewer.h>
 #include <filesystem>
+#include <future>
 #include <io/interval/interval.hpp>
 #include <memory>
+#include <utility>
 #include <vector>
 #include "parameters/parameters.hpp"
 #include "serializable.hpp"
@@ -40,11 +42,26 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     // an optional petscOptions that is used for this solver
     PetscOptions petscOptions = nullptr;
 
+    //! optional fast directory each output is written to before being moved to the output directory in the background
+    const std::filesystem::path stagingDirectory;
+
+    //! the background move of the previous output on the root rank, only a single output may be in flight
+    std::future<void> pendingOutput;
+
     //! Petsc function used to save the system state
     static PetscErrorCode Hdf5MultiFileSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
-    //! Private functions to load and save the ts metadata data
-    void SaveMetadata(TS ts) const;
+    //! Private functions to create the ts metadata data
+    [[nodiscard]] std::string CreateMetadata() const;
+
+    //! Private functions to save the ts metadata data, should only be called on the root rank
+    void SaveMetadata(const std::string& metadata) const;
+
+    //! move each staged file (stagingPath, outputPath) into the output directory and then write the metadata
+    void MoveStagedOutput(const std::vector<std::pair<std::filesystem::path, std::filesystem::path>>& stagedFiles, const std::string& metadata) const;
+
+    //! wait for any in flight output to finish, rethrowing any error that occurred
+    void WaitForPendingOutput();
 
     //! Private functions to determine the path name when using collective
     [[nodiscard]] std::filesystem::path GetOutputFilePath(const std::string& objectId) const;
@@ -58,8 +75,13 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
    public:
     /**
      * Separates into multiple files to solve some io issues
+     * @param interval
+     * @param options petsc options passed to each viewer
+     * @param stagingDirectory optional fast directory (such as a burst buffer) used to write each collective output.  The files are moved to the output directory
+     * in the background so that the time stepping only waits for the staging write.  The restart metadata is only updated once the move is complete.
      */
-    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr);
+    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, const std::shared_ptr<parameters::Parameters>& options = nullptr,
+                                     const std::string& stagingDirectory = {});
 
     /**
      * Allow file cleanup
@@ -0,0 +1,329 @@
+#include "hdf5VisualizationSerializer.hpp"
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <utility>
+#include "environment/runEnvironment.hpp"
+#include "generators.hpp"
+#include "utilities/mpiUtilities.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace {
+/**
+ * Throws if the hdf5 call returned an error
+ */
+template <typename T>
+T CheckHdf5(T result, const std::string& message) {
+    if (result < 0) {
+        throw std::runtime_error("Hdf5VisualizationSerializer: " + message);
+    }
+    return result;
+}
+}  // namespace
+
+ablate::io::Hdf5VisualizationSerializer::Hdf5VisualizationSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<Serializer> restartSerializer,
+                                                                     std::vector<std::string> doublePrecisionFields, int deflateLevel, int scaleOffsetDigits)
+    : interval(std::move(interval)),
+      restartSerializer(std::move(restartSerializer)),
+      doublePrecisionFields(std::move(doublePrecisionFields)),
+      deflateLevel(deflateLevel),
+      scaleOffsetDigits(scaleOffsetDigits),
+      rootOutputDirectory(environment::RunEnvironment::Get().GetOutputDirectory() / "visualization") {
+    if (deflateLevel < 0 || deflateLevel > 9) {
+        throw std::invalid_argument("The Hdf5VisualizationSerializer deflateLevel must be between 0 and 9.");
+    }
+    if (scaleOffsetDigits < 0) {
+        throw std::invalid_argument("The Hdf5VisualizationSerializer scaleOffsetDigits must be non-negative.");
+    }
+}
+
+ablate::io::Hdf5VisualizationSerializer::~Hdf5VisualizationSerializer() {
+    for (const std::string& id : postProcessesIds) {
+        std::vector<std::filesystem::path> inputFilePaths;
+
+        auto directoryPath = GetOutputDirectoryPath(id);
+        for (const auto& file : std::filesystem::directory_iterator(directoryPath)) {
+            if (file.path().extension() == extension) {
+                inputFilePaths.push_back(file.path());
+            }
+        }
+        if (inputFilePaths.empty()) {
+            continue;
+        }
+
+        // sort the paths
+        std::sort(inputFilePaths.begin(), inputFilePaths.end());
+
+        // run the convert function
+        std::filesystem::path outputFile = directoryPath / (id + ".xmf");
+        xdmfGenerator::Generate(inputFilePaths, outputFile);
+    }
+}
+
+void ablate::io::Hdf5VisualizationSerializer::Register(std::weak_ptr<Serializable> serializable) {
+    if (restartSerializer) {
+        restartSerializer->Register(serializable);
+    }
+    serializables.push_back(serializable);
+
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> utilities::MpiUtilities::checkError;
+
+    if (auto serializableObject = serializable.lock()) {
+        // Create an output directory
+        if (rank == 0) {
+            std::filesystem::create_directories(GetOutputDirectoryPath(serializableObject->GetId()));
+        }
+        MPI_Barrier(PETSC_COMM_WORLD);
+
+        // only the collective files are combined into a single xdmf file
+        if (rank == 0 && serializableObject->Serialize() == Serializable::SerializerType::collective) {
+            postProcessesIds.push_back(serializableObject->GetId());
+        }
+    }
+}
+
+void ablate::io::Hdf5VisualizationSerializer::RestoreTS(TS ts) {
+    if (restartSerializer) {
+        restartSerializer->RestoreTS(ts);
+    }
+}
+
+PetscErrorCode ablate::io::Hdf5VisualizationSerializer::Hdf5VisualizationSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto visualizationSerializer = (Hdf5VisualizationSerializer*)ctx;
+
+    // always write the restart files first
+    if (visualizationSerializer->restartSerializer) {
+        PetscCall(visualizationSerializer->restartSerializer->Serialize(ts, steps, time, u));
+    }
+
+    // Make sure that the same timeStep is not output more than once
+    if (steps <= visualizationSerializer->timeStep) {
+        PetscFunctionReturn(0);
+    }
+
+    if (visualizationSerializer->interval->Check(PetscObjectComm((PetscObject)ts), steps, time)) {
+        visualizationSerializer->timeStep = steps;
+
+        PetscMPIInt rank;
+        PetscCallMPI(MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank));
+
+        for (auto& serializablePtr : visualizationSerializer->serializables) {
+            if (auto serializableObject = serializablePtr.lock()) {
+                const bool collective = serializableObject->Serialize() == Serializable::SerializerType::collective;
+                auto filePath = visualizationSerializer->GetOutputFilePath(serializableObject->GetId(), steps, collective ? -1 : rank);
+
+                PetscViewer petscViewer = nullptr;
+                visualizationSerializer->StartEvent("PetscViewerHDF5Open");
+                PetscCall(PetscViewerHDF5Open(collective ? PETSC_COMM_WORLD : PETSC_COMM_SELF, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer));
+                visualizationSerializer->EndEvent();
+
+                visualizationSerializer->StartEvent("Save");
+                // NOTE: as far as the output file the sequence number is always zero because it is a new file
+                PetscCall(serializableObject->Save(petscViewer, 0, time));
+                visualizationSerializer->EndEvent();
+
+                visualizationSerializer->StartEvent("PetscViewerHDF5Destroy");
+                PetscCall(PetscViewerDestroy(&petscViewer));
+                visualizationSerializer->EndEvent();
+
+                // the closed file is rewritten by a single rank
+                if (!collective || rank == 0) {
+                    visualizationSerializer->StartEvent("CompressFile");
+                    try {
+                        visualizationSerializer->CompressFile(filePath);
+                    } catch (std::exception& exception) {
+                        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_FILE_WRITE, "%s", exception.what());
+                    }
+                    visualizationSerializer->EndEvent();
+                }
+            }
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+std::filesystem::path ablate::io::Hdf5VisualizationSerializer::GetOutputDirectoryPath(const std::string& objectId) const { return rootOutputDirectory / objectId; }
+
+std::filesystem::path ablate::io::Hdf5VisualizationSerializer::GetOutputFilePath(const std::string& objectId, PetscInt steps, PetscMPIInt rank) const {
+    // name the file with the time step so that outputs are not overwritten after a restart
+    std::stringstream outputStream;
+    if (rank >= 0) {
+        outputStream << "." << std::setw(5) << std::setfill('0') << rank;
+    }
+    outputStream << "." << std::setw(8) << std::setfill('0') << steps;
+    return GetOutputDirectoryPath(objectId) / (objectId + outputStream.str() + extension);
+}
+
+void ablate::io::Hdf5VisualizationSerializer::CompressFile(const std::filesystem::path& filePath) const {
+    auto temporaryPath = filePath;
+    temporaryPath += ".compress";
+
+    hid_t source = CheckHdf5(H5Fopen(filePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), "unable to open " + filePath.string());
+    hid_t destination = CheckHdf5(H5Fcreate(temporaryPath.string().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT), "unable to create " + temporaryPath.string());
+
+    // copy from the root group of each file
+    hid_t sourceRoot = CheckHdf5(H5Gopen2(source, "/", H5P_DEFAULT), "unable to open the root group of " + filePath.string());
+    hid_t destinationRoot = CheckHdf5(H5Gopen2(destination, "/", H5P_DEFAULT), "unable to open the root group of " + temporaryPath.string());
+    CopyAttributes(sourceRoot, destinationRoot);
+    CopyGroup(sourceRoot, destinationRoot, false);
+    H5Gclose(destinationRoot);
+    H5Gclose(sourceRoot);
+
+    CheckHdf5(H5Fclose(destination), "unable to close " + temporaryPath.string());
+    CheckHdf5(H5Fclose(source), "unable to close " + filePath.string());
+
+    std::filesystem::rename(temporaryPath, filePath);
+}
+
+void ablate::io::Hdf5VisualizationSerializer::CopyGroup(hid_t source, hid_t destination, bool fieldGroup) const {
+    H5G_info_t groupInfo;
+    CheckHdf5(H5Gget_info(source, &groupInfo), "unable to get group info");
+
+    for (hsize_t l = 0; l < groupInfo.nlinks; ++l) {
+        // get the name of this link
+        auto nameSize = CheckHdf5(H5Lget_name_by_idx(source, ".", H5_INDEX_NAME, H5_ITER_INC, l, nullptr, 0, H5P_DEFAULT), "unable to get link name");
+        std::string name(nameSize, '\0');
+        H5Lget_name_by_idx(source, ".", H5_INDEX_NAME, H5_ITER_INC, l, name.data(), nameSize + 1, H5P_DEFAULT);
+
+        // determine what kind of object this is
+        hid_t object = CheckHdf5(H5Oopen(source, name.c_str(), H5P_DEFAULT), "unable to open " + name);
+        auto objectType = H5Iget_type(object);
+        CheckHdf5(H5Oclose(object), "unable to close " + name);
+
+        if (objectType == H5I_GROUP) {
+            // the petsc field data is stored in the fields, cell_fields, vertex_fields, and particle_fields groups
+            const bool childFieldGroup = fieldGroup || (name.size() >= 6 && name.compare(name.size() - 6, 6, "fields") == 0);
+            hid_t sourceGroup = CheckHdf5(H5Gopen2(source, name.c_str(), H5P_DEFAULT), "unable to open group " + name);
+            hid_t destinationGroup = CheckHdf5(H5Gcreate2(destination, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT), "unable to create group " + name);
+            CopyAttributes(sourceGroup, destinationGroup);
+            CopyGroup(sourceGroup, destinationGroup, childFieldGroup);
+            H5Gclose(destinationGroup);
+            H5Gclose(sourceGroup);
+        } else if (objectType == H5I_DATASET && fieldGroup) {
+            CompressDataset(source, destination, name);
+        } else {
+            // the mesh, labels, and any other data is copied as is
+            CheckHdf5(H5Ocopy(source, name.c_str(), destination, name.c_str(), H5P_DEFAULT, H5P_DEFAULT), "unable to copy " + name);
+        }
+    }
+}
+
+void ablate::io::Hdf5VisualizationSerializer::CompressDataset(hid_t source, hid_t destination, const std::string& name) const {
+    hid_t sourceDataset = CheckHdf5(H5Dopen2(source, name.c_str(), H5P_DEFAULT), "unable to open dataset " + name);
+    hid_t sourceType = CheckHdf5(H5Dget_type(sourceDataset), "unable to get the type of " + name);
+    hid_t sourceSpace = CheckHdf5(H5Dget_space(sourceDataset), "unable to get the space of " + name);
+    const int rank = H5Sget_simple_extent_ndims(sourceSpace);
+    const auto isFloat = H5Tget_class(sourceType) == H5T_FLOAT;
+    H5Tclose(sourceType);
+
+    // only simple floating point datasets are compressed
+    if (!isFloat || rank < 1 || H5Sget_simple_extent_npoints(sourceSpace) == 0) {
+        H5Sclose(sourceSpace);
+        H5Dclose(sourceDataset);
+        CheckHdf5(H5Ocopy(source, name.c_str(), destination, name.c_str(), H5P_DEFAULT, H5P_DEFAULT), "unable to copy " + name);
+        return;
+    }
+    std::vector<hsize_t> dims(rank);
+    H5Sget_simple_extent_dims(sourceSpace, dims.data(), nullptr);
+
+    // petsc names the field datasets vecName_fieldName
+    const bool keepDouble = std::any_of(doublePrecisionFields.begin(), doublePrecisionFields.end(), [&name](const auto& field) {
+        return name == field || (name.size() > field.size() && name.compare(name.size() - field.size() - 1, field.size() + 1, "_" + field) == 0);
+    });
+
+    // halve the largest chunk dimension until the chunk is small enough
+    std::vector<hsize_t> chunk = dims;
+    auto chunkSize = [&chunk]() { return std::accumulate(chunk.begin(), chunk.end(), (hsize_t)1, std::multiplies<>()); };
+    while (chunkSize() > maximumChunkSize) {
+        auto& largest = *std::max_element(chunk.begin(), chunk.end());
+        largest = (largest + 1) / 2;
+    }
+
+    hid_t createProperties = H5Pcreate(H5P_DATASET_CREATE);
+    CheckHdf5(H5Pset_chunk(createProperties, rank, chunk.data()), "unable to chunk " + name);
+    if (scaleOffsetDigits > 0) {
+        CheckHdf5(H5Pset_scaleoffset(createProperties, H5Z_SO_FLOAT_DSCALE, scaleOffsetDigits), "unable to set the scale-offset filter for " + name);
+    }
+    if (deflateLevel > 0) {
+        CheckHdf5(H5Pset_shuffle(createProperties), "unable to set the shuffle filter for " + name);
+        CheckHdf5(H5Pset_deflate(createProperties, (unsigned)deflateLevel), "unable to set the deflate filter for " + name);
+    }
+
+    hid_t destinationSpace = CheckHdf5(H5Screate_simple(rank, dims.data(), nullptr), "unable to create the space for " + name);
+    hid_t destinationDataset = CheckHdf5(
+        H5Dcreate2(destination, name.c_str(), keepDouble ? H5T_IEEE_F64LE : H5T_IEEE_F32LE, destinationSpace, H5P_DEFAULT, createProperties, H5P_DEFAULT), "unable to create dataset " + name);
+
+    // copy the data in slabs along the largest dimension so that the full dataset is never held in memory
+    const auto slabDimension = std::distance(dims.begin(), std::max_element(dims.begin(), dims.end()));
+    std::vector<hsize_t> offset(rank, 0);
+    std::vector<hsize_t> count = dims;
+    count[slabDimension] = chunk[slabDimension];
+    std::vector<double> buffer(std::accumulate(count.begin(), count.end(), (hsize_t)1, std::multiplies<>()));
+
+    for (offset[slabDimension] = 0; offset[slabDimension] < dims[slabDimension]; offset[slabDimension] += chunk[slabDimension]) {
+        count[slabDimension] = std::min(chunk[slabDimension], dims[slabDimension] - offset[slabDimension]);
+        hid_t memorySpace = H5Screate_simple(rank, count.data(), nullptr);
+        H5Sselect_hyperslab(sourceSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+        H5Sselect_hyperslab(destinationSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+        CheckHdf5(H5Dread(sourceDataset, H5T_NATIVE_DOUBLE, memorySpace, sourceSpace, H5P_DEFAULT, buffer.data()), "unable to read " + name);
+        CheckHdf5(H5Dwrite(destinationDataset, H5T_NATIVE_DOUBLE, memorySpace, destinationSpace, H5P_DEFAULT, buffer.data()), "unable to write " + name);
+        H5Sclose(memorySpace);
+    }
+
+    // the attributes are used by the xdmf generator
+    CopyAttributes(sourceDataset, destinationDataset);
+
+    H5Dclose(destinationDataset);
+    H5Sclose(destinationSpace);
+    H5Pclose(createProperties);
+    H5Sclose(sourceSpace);
+    H5Dclose(sourceDataset);
+}
+
+void ablate::io::Hdf5VisualizationSerializer::CopyAttributes(hid_t source, hid_t destination) {
+    auto copyAttribute = [](hid_t location, const char* attributeName, const H5A_info_t*, void* data) -> herr_t {
+        auto copyDestination = *(hid_t*)data;
+        hid_t attribute = H5Aopen(location, attributeName, H5P_DEFAULT);
+        hid_t type = H5Aget_type(attribute);
+        hid_t space = H5Aget_space(attribute);
+
+        // read and write using the stored type so that the attribute is copied exactly
+        std::vector<char> buffer(H5Tget_size(type) * std::max<hssize_t>(H5Sget_simple_extent_npoints(space), 1));
+        herr_t status = H5Aread(attribute, type, buffer.data());
+        if (status >= 0) {
+            hid_t copy = H5Acreate2(copyDestination, attributeName, type, space, H5P_DEFAULT, H5P_DEFAULT);
+            status = copy < 0 ? (herr_t)copy : H5Awrite(copy, type, buffer.data());
+            if (copy >= 0) {
+                H5Aclose(copy);
+            }
+
+            // variable length data (including strings) is allocated by hdf5 during the read
+            if (H5Tdetect_class(type, H5T_VLEN) > 0 || H5Tis_variable_str(type) > 0) {
+#if H5_VERSION_GE(1, 12, 0)
+                H5Treclaim(type, space, H5P_DEFAULT, buffer.data());
+#else
+                H5Dvlen_reclaim(type, space, H5P_DEFAULT, buffer.data());
+#endif
+            }
+        }
+
+        H5Sclose(space);
+        H5Tclose(type);
+        H5Aclose(attribute);
+        return status;
+    };
+    CheckHdf5(H5Aiterate2(source, H5_INDEX_NAME, H5_ITER_INC, nullptr, copyAttribute, &destination), "unable to copy attributes");
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::io::Serializer, ablate::io::Hdf5VisualizationSerializer,
+         "serializer that writes reduced size single precision, compressed visualization files next to the restart files written by another serializer",
+         ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine the visualization write interval."),
+         OPT(ablate::io::Serializer, "serializer", "the optional serializer used for the lossless restart files"),
+         OPT(std::vector<std::string>, "doublePrecisionFields", "optional list of fields that are kept in double precision (default is none)"),
+         OPT(int, "deflateLevel", "optional deflate (gzip) compression level between 1 and 9 (default is no deflate compression)"),
+         OPT(int, "scaleOffsetDigits", "optional number of decimal digits kept by the lossy scale-offset filter (default is lossless)"));
@@ -0,0 +1,120 @@
+#ifndef ABLATELIBRARY_HDF5VISUALIZATIONSERIALIZER_HPP
+#define ABLATELIBRARY_HDF5VISUALIZATIONSERIALIZER_HPP
+
+#include <petscviewerhdf5.h>
+#include <filesystem>
+#include <io/interval/interval.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "serializable.hpp"
+#include "serializer.hpp"
+#include "utilities/loggable.hpp"
+
+namespace ablate::io {
+
+/**
+ * Writes reduced size visualization files next to the lossless restart files written by another serializer.  Each visualization output is written to a new file
+ * in the visualization directory.  The field data is then rewritten in single precision into chunked datasets with optional deflate and/or scale-offset
+ * compression.  The visualization files are never used for restart.
+ */
+class Hdf5VisualizationSerializer : public Serializer, private utilities::Loggable<Hdf5VisualizationSerializer> {
+   private:
+    // Use the interval class to determine when to write to file
+    const std::shared_ptr<ablate::io::interval::Interval> interval;
+
+    //! the optional serializer used for the lossless restart files
+    const std::shared_ptr<Serializer> restartSerializer;
+
+    //! the fields that are kept in double precision
+    const std::vector<std::string> doublePrecisionFields;
+
+    //! the deflate (gzip) level, 0 disables deflate
+    const int deflateLevel;
+
+    //! the number of decimal digits kept by the scale-offset filter, 0 disables the filter
+    const int scaleOffsetDigits;
+
+    // file extension
+    inline const static std::string extension = ".hdf5";
+
+    //! the maximum number of values in each chunk
+    inline const static hsize_t maximumChunkSize = 65536;
+
+    //! store the root output directory incase the run environment changes it
+    std::filesystem::path rootOutputDirectory = {};
+
+    //! the last time step written, used to prevent duplicate output
+    PetscInt timeStep = -1;
+
+    // keep a list of postProcesses ids
+    std::vector<std::string> postProcessesIds;
+
+    // Hold the pointer to each serializable object;
+    std::vector<std::weak_ptr<Serializable>> serializables;
+
+    //! Petsc function used to save the visualization state
+    static PetscErrorCode Hdf5VisualizationSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
+
+    //! Private functions to determine the path name, the rank is only used for serial objects
+    [[nodiscard]] std::filesystem::path GetOutputFilePath(const std::string& objectId, PetscInt steps, PetscMPIInt rank = -1) const;
+
+    //! private function to get the output directory
+    [[nodiscard]] std::filesystem::path GetOutputDirectoryPath(const std::string& objectId) const;
+
+    /**
+     * Recursively copy the group into the destination, compressing the datasets in any field group
+     */
+    void CopyGroup(hid_t source, hid_t destination, bool fieldGroup) const;
+
+    /**
+     * Copy a floating point field dataset into the destination with reduced precision and compression
+     */
+    void CompressDataset(hid_t source, hid_t destination, const std::string& name) const;
+
+    /**
+     * Copy all attributes from the source object to the destination object
+     */
+    static void CopyAttributes(hid_t source, hid_t destination);
+
+   public:
+    /**
+     * @param interval the interval used to write visualization files
+     * @param restartSerializer the optional serializer used for the restart files.  The restart serializer is called first for each time step.
+     * @param doublePrecisionFields optional list of fields that are kept in double precision
+     * @param deflateLevel optional deflate (gzip) level between 1 and 9
+     * @param scaleOffsetDigits optional number of decimal digits kept by the lossy scale-offset filter
+     */
+    explicit Hdf5VisualizationSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<Serializer> restartSerializer = {},
+                                         std::vector<std::string> doublePrecisionFields = {}, int deflateLevel = 0, int scaleOffsetDigits = 0);
+
+    /**
+     * Generate the xdmf files for the visualization output
+     */
+    ~Hdf5VisualizationSerializer() override;
+
+    /**
+     * Register the object with this and the restart serializer
+     */
+    void Register(std::weak_ptr<Serializable>) override;
+
+    //! public functions to interface with the main TS
+    void* GetContext() override { return this; }
+
+    //! public functions to interface with the main TS
+    PetscSerializeFunction GetSerializeFunction() override { return Hdf5VisualizationSerializerSaveStateFunction; }
+
+    /**
+     * Restore the ts using the restart serializer
+     */
+    void RestoreTS(TS ts) override;
+
+    /**
+     * Rewrites the hdf5 file with reduced precision, chunked and compressed field data
+     * @param filePath
+     */
+    void CompressFile(const std::filesystem::path& filePath) const;
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_HDF5VISUALIZATIONSERIALIZER_HPP
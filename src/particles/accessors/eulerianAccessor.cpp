@@ -1,16 +1,42 @@
 #include "eulerianAccessor.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "particles/particleSolver.hpp"
 
-ablate::particles::accessors::EulerianAccessor::EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor& swarm, PetscReal currentTime)
-    : Accessor(cachePointData), subDomain(std::move(subDomain)), currentTime(currentTime), np(swarm.GetNumberParticles()) {
-    // Resize and copy over the coordinates
+ablate::particles::accessors::EulerianAccessor::EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor& swarm, PetscReal currentTime,
+                                                                const CellLocator& cellLocator, PetscInt* cellGuess)
+    : Accessor(cachePointData), subDomain(std::move(subDomain)), currentTime(currentTime), np(swarm.GetNumberParticles()), cells(cellGuess, cellGuess + np) {
+    // Copy over the current coordinates
     auto coodinatesField = swarm.GetData(ablate::particles::ParticleSolver::ParticleCoordinates);
-
-    // Size up and copy the coordinates
     coordinates.resize(np * coodinatesField.numberComponents);
     coodinatesField.CopyAll(coordinates.data(), np);
+
+    // Walk each particle from its previous cell and keep the result as the guess for the next evaluation
+    cellLocator.Locate(this->subDomain->GetDM(), np, coordinates.data(), cells.data());
+    std::copy(cells.begin(), cells.end(), cellGuess);
+}
+
+DMInterpolationInfo ablate::particles::accessors::EulerianAccessor::CreateInterpolation(PetscInt dim, PetscInt dof, const std::vector<PetscInt>& particles) const {
+    DMInterpolationInfo interpolant;
+    DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> utilities::PetscUtilities::checkError;
+    DMInterpolationSetDim(interpolant, dim) >> utilities::PetscUtilities::checkError;
+    DMInterpolationSetDof(interpolant, dof) >> utilities::PetscUtilities::checkError;
+
+    // fill in the located points, cells, and coordinates that DMInterpolationSetUp would leave behind.  These are the only members read by DMInterpolationEvaluate.
+    const auto numberPoints = (PetscInt)particles.size();
+    interpolant->n = numberPoints;
+    PetscMalloc1(numberPoints, &interpolant->cells) >> utilities::PetscUtilities::checkError;
+    VecCreateSeq(PETSC_COMM_SELF, numberPoints * dim, &interpolant->coords) >> utilities::PetscUtilities::checkError;
+    VecSetBlockSize(interpolant->coords, dim) >> utilities::PetscUtilities::checkError;
+    PetscScalar* interpolantCoords;
+    VecGetArrayWrite(interpolant->coords, &interpolantCoords) >> utilities::PetscUtilities::checkError;
+    for (PetscInt i = 0; i < numberPoints; ++i) {
+        interpolant->cells[i] = cells[particles[i]];
+        PetscArraycpy(interpolantCoords + i * dim, coordinates.data() + particles[i] * dim, dim) >> utilities::PetscUtilities::checkError;
+    }
+    VecRestoreArrayWrite(interpolant->coords, &interpolantCoords) >> utilities::PetscUtilities::checkError;
+    return interpolant;
 }
 
 ablate::particles::accessors::ConstPointData ablate::particles::accessors::EulerianAccessor::CreateData(const std::string& fieldName) {
@@ -23,28 +49,59 @@ ablate::particles::accessors::ConstPointData ablate::particles::accessors::Euler
     const auto& eulerianField = subDomain->GetField(fieldName);
     subDomain->GetFieldLocalVector(eulerianField, currentTime, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> utilities::PetscUtilities::checkError;
 
-    // Set up the interpolation
-    DMInterpolationInfo interpolant;
-    DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> utilities::PetscUtilities::checkError;
-    DMInterpolationSetDim(interpolant, subDomain->GetDimensions()) >> utilities::PetscUtilities::checkError;
-    DMInterpolationSetDof(interpolant, eulerianField.numberComponents) >> utilities::PetscUtilities::checkError;
-
-    // Copy over the np of particles
-    DMInterpolationAddPoints(interpolant, np, coordinates.data()) >> utilities::PetscUtilities::checkError;
-
-    /* Particles that lie outside the domain should be dropped,
-    whereas particles that move to another partition should trigger a migration */
-    DMInterpolationSetUp(interpolant, eulerianFieldDm, PETSC_FALSE, PETSC_TRUE) >> utilities::PetscUtilities::checkError;
-
     // Create a vec to hold the information
     Vec eulerianFieldAtParticles;
     VecCreateSeq(PETSC_COMM_SELF, np * eulerianField.numberComponents, &eulerianFieldAtParticles) >> utilities::PetscUtilities::checkError;
 
-    // interpolate
-    DMInterpolationEvaluate(interpolant, eulerianFieldDm, locEulerianField, eulerianFieldAtParticles) >> utilities::PetscUtilities::checkError;
+    // particles that are no longer on this rank are left at zero until they are migrated
+    PetscScalar* particleArray;
+    VecGetArrayWrite(eulerianFieldAtParticles, &particleArray) >> utilities::PetscUtilities::checkError;
+    PetscArrayzero(particleArray, np * eulerianField.numberComponents) >> utilities::PetscUtilities::checkError;
+
+    if (eulerianField.type == domain::FieldType::FVM) {
+        // finite volume data is constant in each cell, so it is gathered directly from the owning cell
+        const PetscScalar* locEulerianArray;
+        VecGetArrayRead(locEulerianField, &locEulerianArray) >> utilities::PetscUtilities::checkError;
+        for (PetscInt p = 0; p < np; ++p) {
+            if (cells[p] < 0) {
+                continue;
+            }
+            const PetscScalar* cellValues;
+            DMPlexPointLocalRead(eulerianFieldDm, cells[p], locEulerianArray, &cellValues) >> utilities::PetscUtilities::checkError;
+            PetscArraycpy(particleArray + p * eulerianField.numberComponents, cellValues, eulerianField.numberComponents) >> utilities::PetscUtilities::checkError;
+        }
+        VecRestoreArrayRead(locEulerianField, &locEulerianArray) >> utilities::PetscUtilities::checkError;
+    } else {
+        // finite element data is evaluated with the element basis, so hand the already located cells to the interpolation instead of searching again
+        const PetscInt dim = GetDimensions();
+        std::vector<PetscInt> locatedParticles;
+        for (PetscInt p = 0; p < np; ++p) {
+            if (cells[p] >= 0) {
+                locatedParticles.push_back(p);
+            }
+        }
+        const auto numberLocated = (PetscInt)locatedParticles.size();
+
+        DMInterpolationInfo interpolant = CreateInterpolation(dim, eulerianField.numberComponents, locatedParticles);
+
+        // interpolate
+        Vec locatedValues;
+        VecCreateSeq(PETSC_COMM_SELF, numberLocated * eulerianField.numberComponents, &locatedValues) >> utilities::PetscUtilities::checkError;
+        DMInterpolationEvaluate(interpolant, eulerianFieldDm, locEulerianField, locatedValues) >> utilities::PetscUtilities::checkError;
+
+        const PetscScalar* locatedArray;
+        VecGetArrayRead(locatedValues, &locatedArray) >> utilities::PetscUtilities::checkError;
+        for (PetscInt i = 0; i < numberLocated; ++i) {
+            PetscArraycpy(particleArray + locatedParticles[i] * eulerianField.numberComponents, locatedArray + i * eulerianField.numberComponents, eulerianField.numberComponents) >>
+                utilities::PetscUtilities::checkError;
+        }
+        VecRestoreArrayRead(locatedValues, &locatedArray) >> utilities::PetscUtilities::checkError;
+        VecDestroy(&locatedValues) >> utilities::PetscUtilities::checkError;
+        DMInterpolationDestroy(&interpolant) >> utilities::PetscUtilities::checkError;
+    }
+    VecRestoreArrayWrite(eulerianFieldAtParticles, &particleArray) >> utilities::PetscUtilities::checkError;
 
     // Now cleanup
-    DMInterpolationDestroy(&interpolant) >> utilities::PetscUtilities::checkError;
     subDomain->RestoreFieldLocalVector(eulerianField, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> utilities::PetscUtilities::checkError;
 
     // Get the raw array from the vec
@@ -3,15 +3,18 @@
 
 #include <petsc.h>
 #include <map>
+#include <vector>
 #include "accessor.hpp"
 #include "domain/subDomain.hpp"
+#include "particles/cellLocator.hpp"
 #include "particles/field.hpp"
 #include "swarmAccessor.hpp"
 #include "utilities/petscUtilities.hpp"
 
 namespace ablate::particles::accessors {
 /**
- * Interpolates cell/eulerian data to the particle locations
+ * Interpolates cell/eulerian data to the particle locations.  The owning cell of each particle is located once when the accessor is created and then each
+ * field is gathered directly from the owning cell.
  */
 class EulerianAccessor : public Accessor<const PetscReal> {
    private:
@@ -20,14 +23,34 @@ class EulerianAccessor : public Accessor<const PetscReal> {
     //! current time in the solver
     const PetscReal currentTime;
 
+    //! the number of particles in this domain
+    const PetscInt np;
+
     //! Store a list of current coordinates
     std::vector<PetscReal> coordinates;
 
-    //! the number of particles in this domain
-    const PetscInt np;
+    //! the cell that owns each particle, or -1 if the particle is not on this rank
+    std::vector<PetscInt> cells;
+
+    /**
+     * Create the interpolation for particles whose owning cells are already known.  DMInterpolationSetUp always repeats the point location, so this is
+     * the only place the DMInterpolationInfo is filled directly; the returned interpolation must be destroyed with DMInterpolationDestroy.
+     * @param dim the number of dimensions
+     * @param dof the number of components being interpolated
+     * @param particles the index of each located particle to add
+     */
+    DMInterpolationInfo CreateInterpolation(PetscInt dim, PetscInt dof, const std::vector<PetscInt>& particles) const;
 
    public:
-    EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor&, PetscReal currentTime);
+    /**
+     * @param cachePointData
+     * @param subDomain
+     * @param swarm the swarm accessor holding the current particle coordinates
+     * @param currentTime
+     * @param cellLocator the locator used to update the owning cell of each particle
+     * @param cellGuess the owning cell of each particle from the previous evaluation, updated in place with the current owning cell
+     */
+    EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor& swarm, PetscReal currentTime, const CellLocator& cellLocator, PetscInt* cellGuess);
 
     /**
      * Create point data from the rhs field
@@ -0,0 +1,154 @@
+#include "cellLocator.hpp"
+#include <vector>
+#include "utilities/petscUtilities.hpp"
+
+void ablate::particles::CellLocator::UpdateGeometry(DM dm) const {
+    PetscObjectId currentDmId;
+    PetscObjectState currentDmState;
+    PetscObjectGetId((PetscObject)dm, &currentDmId) >> utilities::PetscUtilities::checkError;
+    PetscObjectStateGet((PetscObject)dm, &currentDmState) >> utilities::PetscUtilities::checkError;
+    if (currentDmId == dmId && currentDmState == dmState) {
+        return;
+    }
+
+    DMGetDimension(dm, &dim) >> utilities::PetscUtilities::checkError;
+
+    // particles are never owned by the boundary ghost cells
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+    PetscInt ghostStart;
+    DMPlexGetCellTypeStratum(dm, DM_POLYTOPE_FV_GHOST, &ghostStart, nullptr) >> utilities::PetscUtilities::checkError;
+    if (ghostStart >= 0) {
+        cEnd = PetscMin(cEnd, ghostStart);
+    }
+
+    if (cellGeomVec) {
+        VecDestroy(&cellGeomVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (faceGeomVec) {
+        VecDestroy(&faceGeomVec) >> utilities::PetscUtilities::checkError;
+    }
+    DMPlexComputeGeometryFVM(dm, &cellGeomVec, &faceGeomVec) >> utilities::PetscUtilities::checkError;
+
+    dmId = currentDmId;
+    dmState = currentDmState;
+}
+
+ablate::particles::CellLocator::~CellLocator() {
+    if (cellGeomVec) {
+        VecDestroy(&cellGeomVec) >> utilities::PetscUtilities::checkError;
+    }
+    if (faceGeomVec) {
+        VecDestroy(&faceGeomVec) >> utilities::PetscUtilities::checkError;
+    }
+}
+
+PetscInt ablate::particles::CellLocator::ExitFace(DM dm, PetscInt cell, const PetscReal point[], DM cellGeomDm, const PetscScalar* cellGeomArray, DM faceGeomDm,
+                                                  const PetscScalar* faceGeomArray) const {
+    PetscFVCellGeom* cellGeom;
+    DMPlexPointLocalRead(cellGeomDm, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+
+    PetscInt coneSize;
+    const PetscInt* cone;
+    DMPlexGetConeSize(dm, cell, &coneSize) >> utilities::PetscUtilities::checkError;
+    DMPlexGetCone(dm, cell, &cone) >> utilities::PetscUtilities::checkError;
+
+    PetscInt exitFace = -1;
+    PetscReal maxDistance = 0.0;
+    for (PetscInt f = 0; f < coneSize; ++f) {
+        PetscFVFaceGeom* faceGeom;
+        DMPlexPointLocalRead(faceGeomDm, cone[f], faceGeomArray, &faceGeom) >> utilities::PetscUtilities::checkError;
+
+        // the stored normal may point into or out of this cell, so orient it using the cell centroid
+        PetscReal orientation = 0.0, distance = 0.0, area = 0.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            orientation += (faceGeom->centroid[d] - cellGeom->centroid[d]) * faceGeom->normal[d];
+            distance += (point[d] - faceGeom->centroid[d]) * faceGeom->normal[d];
+            area += faceGeom->normal[d] * faceGeom->normal[d];
+        }
+        distance = (orientation < 0.0 ? -distance : distance) / PetscSqrtReal(area);
+
+        if (distance > maxDistance) {
+            maxDistance = distance;
+            exitFace = cone[f];
+        }
+    }
+    return exitFace;
+}
+
+void ablate::particles::CellLocator::Locate(DM dm, PetscInt np, const PetscReal coordinates[], PetscInt cells[]) const {
+    UpdateGeometry(dm);
+
+    DM cellGeomDm, faceGeomDm;
+    const PetscScalar *cellGeomArray, *faceGeomArray;
+    VecGetDM(cellGeomVec, &cellGeomDm) >> utilities::PetscUtilities::checkError;
+    VecGetDM(faceGeomVec, &faceGeomDm) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+
+    // walk each point from its last cell, recording any that need to be searched for
+    std::vector<PetscInt> lostPoints;
+    for (PetscInt p = 0; p < np; ++p) {
+        PetscInt cell = cells[p];
+        if (cell < cStart || cell >= cEnd) {
+            lostPoints.push_back(p);
+            continue;
+        }
+
+        PetscInt step = 0;
+        for (; step < maxWalkSteps; ++step) {
+            PetscInt exitFace = ExitFace(dm, cell, coordinates + p * dim, cellGeomDm, cellGeomArray, faceGeomDm, faceGeomArray);
+            if (exitFace < 0) {
+                break;
+            }
+
+            // step across the face, stopping at a boundary or the edge of the partition
+            PetscInt supportSize;
+            const PetscInt* support;
+            DMPlexGetSupportSize(dm, exitFace, &supportSize) >> utilities::PetscUtilities::checkError;
+            DMPlexGetSupport(dm, exitFace, &support) >> utilities::PetscUtilities::checkError;
+            PetscInt nextCell = supportSize == 2 ? (support[0] == cell ? support[1] : support[0]) : -1;
+            if (nextCell < cStart || nextCell >= cEnd) {
+                step = maxWalkSteps;
+                break;
+            }
+            cell = nextCell;
+        }
+
+        if (step < maxWalkSteps) {
+            cells[p] = cell;
+        } else {
+            lostPoints.push_back(p);
+        }
+    }
+
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
+
+    if (lostPoints.empty()) {
+        return;
+    }
+
+    // search for the remaining points on this rank
+    Vec locVec;
+    VecCreateSeq(PETSC_COMM_SELF, (PetscInt)lostPoints.size() * dim, &locVec) >> utilities::PetscUtilities::checkError;
+    VecSetBlockSize(locVec, dim) >> utilities::PetscUtilities::checkError;
+    PetscScalar* locArray;
+    VecGetArray(locVec, &locArray) >> utilities::PetscUtilities::checkError;
+    for (std::size_t p = 0; p < lostPoints.size(); ++p) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            locArray[p * dim + d] = coordinates[lostPoints[p] * dim + d];
+        }
+    }
+    VecRestoreArray(locVec, &locArray) >> utilities::PetscUtilities::checkError;
+
+    PetscSF cellSF = nullptr;
+    DMLocatePoints(dm, locVec, DM_POINTLOCATION_NONE, &cellSF) >> utilities::PetscUtilities::checkError;
+    const PetscSFNode* foundCells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &foundCells) >> utilities::PetscUtilities::checkError;
+    for (std::size_t p = 0; p < lostPoints.size(); ++p) {
+        cells[lostPoints[p]] = foundCells[p].index >= 0 ? foundCells[p].index : -1;
+    }
+
+    PetscSFDestroy(&cellSF) >> utilities::PetscUtilities::checkError;
+    VecDestroy(&locVec) >> utilities::PetscUtilities::checkError;
+}
@@ -0,0 +1,61 @@
+#ifndef ABLATELIBRARY_CELLLOCATOR_HPP
+#define ABLATELIBRARY_CELLLOCATOR_HPP
+
+#include <petsc.h>
+
+namespace ablate::particles {
+/**
+ * Tracks the cell that owns each particle by walking across cell faces from the last known cell.  Particles that can not be reached this way (new particles,
+ * particles that left the local partition, or a walk that does not settle) fall back to a DMLocatePoints search.
+ */
+class CellLocator {
+   private:
+    //! the id and state of the cell dm used to compute the geometry, the geometry is rebuilt when either changes
+    mutable PetscObjectId dmId = -1;
+    mutable PetscObjectState dmState = -1;
+
+    //! the dimension of the cell dm
+    mutable PetscInt dim = 0;
+
+    //! the range of interior (non-ghost) cells that particles can be found in
+    mutable PetscInt cStart = 0, cEnd = 0;
+
+    //! the cell and face geometry for the current dm
+    mutable Vec cellGeomVec = nullptr;
+    mutable Vec faceGeomVec = nullptr;
+
+    //! the maximum number of faces crossed before falling back to a search
+    static inline constexpr PetscInt maxWalkSteps = 64;
+
+    /**
+     * Compute the cell range and geometry if this is a new dm or the dm has changed since they were computed
+     */
+    void UpdateGeometry(DM dm) const;
+
+    /**
+     * Determine the face that the point is furthest outside of
+     * @return the face or -1 if the point is inside of the cell
+     */
+    PetscInt ExitFace(DM dm, PetscInt cell, const PetscReal point[], DM cellGeomDm, const PetscScalar* cellGeomArray, DM faceGeomDm, const PetscScalar* faceGeomArray) const;
+
+   public:
+    CellLocator() = default;
+
+    ~CellLocator();
+
+    /**
+     * prevent copy of this class
+     */
+    CellLocator(const CellLocator&) = delete;
+
+    /**
+     * Update the owning cell of each point.  The incoming cells are used as the starting guess and are replaced with the owning cell, or -1 if the point is not on this rank.
+     * @param dm the cell dm that the particles live in
+     * @param np the number of points
+     * @param coordinates the point coordinates, dim per point
+     * @param cells the cell of each point
+     */
+    void Locate(DM dm, PetscInt np, const PetscReal coordinates[], PetscInt cells[]) const;
+};
+}  // namespace ablate::particles
+#endif  // ABLATELIBRARY_CELLLOCATOR_HPP
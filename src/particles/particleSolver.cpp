@@ -120,6 +120,7 @@ void ablate::particles::ParticleSolver::Initialize() {
 
     // associate the swarm with the cell dm
     DMSwarmSetCellDM(swarmDm, subDomain->GetDM()) >> utilities::PetscUtilities::checkError;
+    cellLocator = std::make_unique<CellLocator>();
 
     // name the particle domain
     PetscObjectSetOptions((PetscObject)swarmDm, petscOptions) >> utilities::PetscUtilities::checkError;
@@ -502,7 +503,12 @@ PetscErrorCode ablate::particles::ParticleSolver::ComputeParticleRHS(TS ts, Pets
     // Build the needed data structures
     accessors::SwarmAccessor swarmAccessor(cachePointData, particleSolver->swarmDm, particleSolver->fieldsMap, x);
     accessors::RhsAccessor rhsAccessor(cachePointData, particleSolver->fieldsMap, f);
-    accessors::EulerianAccessor eulerianAccessor(cachePointData, particleSolver->subDomain, swarmAccessor, t);
+
+    // the cell id from the last evaluation (or migration) is used as the starting point to locate each particle
+    PetscInt *cellIds;
+    PetscCall(DMSwarmGetField(particleSolver->swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds));
+    accessors::EulerianAccessor eulerianAccessor(cachePointData, particleSolver->subDomain, swarmAccessor, t, *particleSolver->cellLocator, cellIds);
+    PetscCall(DMSwarmRestoreField(particleSolver->swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds));
 
     // March over each processes
     try {
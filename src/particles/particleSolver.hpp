@@ -1,6 +1,8 @@
 #ifndef ABLATELIBRARY_PARTICLESOLVER_HPP
 #define ABLATELIBRARY_PARTICLESOLVER_HPP
 
+#include <memory>
+#include "cellLocator.hpp"
 #include "field.hpp"
 #include "fieldDescription.hpp"
 #include "initializers/initializer.hpp"
@@ -40,6 +42,9 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     //! store a boolean to state if a dmChanged (number of particles local/global changed)
     bool dmChanged = false;
 
+    //! updates the owning cell (DMSwarmPICField_cellid) of each particle during the rhs evaluation
+    std::unique_ptr<CellLocator> cellLocator;
+
     //! the fields specific to be created to create in the particle solver
     std::vector<FieldDescription> fieldsDescriptions;
 
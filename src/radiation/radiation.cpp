@@ -1,13 +1,18 @@
 #include "radiation.hpp"
 
+#include <petscviewerhdf5.h>
+#include <algorithm>
+#include <type_traits>
+
 ablate::radiation::Radiation::Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber,
-                                        std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log)
-    : nTheta(raynumber), nPhi(2 * raynumber), solverId(solverId), region(region), radiationModel(std::move(radiationModelIn)), log(std::move(log)) {}
+                                        std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log, bool marchLocally)
+    : nTheta(raynumber), nPhi(2 * raynumber), marchLocally(marchLocally), solverId(solverId), region(region), radiationModel(std::move(radiationModelIn)), log(std::move(log)) {}
 
 ablate::radiation::Radiation::~Radiation() {
     if (faceGeomVec) VecDestroy(&faceGeomVec) >> utilities::PetscUtilities::checkError;
     if (cellGeomVec) VecDestroy(&cellGeomVec) >> utilities::PetscUtilities::checkError;
     if (remoteAccess) PetscSFDestroy(&remoteAccess) >> utilities::PetscUtilities::checkError;
+    if (radSearch) DMDestroy(&radSearch) >> utilities::PetscUtilities::checkError;
     MPI_Type_free(&carrierMpiType) >> utilities::MpiUtilities::checkError;
 }
 
@@ -154,8 +159,28 @@ void ablate::radiation::Radiation::Setup(const ablate::domain::Range& cellRange,
 }
 
 void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellRange, ablate::domain::SubDomain& subDomain) {
+    // the rays are traced once they are needed so that a restored search can be used instead
+    raySubDomain = &subDomain;
+
+    DMPlexComputeGeometryFVM(subDomain.GetDM(), &cellGeomVec, &faceGeomVec) >> utilities::PetscUtilities::checkError;  //!< Get the geometry vectors
+    ComputeMeshFingerprint(cellRange, subDomain);
+
+    evaluatedGains.resize(numberOriginCells * absorptivityFunction.propertySize);  //! Size each of the entries to hold all of the wavelengths being transported.
+
+    // Create a mpi data type to allow reducing the remoteRayCalculation to raySegmentSummary
+    PetscInt count = 2 * absorptivityFunction.propertySize;  //! = 2 * (the number of independant wavelengths that are being considered). Should be read from absorption model.
+    MPI_Type_contiguous(count, MPIU_REAL, &carrierMpiType) >> utilities::MpiUtilities::checkError;
+    MPI_Type_commit(&carrierMpiType) >> utilities::MpiUtilities::checkError;
+}
+
+void ablate::radiation::Radiation::TraceRays() {
+    if (!raySubDomain) {
+        throw std::runtime_error("The radiation solver " + solverId + " must be initialized before the rays are traced.");
+    }
+    auto& subDomain = *raySubDomain;
+
     if (log) log->Printf("Migration Start: %s \n", solverId.c_str());
-    StartEvent((GetClassType() + "::Initialize").c_str());
+    StartEvent((GetClassType() + "::TraceRays").c_str());
     DM faceDM;
     const PetscScalar* faceGeomArray;
 
@@ -172,7 +197,6 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     /** This will be added to as rays are created on each rank */
     DMSwarmSetLocalSizes(radReturn, 0, 100) >> utilities::PetscUtilities::checkError;
 
-    DMPlexComputeGeometryFVM(subDomain.GetDM(), &cellGeomVec, &faceGeomVec) >> utilities::PetscUtilities::checkError;  //!< Get the geometry vectors
     VecGetDM(faceGeomVec, &faceDM) >> utilities::PetscUtilities::checkError;
     VecGetArrayRead(faceGeomVec, &faceGeomArray) >> utilities::PetscUtilities::checkError;
 
@@ -193,80 +217,94 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
     DMSwarmGetSize(radSearch, &nglobalpoints) >> utilities::PetscUtilities::checkError;
     PetscInt stepcount = 0;       //!< Count the number of steps that the particles have taken
     while (nglobalpoints != 0) {  //!< WHILE THERE ARE PARTICLES IN ANY DOMAIN
-        // If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory and record its index
-        IdentifyNewRaysOnRank(subDomain, radReturn, npoints);
-
-        /** Use the ParticleStep function to calculate the path lengths of the rays through each cell so that they can be stored.
-         * This function also sets up the solve particle infrastructure.
+        /** March the particles from cell to cell on this rank. The collective migration is only needed once every remaining particle has either left the local
+         * partition or reached the boundary.
          * */
-        ParticleStep(subDomain, faceDM, faceGeomArray, radReturn, npoints, nglobalpoints);
-
-        /** Get all of the ray information from the particle
-         * Get the ntheta and nphi from the particle that is currently being looked at. This will be used to identify its ray and calculate its direction. */
-        DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-        DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-
-        for (PetscInt ipart = 0; ipart < npoints; ipart++) {  //!< Iterate over the particles present in the domain. How to isolate the particles in this domain and iterate over them? If there are no
-
-            /** IF THE CELL NUMBER IS RETURNED NEGATIVE, THEN WE HAVE REACHED THE BOUNDARY OF THE DOMAIN >> This exits the loop
-             * This function returns multiple values if multiple points are input to it
-             * Make sure that whatever cell is returned is in the radiation domain
-             * Assemble a vector of vectors etc associated with each cell index, angular coordinate, and space step?
-             * The boundary has been reached if any of these conditions don't hold
-             * */
+        PetscInt nlocalMarching = npoints;
+        while (nlocalMarching > 0) {
+            // If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory and record its index
+            IdentifyNewRaysOnRank(subDomain, radReturn, npoints);
 
-            /** Step 3.5: The cells need to be removed if they are inside a boundary cell.
-             * Therefore, after each step (where the particle location is fed in) check for whether the cell is still within the interior region.
-             * If it is not (if it's in a boundary cell) then it should be deleted here.
-             * Condition for one dimensional domains to avoid infinite rays perpendicular to the x-axis
-             * If the domain is 1D and the x-direction of the particle is zero then delete the particle here
+            /** Use the ParticleStep function to calculate the path lengths of the rays through each cell so that they can be stored.
+             * This function also sets up the solve particle infrastructure.
              * */
-            if ((!(domain::Region::InRegion(region, subDomain.GetDM(), index[ipart]))) || ((dim == 1) && (abs(virtualcoord[ipart].xdir) < 0.0000001))) {
-                //! If the boundary has been reached by this ray, then add a boundary condition segment to the ray.
-                auto& ray = raySegments[identifier[ipart].remoteRayId];
-                auto& raySegment = ray.emplace_back();
-                SetBoundary(raySegment, index[ipart], identifier[ipart]);
-
-                //! Delete the search particle associated with the ray
-                DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-                DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-
-                DMSwarmRemovePointAtIndex(radSearch, ipart);  //!< Delete the particle!
-                DMSwarmGetLocalSize(radSearch, &npoints);
-
-                DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-                DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
-                ipart--;  //!< Check the point replacing the one that was deleted
-            } else {
-                /** Step 4: Push the particle virtual coordinates to the intersection that was found in the previous step.
-                 * This ensures that the next calculated path length will start from the boundary of the adjacent cell.
+            ParticleStep(subDomain, faceDM, faceGeomArray, radReturn, npoints, nglobalpoints);
+
+            /** Get all of the ray information from the particle
+             * Get the ntheta and nphi from the particle that is currently being looked at. This will be used to identify its ray and calculate its direction. */
+            DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+            DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+            DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
+            DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+
+            for (PetscInt ipart = 0; ipart < npoints; ipart++) {  //!< Iterate over the particles present in the domain. How to isolate the particles in this domain and iterate over them?
+                //! Particles that have left the local partition wait for the migration
+                if (index[ipart] == AwaitingMigrationCell) {
+                    continue;
+                }
+
+                /** IF THE CELL NUMBER IS RETURNED NEGATIVE, THEN WE HAVE REACHED THE BOUNDARY OF THE DOMAIN >> This exits the loop
+                 * This function returns multiple values if multiple points are input to it
+                 * Make sure that whatever cell is returned is in the radiation domain
+                 * Assemble a vector of vectors etc associated with each cell index, angular coordinate, and space step?
+                 * The boundary has been reached if any of these conditions don't hold
                  * */
-                virtualcoord[ipart].x += virtualcoord[ipart].xdir * virtualcoord[ipart].hhere;
-                virtualcoord[ipart].y += virtualcoord[ipart].ydir * virtualcoord[ipart].hhere;
-                virtualcoord[ipart].z += virtualcoord[ipart].zdir * virtualcoord[ipart].hhere;  //!< Only use the literal intersection coordinate if it exists. This will be decided above.
-
-                /** Step 5: Instead of using the cell face to step into the opposite cell, step the physical coordinates just beyond the intersection.
-                 * This avoids issues with hitting corners and potential ghost cell weirdness.
-                 * It will be slower than the face flipping but it will be more reliable.
-                 * Update the coordinates of the particle.
-                 * It doesn't matter which method is used,
-                 * this will be the same procedure.
+
+                /** Step 3.5: The cells need to be removed if they are inside a boundary cell.
+                 * Therefore, after each step (where the particle location is fed in) check for whether the cell is still within the interior region.
+                 * If it is not (if it's in a boundary cell) then it should be deleted here.
+                 * Condition for one dimensional domains to avoid infinite rays perpendicular to the x-axis
+                 * If the domain is 1D and the x-direction of the particle is zero then delete the particle here
                  * */
-                UpdateCoordinates(ipart, virtualcoord, coord, 0.1);  //!< Update the coordinates of the particle to move it beyond the face of the adjacent cell.
-                virtualcoord[ipart].hhere = 0;                       //!< Reset the path length to zero
+                if ((!(domain::Region::InRegion(region, subDomain.GetDM(), index[ipart]))) || ((dim == 1) && (abs(virtualcoord[ipart].xdir) < 0.0000001))) {
+                    //! If the boundary has been reached by this ray, then add a boundary condition segment to the ray.
+                    auto& ray = raySegments[identifier[ipart].remoteRayId];
+                    auto& raySegment = ray.emplace_back();
+                    SetBoundary(raySegment, index[ipart], identifier[ipart]);
+
+                    //! Delete the search particle associated with the ray
+                    DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+                    DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+                    DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
+                    DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+
+                    DMSwarmRemovePointAtIndex(radSearch, ipart);  //!< Delete the particle!
+                    DMSwarmGetLocalSize(radSearch, &npoints);
+
+                    DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+                    DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+                    DMSwarmGetField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
+                    DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+                    ipart--;  //!< Check the point replacing the one that was deleted
+                } else {
+                    /** Step 4: Push the particle virtual coordinates to the intersection that was found in the previous step.
+                     * This ensures that the next calculated path length will start from the boundary of the adjacent cell.
+                     * */
+                    virtualcoord[ipart].x += virtualcoord[ipart].xdir * virtualcoord[ipart].hhere;
+                    virtualcoord[ipart].y += virtualcoord[ipart].ydir * virtualcoord[ipart].hhere;
+                    virtualcoord[ipart].z += virtualcoord[ipart].zdir * virtualcoord[ipart].hhere;  //!< Only use the literal intersection coordinate if it exists. This will be decided above.
+
+                    /** Step 5: Instead of using the cell face to step into the opposite cell, step the physical coordinates just beyond the intersection.
+                     * This avoids issues with hitting corners and potential ghost cell weirdness.
+                     * It will be slower than the face flipping but it will be more reliable.
+                     * Update the coordinates of the particle.
+                     * It doesn't matter which method is used,
+                     * this will be the same procedure.
+                     * */
+                    UpdateCoordinates(ipart, virtualcoord, coord, 0.1);  //!< Update the coordinates of the particle to move it beyond the face of the adjacent cell.
+                    virtualcoord[ipart].hhere = 0;                       //!< Reset the path length to zero
+                }
             }
+            /** Restore the fields associated with the particles after all of the particles have been stepped */
+            DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+            DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+            DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
+            DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+
+            //! Find the next cell for each stepped particle on this rank, or leave them all for the migration to locate
+            nlocalMarching = marchLocally ? LocateLocalParticles(subDomain) : 0;
+            DMSwarmGetLocalSize(radSearch, &npoints) >> utilities::PetscUtilities::checkError;
         }
-        /** Restore the fields associated with the particles after all of the particles have been stepped */
-        DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, IdentifierField, nullptr, nullptr, (void**)&identifier) >> utilities::PetscUtilities::checkError;
-        DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
 
         if (log) log->Printf("Migrate ...");
 
@@ -335,22 +373,27 @@ void ablate::radiation::Radiation::Initialize(const ablate::domain::Range& cellR
         utilities::PetscUtilities::checkError;  //!< Get the fields from the radsolve swarm so the new point can be written to them
     DMDestroy(&radReturn) >> utilities::PetscUtilities::checkError;
 
-    // Create the remote access structure
+    // Flatten the segments and create the remote access structure
+    BuildRaySegmentStorage();
+    CreateRemoteAccess((PetscInt)raySegmentOffsets.size() - 1, uniqueRaySegments, remoteRayInformation, numberOfReturnedSegments);
+    rayDataReady = true;
+    EndEvent();
+}
+
+void ablate::radiation::Radiation::CreateRemoteAccess(PetscInt numberLocalRays, PetscInt numberLeaves, PetscSFNode* remoteRayInformation, PetscInt numberReturnedSegments) {
     PetscSFCreate(PETSC_COMM_WORLD, &remoteAccess) >> utilities::PetscUtilities::checkError;
     PetscSFSetFromOptions(remoteAccess) >> utilities::PetscUtilities::checkError;
-    PetscSFSetGraph(remoteAccess, (PetscInt)raySegments.size(), uniqueRaySegments, nullptr, PETSC_OWN_POINTER, remoteRayInformation, PETSC_OWN_POINTER) >> utilities::PetscUtilities::checkError;
+    PetscSFSetGraph(remoteAccess, numberLocalRays, numberLeaves, nullptr, PETSC_OWN_POINTER, remoteRayInformation, PETSC_OWN_POINTER) >> utilities::PetscUtilities::checkError;
     PetscSFSetUp(remoteAccess) >> utilities::PetscUtilities::checkError;
 
     // Size up the memory to hold the local calculations and the retrieved information
-    raySegmentsCalculations.resize(raySegments.size() * absorptivityFunction.propertySize);
-    raySegmentSummary.resize(numberOfReturnedSegments * absorptivityFunction.propertySize);
-    evaluatedGains.resize(numberOriginCells * absorptivityFunction.propertySize);  //! Size each of the entries to hold all of the wavelengths being transported.
+    raySegmentsCalculations.resize(2 * numberLocalRays * absorptivityFunction.propertySize);
+    raySegmentSummary.resize(2 * numberReturnedSegments * absorptivityFunction.propertySize);
 
-    // Create a mpi data type to allow reducing the remoteRayCalculation to raySegmentSummary
-    PetscInt count = 2 * absorptivityFunction.propertySize;  //! = 2 * (the number of independant wavelengths that are being considered). Should be read from absorption model.
-    MPI_Type_contiguous(count, MPIU_REAL, &carrierMpiType) >> utilities::MpiUtilities::checkError;
-    MPI_Type_commit(&carrierMpiType) >> utilities::MpiUtilities::checkError;
-    EndEvent();
+    // size up the property storage
+    cellAbsorptivity.resize(propertyCells.size() * absorptivityFunction.propertySize);
+    cellEmission.resize(propertyCells.size() * absorptivityFunction.propertySize);
+    cellPropertyAvailable.resize(propertyCells.size(), PETSC_FALSE);
 }
 
 void ablate::radiation::Radiation::UpdateCoordinates(PetscInt ipart, Virtualcoord* virtualcoord, PetscReal* coord, PetscReal adv) const {
@@ -534,6 +577,9 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
 }
 
 void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
+    if (!rayDataReady) {
+        TraceRays();
+    }
     StartEvent((GetClassType() + "::EvaluateGains").c_str());
 
     unsigned short int propertySize = static_cast<unsigned short int>(absorptivityFunction.propertySize);
@@ -554,49 +600,57 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
     auto absorptivityFunctionContext = absorptivityFunction.context.get();
     auto emissivityFunctionContext = emissivityFunction.context.get();
 
+    // Evaluate the absorptivity and emission once for each cell crossed by a local ray
+    for (std::size_t p = 0; p < propertyCells.size(); ++p) {
+        const PetscReal* sol = nullptr;          //!< The solution value at any given location
+        const PetscReal* temperature = nullptr;  //!< The temperature at any given location
+        cellPropertyAvailable[p] = PETSC_FALSE;
+        DMPlexPointLocalRead(solDm, propertyCells[p], solArray, &sol);
+        if (sol) {
+            DMPlexPointLocalFieldRead(auxDm, propertyCells[p], temperatureField.id, auxArray, &temperature);
+            if (temperature) { /** Input absorptivity (kappa) values from model here. */
+                absorptivityFunction.function(sol, *temperature, cellAbsorptivity.data() + propertySize * p, absorptivityFunctionContext);
+                emissivityFunction.function(sol, *temperature, cellEmission.data() + propertySize * p, emissivityFunctionContext);
+                cellPropertyAvailable[p] = PETSC_TRUE;
+            }
+        }
+    }
+
     // Start by marching over all rays in this rank
-    for (std::size_t raySegmentIndex = 0; raySegmentIndex < raySegments.size(); ++raySegmentIndex) {
+    const std::size_t numberRays = raySegmentOffsets.empty() ? 0 : raySegmentOffsets.size() - 1;
+    for (std::size_t rayIndex = 0; rayIndex < numberRays; ++rayIndex) {
         //! Zero this ray segment for all wavelengths
-        for (unsigned short int wavelengthIndex = 0; wavelengthIndex < static_cast<unsigned short int>(absorptivityFunction.propertySize);
-             wavelengthIndex++) {  //! Iterate through every wavelength entry in this ray segment
-            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij = 0.0;
-            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad = 1.0;
+        PetscReal* segmentIj = raySegmentsCalculations.data() + 2 * propertySize * rayIndex;
+        PetscReal* segmentKrad = segmentIj + propertySize;
+        for (unsigned short int wavelengthIndex = 0; wavelengthIndex < propertySize; wavelengthIndex++) {  //! Iterate through every wavelength entry in this ray segment
+            segmentIj[wavelengthIndex] = 0.0;
+            segmentKrad[wavelengthIndex] = 1.0;
         }
 
         // compute the Ij and Krad for this segment starting at the point closest to the ray origin
-        const auto& raySegment =
-            raySegments[raySegmentIndex];  //! This is allowed to be cast to auto and indexed raySegmentIndex because there is only one physical ray segment that we are reading from.
+        for (PetscInt s = raySegmentOffsets[rayIndex]; s < raySegmentOffsets[rayIndex + 1]; ++s) {
+            const auto propertyIndex = segmentPropertyIndices[s];
+            if (!cellPropertyAvailable[propertyIndex]) {
+                continue;
+            }
+            //! Get the pointer to the precomputed array of absorption values. Iterate through every wavelength for the evaluation.
+            const PetscReal* kappa = cellAbsorptivity.data() + propertySize * propertyIndex;
+            const PetscReal* emission = cellEmission.data() + propertySize * propertyIndex;
+            const PetscReal pathLength = segmentPathLengths[s];
+            if (pathLength < 0) {
+                // This is a boundary cell
+                for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
+                    segmentIj[wavelengthIndex] += emission[wavelengthIndex] * segmentKrad[wavelengthIndex];
+                    //! In the future we may want to set this intensity with a boundary condition class.
+                }
+            } else {
+                // This is not a boundary cell
+                for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
+                    PetscReal absorbed_portion = exp(-kappa[wavelengthIndex] * pathLength);
+                    segmentIj[wavelengthIndex] += emission[wavelengthIndex] * (1 - absorbed_portion) * segmentKrad[wavelengthIndex];
 
-        for (const auto& cellSegment : raySegment) {
-            const PetscReal* sol = nullptr;          //!< The solution value at any given location
-            const PetscReal* temperature = nullptr;  //!< The temperature at any given location
-            DMPlexPointLocalRead(solDm, cellSegment.cell, solArray, &sol);
-            if (sol) {
-                DMPlexPointLocalFieldRead(auxDm, cellSegment.cell, temperatureField.id, auxArray, &temperature);
-                if (temperature) {                                       /** Input absorptivity (kappa) values from model here. */
-                    PetscReal kappa[absorptivityFunction.propertySize];  //!< Absorptivity coefficient, property of each cell. This is an array that we will iterate through for every evaluation
-                    PetscReal emission[absorptivityFunction.propertySize];
-                    absorptivityFunction.function(sol, *temperature, kappa, absorptivityFunctionContext);  //! Get the absorption and emission information from the provided properties models.
-                    emissivityFunction.function(sol, *temperature, emission, emissivityFunctionContext);
-                    //! Get the pointer to the returned array of absorption values. Iterate through every wavelength for the evaluation.
-                    if (cellSegment.pathLength < 0) {
-                        // This is a boundary cell
-                        for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij +=
-                                emission[wavelengthIndex] * raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad;
-                            //! In the future we may want to set this intensity with a boundary condition class.
-                        }
-                    } else {
-                        // This is not a boundary cell
-                        for (int wavelengthIndex = 0; wavelengthIndex < propertySize; ++wavelengthIndex) {
-                            PetscReal absorbed_portion = exp(-kappa[wavelengthIndex] * cellSegment.pathLength);
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Ij +=
-                                emission[wavelengthIndex] * (1 - absorbed_portion) * raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad;
-
-                            // Compute the total absorption for this domain
-                            raySegmentsCalculations[absorptivityFunction.propertySize * raySegmentIndex + wavelengthIndex].Krad *= absorbed_portion;
-                        }
-                    }
+                    // Compute the total absorption for this domain
+                    segmentKrad[wavelengthIndex] *= absorbed_portion;
                 }
             }
         }
@@ -613,6 +667,7 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
      * raySegmentsPerOriginRay: This only stores the number of segments in each ray. There is no reason to index this with wavelength.
      *  Therefore, the indexing is [rayOffset], where the ray refers to the wavelength independent ray count.
      * raySegmentSummary: This will store a value for every ray segment and wavelength. Each ray will integrate its ray segments together for every wavelength.
+     *  Therefore, the indexing is [2 * propertySize * segment + i] for Ij and [2 * propertySize * segment + propertySize + i] for Krad.
      * */
     std::size_t segmentOffset = 0;
     std::size_t rayOffset = 0;
@@ -634,9 +689,11 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
              * Therefore, we should first iterate through the wavelengths first and sum the effects of every wavelength on every cell.
              */
             for (unsigned short int s = 0; s < raySegmentsPerOriginRay[rayOffset]; ++s) {
+                const PetscReal* segmentIj = raySegmentSummary.data() + 2 * propertySize * segmentOffset;
+                const PetscReal* segmentKrad = segmentIj + propertySize;
                 for (unsigned short int wavelengthIndex = 0; wavelengthIndex < propertySize; wavelengthIndex++) {
-                    iSource[wavelengthIndex] += raySegmentSummary[absorptivityFunction.propertySize * segmentOffset + wavelengthIndex].Ij * kRadd[wavelengthIndex];
-                    kRadd[wavelengthIndex] *= raySegmentSummary[absorptivityFunction.propertySize * segmentOffset + wavelengthIndex].Krad;
+                    iSource[wavelengthIndex] += segmentIj[wavelengthIndex] * kRadd[wavelengthIndex];
+                    kRadd[wavelengthIndex] *= segmentKrad[wavelengthIndex];
                 }
                 segmentOffset++;
             }
@@ -653,6 +710,328 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
     EndEvent();
 }
 
+PetscInt ablate::radiation::Radiation::LocateLocalParticles(ablate::domain::SubDomain& subDomain) {
+    PetscInt npoints;
+    DMSwarmGetLocalSize(radSearch, &npoints) >> utilities::PetscUtilities::checkError;
+
+    PetscReal* coord;
+    PetscInt* index;
+    struct Virtualcoord* virtualcoord;
+    DMSwarmGetField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+    DMSwarmGetField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+    DMSwarmGetField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+
+    // only the particles that were stepped in this pass need to be located
+    std::vector<PetscInt> steppedParticles;
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (index[ipart] != AwaitingMigrationCell) {
+            steppedParticles.push_back(ipart);
+        }
+    }
+
+    Vec locVec;
+    VecCreateSeq(PETSC_COMM_SELF, (PetscInt)steppedParticles.size() * dim, &locVec) >> utilities::PetscUtilities::checkError;
+    VecSetBlockSize(locVec, dim) >> utilities::PetscUtilities::checkError;
+    PetscScalar* locArray;
+    VecGetArray(locVec, &locArray) >> utilities::PetscUtilities::checkError;
+    for (std::size_t p = 0; p < steppedParticles.size(); p++) {
+        for (PetscInt d = 0; d < dim; d++) {
+            locArray[p * dim + d] = coord[steppedParticles[p] * dim + d];
+        }
+    }
+    VecRestoreArray(locVec, &locArray) >> utilities::PetscUtilities::checkError;
+
+    // this is the same local search used by the DMSwarmMigrate, so a particle is only kept here if the migration would have kept it
+    PetscSF cellSF = nullptr;
+    DMLocatePoints(subDomain.GetDM(), locVec, DM_POINTLOCATION_NONE, &cellSF) >> utilities::PetscUtilities::checkError;
+    const PetscSFNode* cells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &cells) >> utilities::PetscUtilities::checkError;
+
+    PetscInt nlocalMarching = 0;
+    for (std::size_t p = 0; p < steppedParticles.size(); p++) {
+        auto ipart = steppedParticles[p];
+        if (cells[p].index >= 0) {
+            index[ipart] = cells[p].index;
+            nlocalMarching++;
+        } else {
+            index[ipart] = AwaitingMigrationCell;
+        }
+    }
+
+    // the particle step may have set a path length on the waiting particles, reset it so the next rank starts at the face
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (index[ipart] == AwaitingMigrationCell) {
+            virtualcoord[ipart].hhere = 0;
+        }
+    }
+
+    PetscSFDestroy(&cellSF) >> utilities::PetscUtilities::checkError;
+    VecDestroy(&locVec) >> utilities::PetscUtilities::checkError;
+    DMSwarmRestoreField(radSearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> utilities::PetscUtilities::checkError;
+    DMSwarmRestoreField(radSearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> utilities::PetscUtilities::checkError;
+    DMSwarmRestoreField(radSearch, VirtualCoordField, nullptr, nullptr, (void**)&virtualcoord) >> utilities::PetscUtilities::checkError;
+    return nlocalMarching;
+}
+
+void ablate::radiation::Radiation::BuildRaySegmentStorage() {
+    // collect each unique cell crossed by a local ray segment
+    propertyCells.clear();
+    for (const auto& raySegment : raySegments) {
+        for (const auto& cellSegment : raySegment) {
+            propertyCells.push_back(cellSegment.cell);
+        }
+    }
+    std::sort(propertyCells.begin(), propertyCells.end());
+    propertyCells.erase(std::unique(propertyCells.begin(), propertyCells.end()), propertyCells.end());
+
+    // flatten the segments, pointing each segment at its property cell
+    raySegmentOffsets.assign(1, 0);
+    segmentPathLengths.clear();
+    segmentPropertyIndices.clear();
+    for (const auto& raySegment : raySegments) {
+        for (const auto& cellSegment : raySegment) {
+            segmentPathLengths.push_back(cellSegment.pathLength);
+            segmentPropertyIndices.push_back((PetscInt)std::distance(propertyCells.begin(), std::lower_bound(propertyCells.begin(), propertyCells.end(), cellSegment.cell)));
+        }
+        raySegmentOffsets.push_back((PetscInt)segmentPathLengths.size());
+    }
+    std::vector<std::vector<CellSegment>>().swap(raySegments);
+}
+
+void ablate::radiation::Radiation::ComputeMeshFingerprint(const ablate::domain::Range& cellRange, ablate::domain::SubDomain& subDomain) {
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(subDomain.GetDM(), 0, &cStart, &cEnd) >> utilities::PetscUtilities::checkError;
+
+    // weight each cell centroid by its point so that a renumbering or repartition changes the sum
+    DM cellDM;
+    const PetscScalar* cellGeomArray;
+    VecGetDM(cellGeomVec, &cellDM) >> utilities::PetscUtilities::checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+    PetscReal centroidSum = 0.0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(cellDM, c, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+        for (PetscInt d = 0; d < dim; ++d) {
+            centroidSum += (PetscReal)(c + 1) * (PetscReal)(d + 1) * cellGeom->centroid[d];
+        }
+    }
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
+
+    PetscReal originSum = 0.0;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        originSum += (PetscReal)(cellRange.points ? cellRange.points[c] : c);
+    }
+
+    meshFingerprint = {(PetscReal)(cEnd - cStart), centroidSum, (PetscReal)numberOriginCells, originSum, (PetscReal)nTheta, (PetscReal)nPhi, minCellRadius};
+}
+
+/**
+ * Saves the local values from each rank to a single dataset.  Integer values are written to an integer dataset so that large indices are not rounded.
+ */
+template <class T>
+static PetscErrorCode SaveRayData(PetscViewer viewer, const std::string& name, const std::vector<T>& data) {
+    PetscFunctionBeginUser;
+    if constexpr (std::is_integral_v<T>) {
+        std::vector<PetscInt> intData(data.begin(), data.end());
+        IS dataIs;
+        PetscCall(ISCreateGeneral(PetscObjectComm((PetscObject)viewer), (PetscInt)intData.size(), intData.data(), PETSC_USE_POINTER, &dataIs));
+        PetscCall(PetscObjectSetName((PetscObject)dataIs, name.c_str()));
+        PetscCall(ISView(dataIs, viewer));
+        PetscCall(ISDestroy(&dataIs));
+    } else {
+        Vec dataVec;
+        PetscCall(VecCreateMPI(PetscObjectComm((PetscObject)viewer), (PetscInt)data.size(), PETSC_DETERMINE, &dataVec));
+        PetscCall(PetscObjectSetName((PetscObject)dataVec, name.c_str()));
+        PetscScalar* dataArray;
+        PetscCall(VecGetArray(dataVec, &dataArray));
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            dataArray[i] = (PetscScalar)data[i];
+        }
+        PetscCall(VecRestoreArray(dataVec, &dataArray));
+        PetscCall(VecView(dataVec, viewer));
+        PetscCall(VecDestroy(&dataVec));
+    }
+    PetscFunctionReturn(0);
+}
+
+/**
+ * Loads the local values for this rank, the local size must match the saved size
+ */
+template <class T>
+static PetscErrorCode LoadRayData(PetscViewer viewer, const std::string& name, PetscInt localSize, std::vector<T>& data) {
+    PetscFunctionBeginUser;
+    data.resize(localSize);
+    if constexpr (std::is_integral_v<T>) {
+        // set the layout so that each rank reads back its own values
+        PetscLayout dataLayout;
+        PetscCall(PetscLayoutCreateFromSizes(PetscObjectComm((PetscObject)viewer), localSize, PETSC_DECIDE, 1, &dataLayout));
+        IS dataIs;
+        PetscCall(ISCreate(PetscObjectComm((PetscObject)viewer), &dataIs));
+        PetscCall(ISSetType(dataIs, ISGENERAL));
+        PetscCall(ISSetLayout(dataIs, dataLayout));
+        PetscCall(PetscLayoutDestroy(&dataLayout));
+        PetscCall(PetscObjectSetName((PetscObject)dataIs, name.c_str()));
+        PetscCall(ISLoad(dataIs, viewer));
+        const PetscInt* dataArray;
+        PetscCall(ISGetIndices(dataIs, &dataArray));
+        for (PetscInt i = 0; i < localSize; ++i) {
+            data[i] = (T)dataArray[i];
+        }
+        PetscCall(ISRestoreIndices(dataIs, &dataArray));
+        PetscCall(ISDestroy(&dataIs));
+    } else {
+        Vec dataVec;
+        PetscCall(VecCreateMPI(PetscObjectComm((PetscObject)viewer), localSize, PETSC_DETERMINE, &dataVec));
+        PetscCall(PetscObjectSetName((PetscObject)dataVec, name.c_str()));
+        PetscCall(VecLoad(dataVec, viewer));
+        const PetscScalar* dataArray;
+        PetscCall(VecGetArrayRead(dataVec, &dataArray));
+        for (PetscInt i = 0; i < localSize; ++i) {
+            data[i] = (T)PetscRealPart(dataArray[i]);
+        }
+        PetscCall(VecRestoreArrayRead(dataVec, &dataArray));
+        PetscCall(VecDestroy(&dataVec));
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::radiation::Radiation::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    PetscFunctionBeginUser;
+    if (!rayDataReady) {
+        TraceRays();
+    }
+
+    // the ray data does not change, so it is only written once to each file
+    const auto rayGroup = "/" + solverId + "_rays";
+    PetscBool hasRayData;
+    PetscCall(PetscViewerHDF5HasGroup(viewer, rayGroup.c_str(), &hasRayData));
+    if (hasRayData) {
+        PetscFunctionReturn(0);
+    }
+
+    // the ray data is not time dependent
+    PetscBool isTimestepping;
+    PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isTimestepping));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+    PetscCall(PetscViewerHDF5PushGroup(viewer, rayGroup.c_str()));
+
+    PetscMPIInt size;
+    PetscCallMPI(MPI_Comm_size(raySubDomain->GetComm(), &size));
+    PetscCall(SaveKeyValue(viewer, "ranks", size));
+
+    // record the size of each local array
+    PetscInt numberLeaves;
+    const PetscSFNode* remoteRayInformation;
+    PetscCall(PetscSFGetGraph(remoteAccess, nullptr, &numberLeaves, nullptr, &remoteRayInformation));
+    std::vector<PetscInt> sizes = {(PetscInt)raySegmentOffsets.size() - 1,
+                                   (PetscInt)segmentPathLengths.size(),
+                                   (PetscInt)propertyCells.size(),
+                                   numberLeaves,
+                                   (PetscInt)(raySegmentSummary.size() / (2 * absorptivityFunction.propertySize))};
+    std::vector<PetscInt> leafRanks(numberLeaves);
+    std::vector<PetscInt> leafIndices(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        leafRanks[l] = remoteRayInformation[l].rank;
+        leafIndices[l] = remoteRayInformation[l].index;
+    }
+
+    PetscCall(SaveRayData(viewer, "fingerprint", meshFingerprint));
+    PetscCall(SaveRayData(viewer, "sizes", sizes));
+    PetscCall(SaveRayData(viewer, "raySegmentsPerOriginRay", raySegmentsPerOriginRay));
+    PetscCall(SaveRayData(viewer, "raySegmentOffsets", raySegmentOffsets));
+    PetscCall(SaveRayData(viewer, "segmentPathLengths", segmentPathLengths));
+    PetscCall(SaveRayData(viewer, "segmentPropertyIndices", segmentPropertyIndices));
+    PetscCall(SaveRayData(viewer, "propertyCells", propertyCells));
+    PetscCall(SaveRayData(viewer, "leafRanks", leafRanks));
+    PetscCall(SaveRayData(viewer, "leafIndices", leafIndices));
+
+    PetscCall(PetscViewerHDF5PopGroup(viewer));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::radiation::Radiation::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    PetscFunctionBeginUser;
+    if (rayDataReady || !raySubDomain) {
+        PetscFunctionReturn(0);
+    }
+
+    // older checkpoints will not hold any rays
+    const auto rayGroup = "/" + solverId + "_rays";
+    PetscBool hasRayData;
+    PetscCall(PetscViewerHDF5HasGroup(viewer, rayGroup.c_str(), &hasRayData));
+    if (!hasRayData) {
+        PetscFunctionReturn(0);
+    }
+
+    PetscBool isTimestepping;
+    PetscCall(PetscViewerHDF5IsTimestepping(viewer, &isTimestepping));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PopTimestepping(viewer));
+    }
+    PetscCall(PetscViewerHDF5PushGroup(viewer, rayGroup.c_str()));
+
+    // the saved rays can only be used with the same number of ranks
+    PetscMPIInt size;
+    PetscCallMPI(MPI_Comm_size(raySubDomain->GetComm(), &size));
+    PetscMPIInt savedSize;
+    PetscCall(RestoreKeyValue(viewer, "ranks", savedSize));
+
+    // and the same mesh and partition on every rank
+    PetscBool match = PETSC_FALSE;
+    if (savedSize == size) {
+        std::vector<PetscReal> savedFingerprint;
+        PetscCall(LoadRayData(viewer, "fingerprint", (PetscInt)meshFingerprint.size(), savedFingerprint));
+        match = savedFingerprint == meshFingerprint ? PETSC_TRUE : PETSC_FALSE;
+    }
+    PetscCallMPI(MPI_Allreduce(MPI_IN_PLACE, &match, 1, MPIU_BOOL, MPI_LAND, raySubDomain->GetComm()));
+
+    if (match) {
+        std::vector<PetscInt> sizes;
+        PetscCall(LoadRayData(viewer, "sizes", 5, sizes));
+        const auto numberLocalRays = sizes[0];
+        const auto numberSegments = sizes[1];
+        const auto numberPropertyCells = sizes[2];
+        const auto numberLeaves = sizes[3];
+        const auto numberReturnedSegments = sizes[4];
+
+        std::vector<PetscInt> leafRanks;
+        std::vector<PetscInt> leafIndices;
+        PetscCall(LoadRayData(viewer, "raySegmentsPerOriginRay", numberOriginRays, raySegmentsPerOriginRay));
+        PetscCall(LoadRayData(viewer, "raySegmentOffsets", numberLocalRays + 1, raySegmentOffsets));
+        PetscCall(LoadRayData(viewer, "segmentPathLengths", numberSegments, segmentPathLengths));
+        PetscCall(LoadRayData(viewer, "segmentPropertyIndices", numberSegments, segmentPropertyIndices));
+        PetscCall(LoadRayData(viewer, "propertyCells", numberPropertyCells, propertyCells));
+        PetscCall(LoadRayData(viewer, "leafRanks", numberLeaves, leafRanks));
+        PetscCall(LoadRayData(viewer, "leafIndices", numberLeaves, leafIndices));
+
+        PetscSFNode* remoteRayInformation;
+        PetscCall(PetscMalloc1(numberLeaves, &remoteRayInformation));
+        for (PetscInt l = 0; l < numberLeaves; ++l) {
+            remoteRayInformation[l].rank = leafRanks[l];
+            remoteRayInformation[l].index = leafIndices[l];
+        }
+        CreateRemoteAccess(numberLocalRays, numberLeaves, remoteRayInformation, numberReturnedSegments);
+
+        // the search is no longer needed
+        std::vector<std::vector<CellSegment>>().swap(raySegments);
+        PetscCall(DMDestroy(&radSearch));
+        rayDataReady = true;
+    } else if (log) {
+        log->Printf("The saved rays for %s do not match the mesh and will be traced again\n", solverId.c_str());
+    }
+
+    PetscCall(PetscViewerHDF5PopGroup(viewer));
+    if (isTimestepping) {
+        PetscCall(PetscViewerHDF5PushTimestepping(viewer));
+    }
+    PetscFunctionReturn(0);
+}
+
 void ablate::radiation::Radiation::DeleteOutOfBounds(ablate::domain::SubDomain& subDomain) {
     PetscReal* coord;
     PetscInt* index;                    //!< Pointer to the coordinate field information
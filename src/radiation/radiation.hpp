@@ -12,6 +12,7 @@
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/finiteVolumeSolver.hpp"
 #include "io/interval/interval.hpp"
+#include "io/serializable.hpp"
 #include "monitors/logs/log.hpp"
 #include "solver/cellSolver.hpp"
 #include "solver/timeStepper.hpp"
@@ -22,8 +23,8 @@
 
 namespace ablate::radiation {
 
-class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver provides cell based functionality, right hand side function compatibility with
-                                                              //!< finite element/ volume, loggable allows for the timing and tracking of events
+class Radiation : protected utilities::Loggable<Radiation>, public io::Serializable {  //!< Cell solver provides cell based functionality, right hand side function compatibility with
+                                                                                     //!< finite element/ volume, loggable allows for the timing and tracking of events
 
    public:
     /**
@@ -32,9 +33,10 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      * @param region the boundary cell region
      * @param rayNumber
      * @param options other options
+     * @param marchLocally march the search particles on each rank between migrations, when false every particle step is followed by a migration
      */
     Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber, std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn,
-              std::shared_ptr<ablate::monitors::logs::Log> = {});
+              std::shared_ptr<ablate::monitors::logs::Log> = {}, bool marchLocally = true);
 
     virtual ~Radiation();
 
@@ -54,13 +56,6 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
         PetscInt nSegment;
     };
 
-    /** Carriers are attached to the solve particles and bring ray information from the local segments to the origin cells
-     * They are transported directly from the segment to the origin. They carry only the values that the Segment computes and not the spatial information necessary to  */
-    struct Carrier {
-        PetscReal Ij = 0;    //!< Black body source for the segment. Make sure that this is reset every solve after the value has been transported.
-        PetscReal Krad = 1;  //!< Absorption for the segment. Make sure that this is reset every solve after the value has been transported.
-    };
-
     /**
      * Returns the black body intensity for a given temperature and emissivity
      * @param temperature
@@ -98,6 +93,7 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     virtual void Setup(const ablate::domain::Range& cellRange, ablate::domain::SubDomain& subDomain);
 
     /**
+     * Prepares the solver for the ray search.  The rays are traced the first time they are needed, allowing them to be restored from a checkpoint instead.
      * @param cellRange The range of cells for which rays are initialized
      */
     virtual void Initialize(const ablate::domain::Range& cellRange, ablate::domain::SubDomain& subDomain);
@@ -133,7 +129,24 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     // Each radiation surface property will be evaluated on the EvaluateGains call.
     // Each property can be output separately.
 
-    inline std::string GetId() { return solverId; };
+    [[nodiscard]] const std::string& GetId() const override { return solverId; }
+
+    /**
+     * Save the traced ray segments and remote access graph.  The rays are traced first if they have not been.
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * Restore the traced ray segments and remote access graph.  The saved rays are only used if the mesh and partition match the saved fingerprint,
+     * otherwise they are traced again when needed.
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
 
     inline eos::ThermodynamicTemperatureFunction GetAbsorptionFunction() { return absorptivityFunction; };
 
@@ -213,6 +226,39 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      */
     void DeleteOutOfBounds(ablate::domain::SubDomain& subDomain);
 
+    /**
+     * Locates the stepped search particles in the local partition so they can keep marching without a migration.  Particles that have left the local partition are
+     * marked with the AwaitingMigrationCell and skipped until the next DMSwarmMigrate.
+     * @param subDomain
+     * @return the number of particles that can keep marching on this rank
+     */
+    PetscInt LocateLocalParticles(ablate::domain::SubDomain& subDomain);
+
+    /**
+     * Flattens the raySegments found during the search into the compressed segment storage and builds the unique list of cells crossed by the local ray segments.
+     * The raySegments are cleared afterwards.
+     */
+    void BuildRaySegmentStorage();
+
+    /**
+     * Marches the search particles through the domain to build the ray segments and the remote access graph.  This is collective and only done once.
+     */
+    void TraceRays();
+
+    /**
+     * Creates the remoteAccess graph and sizes the ray calculation and property storage for the local rays
+     * @param numberLocalRays the number of local/remote ray segments stored on this rank
+     * @param numberLeaves the number of unique ray segments belonging to the origin rays
+     * @param remoteRayInformation the location of each ray segment, ownership is passed to the graph
+     * @param numberReturnedSegments the number of segments reported back to the origin rays
+     */
+    void CreateRemoteAccess(PetscInt numberLocalRays, PetscInt numberLeaves, PetscSFNode* remoteRayInformation, PetscInt numberReturnedSegments);
+
+    /**
+     * Computes the values used to check that a saved ray search matches this mesh and partition
+     */
+    void ComputeMeshFingerprint(const ablate::domain::Range& cellRange, ablate::domain::SubDomain& subDomain);
+
     virtual void SetBoundary(CellSegment& raySegment, PetscInt index, Identifier identifier) {
         raySegment.cell = index;
         raySegment.pathLength = -1;
@@ -224,11 +270,19 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     PetscInt nPhi;     //!< The number of angles to solve with, given by user input (x2)
     PetscReal minCellRadius{};
 
-    //! store the local rays identified on this rank.  This includes rays that do and do not originate on this rank
+    //! store the local rays identified on this rank during the search.  This includes rays that do and do not originate on this rank
     std::vector<std::vector<CellSegment>> raySegments;
 
-    //! the calculation over each of the remoteRays. indexed over remote ray
-    std::vector<Carrier> raySegmentsCalculations;
+    //! the local ray segments stored in compressed rows.  The segments for ray r are [raySegmentOffsets[r], raySegmentOffsets[r + 1])
+    std::vector<PetscInt> raySegmentOffsets;
+    std::vector<PetscReal> segmentPathLengths;
+    std::vector<PetscInt> segmentPropertyIndices;
+
+    /**
+     * the calculation over each of the remoteRays. Each ray holds the black body source (Ij) for every wavelength followed by the absorption (Krad) for every wavelength
+     * so that the wavelength loops are contiguous.  This is the block moved by the carrierMpiType.
+     */
+    std::vector<PetscReal> raySegmentsCalculations;
 
     //! store the number of originating rays
     PetscInt numberOriginRays;
@@ -242,8 +296,8 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     //! store the number of ray segments for each originating on this rank.  This may be zero
     std::vector<unsigned short int> raySegmentsPerOriginRay;
 
-    //! a vector of raySegment information for every local/remote ray segment ordered as ray, segment
-    std::vector<Carrier> raySegmentSummary;
+    //! a vector of raySegment information for every local/remote ray segment ordered as ray, segment with the same layout as the raySegmentsCalculations
+    std::vector<PetscReal> raySegmentSummary;
 
     //! the factor for each origin ray
     std::vector<PetscReal> gainsFactor;
@@ -251,9 +305,31 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     //! size up the evaluated gains, this index is based upon order of the requested cells
     std::vector<PetscScalar> evaluatedGains;
 
+    //! the unique cells crossed by any local ray segment, the properties are only evaluated once for each of these cells
+    std::vector<PetscInt> propertyCells;
+
+    //! the absorptivity and emission for each property cell, indexed [propertyIndex][wavelength]
+    std::vector<PetscReal> cellAbsorptivity;
+    std::vector<PetscReal> cellEmission;
+
+    //! true if the solution and temperature were available to evaluate the properties for this property cell
+    std::vector<PetscBool> cellPropertyAvailable;
+
     //! Store the petscSF that is used for pulling remote ray calculation
     PetscSF remoteAccess = nullptr;
 
+    //! the subDomain passed to Initialize, used to trace the rays once they are needed
+    ablate::domain::SubDomain* raySubDomain = nullptr;
+
+    //! true once the rays have been traced or restored
+    bool rayDataReady = false;
+
+    //! march the search particles on each rank between migrations.  When false every particle step is followed by a migration
+    const bool marchLocally;
+
+    //! local values describing the mesh, partition, and origin rays used to check a saved ray search
+    std::vector<PetscReal> meshFingerprint;
+
     //! the name of this solver
     std::string solverId;
 
@@ -271,6 +347,8 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     const std::shared_ptr<ablate::monitors::logs::Log> log = nullptr;
     static inline constexpr char IdentifierField[] = "identifier";
     static inline constexpr char VirtualCoordField[] = "virtual coord";
+    //! the cell id used to mark search particles that have left the local partition and are waiting to be migrated
+    static inline constexpr PetscInt AwaitingMigrationCell = -2;
 
    public:
     /**
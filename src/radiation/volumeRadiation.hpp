@@ -7,7 +7,7 @@
 
 namespace ablate::radiation {
 
-class VolumeRadiation : public solver::CellSolver, public solver::RHSFunction {
+class VolumeRadiation : public solver::CellSolver, public solver::RHSFunction, public io::Serializable {
    public:
     /**
      * Function passed into PETSc to compute the FV RHS
@@ -43,6 +43,28 @@ class VolumeRadiation : public solver::CellSolver, public solver::RHSFunction {
      */
     PetscErrorCode PreRHSFunction(TS ts, PetscReal time, bool initialStage, Vec locX) override;
 
+    /**
+     * the traced rays are serialized by the radiation solver
+     * @return
+     */
+    [[nodiscard]] const std::string& GetId() const override { return radiation->GetId(); }
+
+    /**
+     * Save the traced rays to the PetscViewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override { return radiation->Save(viewer, sequenceNumber, time); }
+
+    /**
+     * Restore the traced rays from the PetscViewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    PetscErrorCode Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override { return radiation->Restore(viewer, sequenceNumber, time); }
+
    private:
     const std::shared_ptr<io::interval::Interval> interval;
     std::shared_ptr<ablate::radiation::Radiation> radiation;
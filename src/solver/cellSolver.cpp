@@ -1,4 +1,5 @@
 #include "cellSolver.hpp"
+#include <algorithm>
 #include <utility>
 
 ablate::solver::CellSolver::CellSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options)
@@ -15,8 +16,15 @@ ablate::solver::CellSolver::~CellSolver() {
 
 void ablate::solver::CellSolver::RegisterAuxFieldUpdate(ablate::solver::CellSolver::AuxFieldUpdateFunction function, void* context, const std::vector<std::string>& auxFields,
                                                         const std::vector<std::string>& inputFields) {
-    AuxFieldUpdateFunctionDescription functionDescription{.function = function, .context = context, .inputFields = {}, .auxFields = {}};
+    AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription{.function = function, .batchFunction = nullptr, .context = context, .inputFields = {}, .auxFields = {}}, auxFields, inputFields);
+}
 
+void ablate::solver::CellSolver::RegisterAuxFieldUpdate(ablate::solver::CellSolver::AuxFieldBatchUpdateFunction function, void* context, const std::vector<std::string>& auxFields,
+                                                        const std::vector<std::string>& inputFields) {
+    AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription{.function = nullptr, .batchFunction = function, .context = context, .inputFields = {}, .auxFields = {}}, auxFields, inputFields);
+}
+
+void ablate::solver::CellSolver::AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& auxFields, const std::vector<std::string>& inputFields) {
     for (const auto& auxField : auxFields) {
         auto fieldId = subDomain->GetField(auxField);
         functionDescription.auxFields.push_back(fieldId.id);
@@ -108,25 +116,71 @@ void ablate::solver::CellSolver::UpdateAuxFields(PetscReal time, Vec locXVec, Ve
         }
     }
 
-    // March over each cell volume
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        PetscFVCellGeom* cellGeom;
-        const PetscReal* fieldValues;
-        PetscReal* auxValues;
+    // the solution and aux strides used by the batched functions
+    PetscInt uStride, aStride;
+    PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &uStride) >> utilities::PetscUtilities::checkError;
+    PetscDSGetTotalDimension(subDomain->GetAuxDiscreteSystem(), &aStride) >> utilities::PetscUtilities::checkError;
+    const PetscInt numberCells = cellRange.end - cellRange.start;
+
+    // Call the functions in the order they were registered, grouping consecutive functions of the same kind so that each group only marches over the cells once
+    for (std::size_t groupStart = 0; groupStart < auxFieldUpdateFunctionDescriptions.size();) {
+        const bool batched = auxFieldUpdateFunctionDescriptions[groupStart].batchFunction != nullptr;
+        std::size_t groupEnd = groupStart + 1;
+        while (groupEnd < auxFieldUpdateFunctionDescriptions.size() && (auxFieldUpdateFunctionDescriptions[groupEnd].batchFunction != nullptr) == batched) {
+            groupEnd++;
+        }
 
-        // Get the cell location
-        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        if (!batched) {
+            // March over each cell volume
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                PetscFVCellGeom* cellGeom;
+                const PetscReal* fieldValues;
+                PetscReal* auxValues;
+
+                // Get the cell location
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+                DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
+                DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+                DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+
+                // for each function description
+                for (std::size_t uf = groupStart; uf < groupEnd; uf++) {
+                    // If an update function was passed
+                    auxFieldUpdateFunctionDescriptions[uf].function(time, dim, cellGeom, uOff[uf].data(), fieldValues, aOff[uf].data(), auxValues, auxFieldUpdateFunctionDescriptions[uf].context) >>
+                        utilities::PetscUtilities::checkError;
+                }
+            }
+        } else if (numberCells > 0) {
+            // Gather the cell values into contiguous buffers and call each batch function once over the range
+            auxBatchSolutionValues.resize(numberCells * uStride);
+            auxBatchAuxValues.resize(numberCells * aStride);
+
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+                const PetscReal* fieldValues;
+                const PetscReal* auxValues;
+                DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
+                DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+                std::copy_n(fieldValues, uStride, auxBatchSolutionValues.begin() + (c - cellRange.start) * uStride);
+                std::copy_n(auxValues, aStride, auxBatchAuxValues.begin() + (c - cellRange.start) * aStride);
+            }
 
-        DMPlexPointLocalRead(dmCell, cell, cellGeomArray, &cellGeom) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(plex, cell, locFlowFieldArray, &fieldValues) >> utilities::PetscUtilities::checkError;
-        DMPlexPointLocalRead(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+            for (std::size_t uf = groupStart; uf < groupEnd; uf++) {
+                auxFieldUpdateFunctionDescriptions[uf].batchFunction(
+                    time, dim, numberCells, uOff[uf].data(), uStride, auxBatchSolutionValues.data(), aOff[uf].data(), aStride, auxBatchAuxValues.data(), auxFieldUpdateFunctionDescriptions[uf].context) >>
+                    utilities::PetscUtilities::checkError;
+            }
 
-        // for each function description
-        for (std::size_t uf = 0; uf < auxFieldUpdateFunctionDescriptions.size(); uf++) {
-            // If an update function was passed
-            auxFieldUpdateFunctionDescriptions[uf].function(time, dim, cellGeom, uOff[uf].data(), fieldValues, aOff[uf].data(), auxValues, auxFieldUpdateFunctionDescriptions[uf].context) >>
-                utilities::PetscUtilities::checkError;
+            // scatter the updated aux values back
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+                PetscReal* auxValues;
+                DMPlexPointLocalRef(auxDM, cell, localAuxFlowFieldArray, &auxValues) >> utilities::PetscUtilities::checkError;
+                std::copy_n(auxBatchAuxValues.begin() + (c - cellRange.start) * aStride, aStride, auxValues);
+            }
         }
+        groupStart = groupEnd;
     }
 
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> utilities::PetscUtilities::checkError;
@@ -14,23 +14,37 @@ class CellSolver : public solver::Solver {
     using AuxFieldUpdateFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* u, const PetscInt aOff[],
                                                       PetscScalar* auxField, void* ctx);
 
+    //! function template for updating the aux field over a batch of cells.  The values for cell i start at u[i*uStride] and auxField[i*aStride]
+    using AuxFieldBatchUpdateFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, PetscInt numberCells, const PetscInt uOff[], PetscInt uStride, const PetscScalar* u, const PetscInt aOff[],
+                                                           PetscInt aStride, PetscScalar* auxField, void* ctx);
+
     //! function template for updating the solution field
     using SolutionFieldUpdateFunction = PetscErrorCode (*)(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], PetscScalar* u, void* ctx);
 
    private:
     /**
-     * struct to describe how to compute the aux variable update
+     * struct to describe how to compute the aux variable update.  Only one of the function or batchFunction is set
      */
     struct AuxFieldUpdateFunctionDescription {
-        AuxFieldUpdateFunction function;
+        AuxFieldUpdateFunction function = nullptr;
+        AuxFieldBatchUpdateFunction batchFunction = nullptr;
         void* context;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
     };
 
-    //! list of auxField update functions
+    //! list of auxField update functions, these are called in the order they are registered
     std::vector<AuxFieldUpdateFunctionDescription> auxFieldUpdateFunctionDescriptions;
 
+    //! reusable buffers used to gather the solution and aux values for the batched aux update functions
+    std::vector<PetscScalar> auxBatchSolutionValues;
+    std::vector<PetscScalar> auxBatchAuxValues;
+
+    /**
+     * Adds the aux update function or replaces the function registered for the same aux fields, keeping its place in the update order
+     */
+    void AddAuxFieldUpdate(AuxFieldUpdateFunctionDescription functionDescription, const std::vector<std::string>& auxFields, const std::vector<std::string>& inputFields);
+
     /**
      * struct to describe how to compute the solution variable update
      */
@@ -69,6 +83,16 @@ class CellSolver : public solver::Solver {
      */
     void RegisterAuxFieldUpdate(AuxFieldUpdateFunction function, void* context, const std::vector<std::string>& auxField, const std::vector<std::string>& inputFields);
 
+    /**
+     * Register a auxFieldUpdate that computes the entire cell range in a single call.  This replaces any per cell function registered for the same auxFields.
+     * The per cell and batched functions are called in the order they are registered.
+     * @param function
+     * @param context
+     * @param auxFields
+     * @param inputFields
+     */
+    void RegisterAuxFieldUpdate(AuxFieldBatchUpdateFunction function, void* context, const std::vector<std::string>& auxField, const std::vector<std::string>& inputFields);
+
     /**
      * Register a auxFieldUpdate
      * @param function
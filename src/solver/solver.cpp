@@ -20,6 +20,66 @@ ablate::solver::Solver::~Solver() {
 
 void ablate::solver::Solver::Register(std::shared_ptr<ablate::domain::SubDomain> subDomainIn) { subDomain = std::move(subDomainIn); }
 
+void ablate::solver::Solver::GetCachedRange(const std::string &key, const std::shared_ptr<domain::Region> &cacheRegion, const std::function<void(ablate::domain::Range &)> &computeRange,
+                                            ablate::domain::Range &range) const {
+    // determine the current dm and label state
+    DM dm = subDomain->GetDM();
+    PetscObjectId dmId;
+    PetscObjectState dmState;
+    PetscObjectGetId((PetscObject)dm, &dmId) >> utilities::PetscUtilities::checkError;
+    PetscObjectStateGet((PetscObject)dm, &dmState) >> utilities::PetscUtilities::checkError;
+
+    DMLabel label = nullptr;
+    PetscInt labelValue;
+    domain::Region::GetLabel(cacheRegion, dm, label, labelValue);
+    PetscObjectId labelId = -1;
+    PetscObjectState labelState = -1;
+    if (label) {
+        PetscObjectGetId((PetscObject)label, &labelId) >> utilities::PetscUtilities::checkError;
+        PetscObjectStateGet((PetscObject)label, &labelState) >> utilities::PetscUtilities::checkError;
+    }
+
+    // only recompute the range if something has changed
+    auto &cachedRange = rangeCache[key];
+    if (cachedRange.dmId != dmId || cachedRange.dmState != dmState || cachedRange.labelId != labelId || cachedRange.labelState != labelState) {
+        ablate::domain::Range computedRange;
+        computeRange(computedRange);
+
+        if (computedRange.points) {
+            cachedRange.points.assign(computedRange.points + computedRange.start, computedRange.points + computedRange.end);
+            cachedRange.start = 0;
+            cachedRange.end = (PetscInt)cachedRange.points.size();
+        } else {
+            cachedRange.points.clear();
+            cachedRange.start = computedRange.start;
+            cachedRange.end = computedRange.end;
+        }
+        ablate::domain::RestoreRange(computedRange);
+
+        cachedRange.dmId = dmId;
+        cachedRange.dmState = dmState;
+        cachedRange.labelId = labelId;
+        cachedRange.labelState = labelState;
+    }
+
+    range.is = nullptr;
+    range.start = cachedRange.start;
+    range.end = cachedRange.end;
+    range.points = cachedRange.points.empty() ? nullptr : cachedRange.points.data();
+}
+
+void ablate::solver::Solver::GetCellRange(ablate::domain::Range &cellRange) const {
+    GetCachedRange("cell", GetRegion(), [this](ablate::domain::Range &computedRange) { subDomain->GetCellRange(GetRegion(), computedRange); }, cellRange);
+}
+
+void ablate::solver::Solver::GetFaceRange(ablate::domain::Range &faceRange) const {
+    GetCachedRange("face", GetRegion(), [this](ablate::domain::Range &computedRange) { subDomain->GetFaceRange(GetRegion(), computedRange); }, faceRange);
+}
+
+void ablate::solver::Solver::GetRange(PetscInt depth, ablate::domain::Range &range) const {
+    GetCachedRange("depth" + std::to_string(depth), GetRegion(), [this, depth](ablate::domain::Range &computedRange) { subDomain->GetRange(GetRegion(), depth, computedRange); }, range);
+}
+
 void ablate::solver::Solver::PreStage(TS ts, PetscReal stagetime) {
     for (auto &function : preStageFunctions) {
         function(ts, *this, stagetime);
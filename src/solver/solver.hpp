@@ -4,6 +4,7 @@
 #include <domain/region.hpp>
 #include <domain/subDomain.hpp>
 #include <functional>
+#include <map>
 #include <parameters/parameters.hpp>
 #include <string>
 #include <vector>
@@ -28,6 +29,23 @@ class Solver {
     // The region of this solver.
     const std::shared_ptr<domain::Region> region;
 
+    /**
+     * A contiguous copy of a range that is reused until the dm or region label changes.  The dm and label are identified by their PetscObjectId because a
+     * destroyed object's address can be reused by a new object.
+     */
+    struct CachedRange {
+        PetscObjectId dmId = -1;
+        PetscObjectState dmState = -1;
+        PetscObjectId labelId = -1;
+        PetscObjectState labelState = -1;
+        PetscInt start = 0;
+        PetscInt end = 0;
+        std::vector<PetscInt> points;
+    };
+
+    //! the cached ranges for this solver, keyed by the range type
+    mutable std::map<std::string, CachedRange> rangeCache;
+
    protected:
     // an optional petscOptions that is used for this solver
     PetscOptions petscOptions;
@@ -38,6 +56,17 @@ class Solver {
     // The constructor to be call by any Solve implementation
     explicit Solver(std::string solverId, std::shared_ptr<domain::Region> = {}, std::shared_ptr<parameters::Parameters> options = nullptr);
 
+    /**
+     * Get a range that is only computed when the dm or the label used by cacheRegion changes.  The returned range points into the cache and is valid until the
+     * dm or label changes.  It does not need to be restored but RestoreRange is safe to call.
+     * @param key unique name of the range in this solver
+     * @param cacheRegion the region used to detect label changes
+     * @param computeRange function to compute the range when the cache is out of date
+     * @param range
+     */
+    void GetCachedRange(const std::string& key, const std::shared_ptr<domain::Region>& cacheRegion, const std::function<void(ablate::domain::Range&)>& computeRange,
+                        ablate::domain::Range& range) const;
+
     // Replacement calls for PETSC versions allowing multiple DS
     static PetscErrorCode DMPlexInsertBoundaryValues_Plex(DM dm, PetscDS ds, PetscBool insertEssential, Vec locX, PetscReal time, Vec faceGeomFVM, Vec cellGeomFVM, Vec gradFVM);
     static PetscErrorCode DMPlexInsertTimeDerivativeBoundaryValues_Plex(DM dm, PetscDS ds, PetscBool insertEssential, Vec locX, PetscReal time, Vec faceGeomFVM, Vec cellGeomFVM, Vec gradFVM);
@@ -106,23 +135,23 @@ class Solver {
     inline void RegisterPostEvaluate(const std::function<void(TS ts, Solver&)>& postEval) { this->postEvaluateFunctions.push_back(postEval); }
 
     /**
-     * Get the range of cells defined over the region for this solver.
+     * Get the range of cells defined over the region for this solver.  The range is cached until the dm or region changes.
      * @param cellRange
      */
-    void GetCellRange(ablate::domain::Range& cellRange) const { this->subDomain->GetCellRange(this->GetRegion(), cellRange); };
+    void GetCellRange(ablate::domain::Range& cellRange) const;
 
     /**
-     * Get the range of faces/edges defined over the region for this solver.
+     * Get the range of faces/edges defined over the region for this solver.  The range is cached until the dm or region changes.
      * @param faceRange
      */
-    void GetFaceRange(ablate::domain::Range& faceRange) const { this->subDomain->GetFaceRange(this->GetRegion(), faceRange); }
+    void GetFaceRange(ablate::domain::Range& faceRange) const;
 
     /**
-     * Get the range of DMPlex objects at a particular depth defined over the region for this solver.
+     * Get the range of DMPlex objects at a particular depth defined over the region for this solver.  The range is cached until the dm or region changes.
      * @param depth
      * @param range
      */
-    void GetRange(PetscInt depth, ablate::domain::Range& range) const { this->subDomain->GetRange(this->GetRegion(), depth, range); }
+    void GetRange(PetscInt depth, ablate::domain::Range& range) const;
 
     /**
      * Restores the is and range - This needs to be removed and replaced with subDomain->RestoreRange
@@ -0,0 +1,223 @@
+#ifndef ABLATELIBRARY_BATCHEDROSENBROCKINTEGRATOR_HPP
+#define ABLATELIBRARY_BATCHEDROSENBROCKINTEGRATOR_HPP
+#include <petsc.h>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include "newtonSolver.hpp"
+
+namespace ablate::utilities {
+
+/**
+ * Advances a batch of independent stiff ode systems with a fixed number of equations using a two stage L-stable Rosenbrock method (ROS2) with an embedded
+ * linearly implicit Euler error estimate.  Every entry keeps its own time and adaptive dt so the result for an entry does not depend on the other entries in
+ * the batch.  The values are stored equation major (value[e*size + i]) so that the rhs can be computed for all entries together.  The jacobian is computed
+ * with finite differences one column at a time for all entries and is only recomputed after a step is accepted.
+ */
+template <std::size_t N>
+class BatchedRosenbrockIntegrator {
+   private:
+    using DenseSolver = NewtonSolver<N>;
+
+    //! the adaptive step limits
+    const PetscReal dtMin;
+    const PetscReal dtMax;
+
+    //! the absolute and relative tolerance used to adapt each entry's dt
+    const PetscReal absoluteTolerance;
+    const PetscReal relativeTolerance;
+
+    //! the number of entries in the batch
+    PetscInt size = 0;
+    //! the current time and dt for each entry
+    std::vector<PetscReal> time;
+    std::vector<PetscReal> dt;
+    //! the current ode values
+    std::vector<PetscReal> values;
+    //! the rhs at the current values
+    std::vector<PetscReal> rhs;
+    //! scratch for the trial values, the rhs at the trial values, and the first Rosenbrock stage
+    std::vector<PetscReal> trialValues;
+    std::vector<PetscReal> trialRhs;
+    std::vector<PetscReal> stage;
+    //! the dense jacobian for each entry stored as jacobian[(r*N + c)*size + i]
+    std::vector<PetscReal> jacobian;
+    //! the entries that are still integrating and the subset of those that need an updated jacobian
+    std::vector<PetscInt> active;
+    std::vector<PetscInt> jacobianEntries;
+
+    //! the ROS2 coefficient that makes the scheme L-stable
+    inline static const PetscReal gamma = 1.0 + 1.0 / std::sqrt(2.0);
+
+   public:
+    /**
+     * @param dtMin the smallest dt, a step at this dt is always accepted if it is finite
+     * @param dtMax the largest dt
+     * @param absoluteTolerance the absolute tolerance for the error estimate
+     * @param relativeTolerance the relative tolerance for the error estimate
+     */
+    BatchedRosenbrockIntegrator(PetscReal dtMin, PetscReal dtMax, PetscReal absoluteTolerance, PetscReal relativeTolerance)
+        : dtMin(dtMin), dtMax(dtMax), absoluteTolerance(absoluteTolerance), relativeTolerance(relativeTolerance) {}
+
+    /**
+     * Resize all storage for the number of entries
+     */
+    void Resize(PetscInt sizeIn) {
+        size = sizeIn;
+        time.resize(size);
+        dt.resize(size);
+        for (auto vector : {&values, &rhs, &trialValues, &trialRhs, &stage}) {
+            vector->resize(size * N);
+        }
+        jacobian.resize(size * N * N);
+        active.reserve(size);
+        jacobianEntries.reserve(size);
+    }
+
+    //! the number of entries in the batch
+    [[nodiscard]] PetscInt GetSize() const { return size; }
+
+    //! access the value of equation e for entry i
+    PetscReal& Value(PetscInt i, PetscInt e) { return values[e * size + i]; }
+
+    //! access the current time for entry i
+    PetscReal& Time(PetscInt i) { return time[i]; }
+
+    //! access the next dt for entry i, this is kept between calls so each entry starts with its last dt
+    PetscReal& TimeStep(PetscInt i) { return dt[i]; }
+
+    /**
+     * Advance every entry in the batch to endTime
+     * @param endTime
+     * @param computeRhs computes the rhs for the listed entries, PetscErrorCode(const std::vector<PetscInt>& entries, const std::vector<PetscReal>& values,
+     * std::vector<PetscReal>& rhs) where the values and rhs are stored equation major
+     * @param failedEntries set to the entries that could not be advanced at dtMin, these keep their last accepted values
+     * @return
+     */
+    template <class RhsFunction>
+    PetscErrorCode Integrate(PetscReal endTime, RhsFunction&& computeRhs, std::vector<PetscInt>& failedEntries) {
+        PetscFunctionBeginUser;
+        // the relative perturbation used for the finite difference jacobian
+        const PetscReal perturbation = PetscSqrtReal(PETSC_MACHINE_EPSILON);
+
+        // all entries start active and need a jacobian
+        active.resize(size);
+        std::iota(active.begin(), active.end(), 0);
+        jacobianEntries = active;
+        for (PetscInt i = 0; i < size; ++i) {
+            dt[i] = PetscMin(dt[i], endTime - time[i]);
+        }
+        failedEntries.clear();
+
+        // helper function to form W = I - gamma*dt*J for a single entry
+        auto formW = [this](PetscInt i, typename DenseSolver::Matrix& W) {
+            for (std::size_t r = 0; r < N; ++r) {
+                for (std::size_t c = 0; c < N; ++c) {
+                    W[r][c] = (r == c ? 1.0 : 0.0) - gamma * dt[i] * jacobian[(r * N + c) * size + i];
+                }
+            }
+        };
+
+        while (!active.empty()) {
+            // update the rhs and finite difference jacobian for every entry that has moved, one column at a time for all entries
+            if (!jacobianEntries.empty()) {
+                PetscCall(computeRhs(jacobianEntries, values, rhs));
+                for (const auto i : jacobianEntries) {
+                    for (std::size_t e = 0; e < N; ++e) {
+                        trialValues[e * size + i] = values[e * size + i];
+                    }
+                }
+                for (std::size_t c = 0; c < N; ++c) {
+                    for (const auto i : jacobianEntries) {
+                        const PetscReal value = values[c * size + i];
+                        trialValues[c * size + i] = value + perturbation * PetscMax(PetscAbsReal(value), 1E-6);
+                    }
+                    PetscCall(computeRhs(jacobianEntries, trialValues, trialRhs));
+                    for (const auto i : jacobianEntries) {
+                        const PetscReal delta = trialValues[c * size + i] - values[c * size + i];
+                        for (std::size_t r = 0; r < N; ++r) {
+                            jacobian[(r * N + c) * size + i] = (trialRhs[r * size + i] - rhs[r * size + i]) / delta;
+                        }
+                        trialValues[c * size + i] = values[c * size + i];
+                    }
+                }
+                jacobianEntries.clear();
+            }
+
+            // first stage, solve (I - gamma*dt*J) k1 = f(y) and form the trial values y + dt*k1
+            for (const auto i : active) {
+                typename DenseSolver::Matrix W;
+                formW(i, W);
+                typename DenseSolver::Vector k1;
+                for (std::size_t e = 0; e < N; ++e) {
+                    k1[e] = rhs[e * size + i];
+                }
+                if (!DenseSolver::SolveLinear(W, k1)) {
+                    k1.fill(std::numeric_limits<PetscReal>::quiet_NaN());
+                }
+                for (std::size_t e = 0; e < N; ++e) {
+                    stage[e * size + i] = k1[e];
+                    // a failed stage is rejected below, so evaluate the rhs at the current values
+                    trialValues[e * size + i] = std::isfinite(k1[e]) ? values[e * size + i] + dt[i] * k1[e] : values[e * size + i];
+                }
+            }
+            PetscCall(computeRhs(active, trialValues, trialRhs));
+
+            // second stage, solve (I - gamma*dt*J) k2 = f(y + dt*k1) - 2*k1 then update each entry with its own error estimate
+            std::size_t numberActive = 0;
+            for (const auto i : active) {
+                typename DenseSolver::Matrix W;
+                formW(i, W);
+                typename DenseSolver::Vector k2;
+                for (std::size_t e = 0; e < N; ++e) {
+                    k2[e] = trialRhs[e * size + i] - 2.0 * stage[e * size + i];
+                }
+                if (!DenseSolver::SolveLinear(W, k2)) {
+                    k2.fill(std::numeric_limits<PetscReal>::quiet_NaN());
+                }
+
+                // the difference between the second order solution and the embedded linearly implicit euler solution
+                const PetscReal stepDt = dt[i];
+                typename DenseSolver::Vector updated;
+                PetscReal error = 0.0;
+                for (std::size_t e = 0; e < N; ++e) {
+                    const PetscReal k1 = stage[e * size + i];
+                    const PetscReal value = values[e * size + i];
+                    updated[e] = value + stepDt * (1.5 * k1 + 0.5 * k2[e]);
+                    const PetscReal scale = absoluteTolerance + relativeTolerance * PetscMax(PetscAbsReal(value), PetscAbsReal(updated[e]));
+                    error += PetscSqr(0.5 * stepDt * (k1 + k2[e]) / scale);
+                }
+                error = PetscSqrtReal(error / N);
+                const bool finite = std::isfinite(error);
+                const bool lastStep = stepDt >= endTime - time[i];
+
+                if (finite && (error <= 1.0 || stepDt <= dtMin)) {
+                    // accept the step
+                    for (std::size_t e = 0; e < N; ++e) {
+                        values[e * size + i] = updated[e];
+                    }
+                    time[i] = lastStep ? endTime : time[i] + stepDt;
+                    if (lastStep) {
+                        continue;
+                    }
+                    jacobianEntries.push_back(i);
+                } else if (!finite && stepDt <= dtMin) {
+                    // this entry cannot be advanced, so it keeps the last accepted values
+                    failedEntries.push_back(i);
+                    continue;
+                }
+
+                // adapt the dt for this entry
+                const PetscReal factor = finite ? PetscMin(PetscMax(0.9 / PetscSqrtReal(PetscMax(error, 1E-10)), 0.2), 5.0) : 0.25;
+                dt[i] = PetscMin(PetscMin(PetscMax(stepDt * factor, dtMin), dtMax), endTime - time[i]);
+                active[numberActive++] = i;
+            }
+            active.resize(numberActive);
+        }
+        PetscFunctionReturn(0);
+    }
+};
+
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_BATCHEDROSENBROCKINTEGRATOR_HPP
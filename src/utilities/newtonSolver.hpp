@@ -0,0 +1,193 @@
+#ifndef ABLATELIBRARY_NEWTONSOLVER_HPP
+#define ABLATELIBRARY_NEWTONSOLVER_HPP
+#include <petsc.h>
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace ablate::utilities {
+
+/**
+ * A small dense Newton solver for nonlinear systems with a fixed number of unknowns.  All storage is on the stack so it can be used for every cell/face
+ * without creating any petsc objects.  Each Newton step is globalized with a backtracking line search on 0.5*||F||^2 using the same sufficient decrease test
+ * as the petsc SNES bt line search, and the convergence tests follow the petsc SNES defaults (absolute residual, relative residual, and step tolerance).
+ */
+template <std::size_t N>
+class NewtonSolver {
+   public:
+    using Vector = std::array<PetscReal, N>;
+    using Matrix = std::array<Vector, N>;
+
+    /**
+     * The outcome of a solve
+     */
+    struct Result {
+        //! true if one of the convergence tests was met
+        bool converged = false;
+        //! the number of Newton iterations taken
+        PetscInt iterations = 0;
+        //! the two norm of the final residual
+        PetscReal residualNorm = 0.0;
+    };
+
+    /**
+     * The default admissible test, every state is allowed
+     */
+    struct AnyState {
+        bool operator()(const Vector&) const { return true; }
+    };
+
+    //! the sufficient decrease parameter for the line search (petsc -snes_linesearch_alpha)
+    static constexpr PetscReal lineSearchAlpha = 1E-4;
+
+    //! the line search fails if the step must be reduced below this fraction (petsc -snes_linesearch_minlambda)
+    static constexpr PetscReal minimumLambda = 1E-12;
+
+    /**
+     * Solve F(x) = 0 using an analytic jacobian
+     * @param function computes the residual and jacobian, void(const Vector& x, Vector& F, Matrix& J)
+     * @param x the initial guess, replaced with the solution
+     * @param absoluteTolerance converged if ||F|| is less than this value
+     * @param relativeTolerance converged if ||F|| is less than this value times the initial ||F||
+     * @param stepTolerance converged if the Newton update ||dx|| is less than this value times ||x||
+     * @param maximumIterations
+     * @param admissible bool(const Vector& x), steps are shortened until the state is admissible (e.g. physical)
+     * @return the result of the solve, x holds the last accepted iterate if the solve did not converge
+     */
+    template <class Function, class Admissible = AnyState>
+    static Result Solve(Function&& function, Vector& x, PetscReal absoluteTolerance = 1E-8, PetscReal relativeTolerance = 1E-12, PetscReal stepTolerance = 1E-8,
+                        PetscInt maximumIterations = 100, const Admissible& admissible = Admissible()) {
+        Vector residual;
+        Matrix jacobian;
+        function(x, residual, jacobian);
+
+        Result result;
+        result.residualNorm = Norm(residual);
+        const PetscReal initialResidualNorm = result.residualNorm;
+
+        while (std::isfinite(result.residualNorm)) {
+            if (result.residualNorm <= absoluteTolerance || result.residualNorm <= relativeTolerance * initialResidualNorm) {
+                result.converged = true;
+                break;
+            }
+            if (result.iterations >= maximumIterations) {
+                break;
+            }
+
+            // solve J*dx = F for the Newton direction
+            Vector direction = residual;
+            if (!SolveLinear(jacobian, direction)) {
+                break;
+            }
+
+            // backtrack along the direction until the merit function 0.5*||F||^2 is sufficiently decreased
+            const PetscReal merit = 0.5 * result.residualNorm * result.residualNorm;
+            PetscReal lambda = 1.0;
+            Vector trialX;
+            Vector trialResidual;
+            PetscReal trialNorm = 0.0;
+            bool accepted = false;
+            while (lambda >= minimumLambda) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    trialX[i] = x[i] - lambda * direction[i];
+                }
+                if (!admissible(trialX)) {
+                    lambda *= 0.5;
+                    continue;
+                }
+                function(trialX, trialResidual, jacobian);
+                trialNorm = Norm(trialResidual);
+                if (!std::isfinite(trialNorm)) {
+                    lambda *= 0.5;
+                    continue;
+                }
+                const PetscReal trialMerit = 0.5 * trialNorm * trialNorm;
+                if (trialMerit <= (1.0 - 2.0 * lineSearchAlpha * lambda) * merit) {
+                    accepted = true;
+                    break;
+                }
+
+                // minimize the quadratic model through merit, its slope (-2*merit), and the trial merit, limited to [0.1, 0.5]*lambda
+                const PetscReal quadraticLambda = merit * lambda * lambda / (trialMerit - merit + 2.0 * merit * lambda);
+                lambda = PetscMin(0.5 * lambda, PetscMax(0.1 * lambda, quadraticLambda));
+            }
+            if (!accepted) {
+                break;
+            }
+
+            // take the step, the jacobian was computed at the accepted state
+            PetscReal stepNorm = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                stepNorm += PetscSqr(trialX[i] - x[i]);
+            }
+            x = trialX;
+            residual = trialResidual;
+            result.residualNorm = trialNorm;
+            result.iterations++;
+
+            if (PetscSqrtReal(stepNorm) <= stepTolerance * Norm(x)) {
+                result.converged = true;
+                break;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Solve A*x = b using gaussian elimination with partial pivoting
+     * @param A the matrix, overwritten by the elimination
+     * @param b the right hand side, replaced with the solution
+     * @return false if the matrix is singular
+     */
+    static bool SolveLinear(Matrix& A, Vector& b) {
+        for (std::size_t k = 0; k < N; ++k) {
+            // find the largest pivot in this column
+            std::size_t pivot = k;
+            for (std::size_t i = k + 1; i < N; ++i) {
+                if (PetscAbsReal(A[i][k]) > PetscAbsReal(A[pivot][k])) {
+                    pivot = i;
+                }
+            }
+            if (A[pivot][k] == 0.0 || !std::isfinite(A[pivot][k])) {
+                return false;
+            }
+            if (pivot != k) {
+                std::swap(A[pivot], A[k]);
+                std::swap(b[pivot], b[k]);
+            }
+
+            // eliminate below the pivot
+            for (std::size_t i = k + 1; i < N; ++i) {
+                const PetscReal factor = A[i][k] / A[k][k];
+                for (std::size_t j = k + 1; j < N; ++j) {
+                    A[i][j] -= factor * A[k][j];
+                }
+                b[i] -= factor * b[k];
+            }
+        }
+
+        // back substitution
+        for (std::size_t i = N; i-- > 0;) {
+            PetscReal sum = b[i];
+            for (std::size_t j = i + 1; j < N; ++j) {
+                sum -= A[i][j] * b[j];
+            }
+            b[i] = sum / A[i][i];
+        }
+        return true;
+    }
+
+    /**
+     * Compute the two norm of the vector
+     */
+    static PetscReal Norm(const Vector& v) {
+        PetscReal norm = 0.0;
+        for (const auto& value : v) {
+            norm += value * value;
+        }
+        return PetscSqrtReal(norm);
+    }
+};
+
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_NEWTONSOLVER_HPP
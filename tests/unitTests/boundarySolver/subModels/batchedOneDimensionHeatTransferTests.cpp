@@ -0,0 +1,228 @@
+#include <petscviewerhdf5.h>
+#include <filesystem>
+#include <functional>
+#include "PetscTestFixture.hpp"
+#include "boundarySolver/physics/subModels/batchedOneDimensionHeatTransfer.hpp"
+#include "convergenceTester.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+
+struct BatchedHeatTransferTestParameters {
+    // Creation options
+    const std::shared_ptr<ablate::parameters::MapParameters> properties;
+    const std::shared_ptr<ablate::parameters::MapParameters> options;
+    std::optional<double> maximumSurfaceTemperature;
+
+    // exact solution also used for init
+    std::function<std::shared_ptr<ablate::mathFunctions::MathFunction>()> exactSolutionFactory;
+
+    // ts options
+    PetscReal timeEnd;
+
+    // comparisons
+    PetscReal expectedConvergenceRate;
+};
+
+class BatchedOneDimensionHeatTransferTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<BatchedHeatTransferTestParameters> {};
+
+TEST_P(BatchedOneDimensionHeatTransferTestFixture, ShouldConverge) {
+    // get the required variables
+    const auto& params = GetParam();
+
+    // Set the initial number of faces
+    PetscInt initialNx = 20;
+    const PetscInt numberFaces = 3;
+
+    testingResources::ConvergenceTester l2History("l2");
+
+    // Get the exact solution
+    auto exactSolution = params.exactSolutionFactory();
+
+    // March over each level
+    for (PetscInt l = 0; l < 3; l++) {
+        PetscInt nx1D = initialNx * PetscPowInt(2, l);
+        PetscPrintf(PETSC_COMM_WORLD, "Running Calculation at Level %" PetscInt_FMT " (%" PetscInt_FMT ")\n", l, nx1D);
+
+        // Set the nx in the solver options
+        params.options->Insert("dm_plex_box_faces", nx1D);
+
+        // Create the batch of 1D solvers
+        ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer solidHeatTransfer(
+            numberFaces, params.properties, exactSolution, params.options, params.maximumSurfaceTemperature.value_or(PETSC_DEFAULT));
+
+        // Advance each face, pass in a surface heat flux and update the internal properties
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            PetscReal surfaceTemperature;
+            PetscReal heatFlux;
+            solidHeatTransfer.Solve(f, 0.0, params.timeEnd, surfaceTemperature, heatFlux);
+        }
+
+        // Compute the l2 error for each face using the nodal values
+        auto domainLength = params.options->GetExpect<double>("dm_plex_box_upper");
+        const PetscReal h = domainLength / nx1D;
+        std::vector<PetscReal> fErrors(numberFaces, 0.0);
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            const auto temperature = solidHeatTransfer.GetTemperature(f);
+            for (PetscInt n = 0; n < solidHeatTransfer.GetNumberNodes(); ++n) {
+                PetscReal x = solidHeatTransfer.GetNodeLocation(n);
+                PetscReal weight = (n == 0 || n == nx1D) ? 0.5 * h : h;
+                fErrors[f] += weight * PetscSqr(temperature[n] - exactSolution->Eval(&x, 1, solidHeatTransfer.GetTime(f)));
+            }
+            fErrors[f] = PetscSqrtReal(fErrors[f]);
+        }
+
+        // record the error
+        l2History.Record(h, fErrors);
+    }
+    // ASSERT
+    std::string l2Message;
+    if (!l2History.CompareConvergenceRate(std::vector<PetscReal>(numberFaces, GetParam().expectedConvergenceRate), l2Message, false)) {
+        FAIL() << l2Message;
+    }
+}
+
+// helper function to create a result function
+static std::shared_ptr<ablate::mathFunctions::MathFunction> CreateHeatEquationDirichletExactSolution(PetscReal length, PetscReal specificHeat, PetscReal conductivity, PetscReal density,
+                                                                                                     PetscReal temperatureInit, PetscReal temperatureBoundary, PetscReal timeOffset = 0.0) {
+    auto function = [conductivity, density, specificHeat, temperatureInit, temperatureBoundary, length, timeOffset](int dim, double time, const double x[], int nf, double* u, void* ctx) {
+        // compute the alpha in the equation
+        time += timeOffset;
+        PetscReal alpha = conductivity / (density * specificHeat);
+        PetscReal effectiveTemperatureInit = (temperatureInit - temperatureBoundary);
+        PetscReal T = 0.0;
+        for (PetscInt n = 1; n < 2000; ++n) {
+            PetscReal Bn = -effectiveTemperatureInit * 2.0 * (-1.0 + PetscPowReal(-1.0, n)) / (n * PETSC_PI);
+            T += Bn * PetscSinReal(n * PETSC_PI * x[0] / length) * PetscExpReal(-n * n * PETSC_PI * PETSC_PI * alpha * time / (PetscSqr(length)));
+        }
+
+        u[0] = PetscMax(temperatureBoundary, T + temperatureBoundary);
+        return PETSC_SUCCESS;
+    };
+
+    return ablate::mathFunctions::Create(function);
+}
+
+INSTANTIATE_TEST_SUITE_P(SolidHeatTransfer, BatchedOneDimensionHeatTransferTestFixture,
+                         testing::Values(
+                             // no boundary temperature
+                             (BatchedHeatTransferTestParameters){.properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}}),
+                                                                  .options = ablate::parameters::MapParameters::Create({{"ts_dt", "1E-4"}, {"dm_plex_box_upper", .1}}),
+                                                                  .maximumSurfaceTemperature = 0.0,
+                                                                  .exactSolutionFactory = []() { return CreateHeatEquationDirichletExactSolution(.1, 1000.0, 1.0, 1.0, 1000.0, 000.0, 1E-5); },
+                                                                  .timeEnd = .01,
+                                                                  .expectedConvergenceRate = 2.0},
+                             // fixed boundary temperature
+                             (BatchedHeatTransferTestParameters){.properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", .25}, {"density", 0.7}}),
+                                                                  .options = ablate::parameters::MapParameters::Create({{"ts_dt", "0.001"}, {"dm_plex_box_upper", .25}}),
+                                                                  .maximumSurfaceTemperature = 400.0,
+                                                                  .exactSolutionFactory = []() { return CreateHeatEquationDirichletExactSolution(.25, 1000.0, 0.25, 0.7, 1500.0, 400.0, .01); },
+                                                                  .timeEnd = .5,
+                                                                  .expectedConvergenceRate = 2.0}
+
+                             ),
+                         [](const testing::TestParamInfo<BatchedHeatTransferTestParameters>& info) { return std::to_string(info.index); });
+
+TEST(BatchedOneDimensionHeatTransferTests, ShouldAdvanceEachFaceIndependently) {
+    // arrange
+    auto properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}});
+    auto options = ablate::parameters::MapParameters::Create({{"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 15}});
+    auto initialization = ablate::mathFunctions::Create(300.0);
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer batch(2, properties, initialization, options, 600.0);
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer single(1, properties, initialization, options, 600.0);
+
+    // act
+    PetscReal heatedTemperature, heatedFlux, batchTemperature, batchFlux, singleTemperature, singleFlux;
+    for (PetscInt s = 0; s < 10; ++s) {
+        batch.Solve(0, 1.0E5, 1.0E-3, heatedTemperature, heatedFlux);
+        batch.Solve(1, 1.0E3, 1.0E-3, batchTemperature, batchFlux);
+        single.Solve(0, 1.0E3, 1.0E-3, singleTemperature, singleFlux);
+    }
+
+    // assert
+    ASSERT_GT(heatedTemperature, batchTemperature);
+    ASSERT_DOUBLE_EQ(batchTemperature, singleTemperature);
+    ASSERT_DOUBLE_EQ(batchFlux, singleFlux);
+    for (PetscInt n = 0; n < batch.GetNumberNodes(); ++n) {
+        ASSERT_DOUBLE_EQ(batch.GetTemperature(1)[n], single.GetTemperature(0)[n]);
+    }
+}
+
+TEST(BatchedOneDimensionHeatTransferTests, ShouldRejectUnsupportedOptions) {
+    // arrange
+    auto properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}});
+    auto options = ablate::parameters::MapParameters::Create({{"dm_plex_box_upper", .1}, {"dm_plex_box_lower", -.1}});
+    auto initialization = ablate::mathFunctions::Create(300.0);
+
+    // act
+    // assert
+    ASSERT_THROW(ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer(2, properties, initialization, options), std::invalid_argument);
+}
+
+class BatchedOneDimensionHeatTransferSerializationTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(BatchedOneDimensionHeatTransferSerializationTestFixture, ShouldRestoreSavedProfiles) {
+    // arrange
+    auto properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}});
+    auto options = ablate::parameters::MapParameters::Create({{"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 15}});
+    // the far field temperature changes in time so the face time must also be restored
+    auto initialization = ablate::mathFunctions::Create("300 + 1000*t");
+    const std::vector<PetscInt> faceIds = {12, 4};
+    auto filePath = std::filesystem::temp_directory_path() / "batchedOneDimensionHeatTransferRestore.h5";
+
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer saved(2, properties, initialization, options, 600.0);
+    PetscReal surfaceTemperature, heatFlux;
+    saved.Solve(0, 1.0E5, 1.0E-2, surfaceTemperature, heatFlux);
+    saved.Solve(1, 1.0E3, 1.0E-2, surfaceTemperature, heatFlux);
+
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.c_str(), FILE_MODE_WRITE, &viewer) >> errorChecker;
+    saved.Save(viewer, "solidTemperature-0", faceIds) >> errorChecker;
+    PetscViewerDestroy(&viewer) >> errorChecker;
+
+    // act
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer restored(2, properties, initialization, options, 600.0);
+    PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.c_str(), FILE_MODE_READ, &viewer) >> errorChecker;
+    restored.Restore(viewer, "solidTemperature-0", faceIds) >> errorChecker;
+    PetscViewerDestroy(&viewer) >> errorChecker;
+
+    // assert
+    for (PetscInt f = 0; f < 2; ++f) {
+        ASSERT_DOUBLE_EQ(saved.GetTime(f), restored.GetTime(f)) << "The restored time should match for face " << f;
+        for (PetscInt n = 0; n < saved.GetNumberNodes(); ++n) {
+            ASSERT_DOUBLE_EQ(saved.GetTemperature(f)[n], restored.GetTemperature(f)[n]) << "The restored profile should match for face " << f << " node " << n;
+        }
+    }
+
+    // continuing from the restored state should give the same far field and profile
+    saved.Solve(0, 1.0E5, 1.0E-2, surfaceTemperature, heatFlux);
+    restored.Solve(0, 1.0E5, 1.0E-2, surfaceTemperature, heatFlux);
+    for (PetscInt n = 0; n < saved.GetNumberNodes(); ++n) {
+        ASSERT_DOUBLE_EQ(saved.GetTemperature(0)[n], restored.GetTemperature(0)[n]) << "The continued profile should match for node " << n;
+    }
+}
+
+TEST_F(BatchedOneDimensionHeatTransferSerializationTestFixture, ShouldNotRestoreProfilesForDifferentFaces) {
+    // arrange
+    auto properties = ablate::parameters::MapParameters::Create({{"specificHeat", 1000.0}, {"conductivity", 1.0}, {"density", 1.0}});
+    auto options = ablate::parameters::MapParameters::Create({{"dm_plex_box_upper", .1}, {"dm_plex_box_faces", 15}});
+    auto initialization = ablate::mathFunctions::Create(300.0);
+    auto filePath = std::filesystem::temp_directory_path() / "batchedOneDimensionHeatTransferMismatch.h5";
+
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer saved(2, properties, initialization, options, 600.0);
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.c_str(), FILE_MODE_WRITE, &viewer) >> errorChecker;
+    saved.Save(viewer, "solidTemperature-0", {12, 4}) >> errorChecker;
+    PetscViewerDestroy(&viewer) >> errorChecker;
+
+    // act
+    ablate::boundarySolver::physics::subModels::BatchedOneDimensionHeatTransfer restored(2, properties, initialization, options, 600.0);
+    PetscViewerHDF5Open(PETSC_COMM_SELF, filePath.c_str(), FILE_MODE_READ, &viewer) >> errorChecker;
+    PetscPushErrorHandler(PetscReturnErrorHandler, nullptr) >> errorChecker;
+    auto restoreError = restored.Restore(viewer, "solidTemperature-0", {4, 12});
+    PetscPopErrorHandler() >> errorChecker;
+    PetscViewerDestroy(&viewer) >> errorChecker;
+
+    // assert
+    ASSERT_EQ(PETSC_ERR_FILE_UNEXPECTED, restoreError) << "The profiles should not be restored when the saved faces differ";
+}
@@ -409,6 +409,77 @@ TEST_P(RBFTestFixture_Derivative, CheckDerivativeFunctions) {
     EndWithMPI
 }
 
+// Setting up every stencil at once assembles and factors the systems in batches. The weights must meet the same error bounds as the lazily computed ones.
+TEST_P(RBFTestFixture_Derivative, CheckBatchedDerivativeFunctions) {
+    if (GetParam().cell > -1) {
+        GTEST_SKIP() << "Setting up every stencil of the 3D meshes takes too long";
+    }
+
+    StartWithMPI
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+
+        //             Make the field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM)};
+
+        //             Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+
+        // The field containing the data
+        const ablate::domain::Field *field = &(subDomain->GetField("fieldA"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {
+            rbfList[j]->Setup(subDomain);
+            rbfList[j]->Initialize(cellRange);
+            rbfList[j]->SetupDerivativeStencils();
+        }
+
+        RBFTestFixture_SetData(cellRange, field, subDomain);
+
+        // Now check derivatives
+        std::vector<PetscInt> dx = testingParam.dx, dy = testingParam.dy, dz = testingParam.dz;
+        PetscInt cell;
+        PetscReal x[3];
+        PetscReal err, val;
+        DM dm = subDomain->GetDM();
+
+        for (std::size_t i = 0; i < dx.size(); ++i) {  // Iterate over each of the requested derivatives
+            for (std::size_t j = 0; j < rbfList.size(); ++j) {
+                err = -1.0;
+                for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {  // Iterate over the entire subDomain
+                    cell = cellRange.points ? cellRange.points[c] : c;
+                    val = rbfList[j]->EvalDer(field, c, dx[i], dy[i], dz[i]);
+
+                    DMPlexComputeCellGeometryFVM(dm, cell, NULL, x, NULL) >> ablate::utilities::PetscUtilities::checkError;
+                    err = PetscMax(err, PetscAbsReal(val - RBFTestFixture_Function(x, dx[i], dy[i], dz[i])));
+                }
+
+                EXPECT_LT(err, testingParam.maxError[i]) << "RBF: " << rbfList[j]->type() << ", dx: " << dx[i] << ", dy:" << dy[i] << ", dz: " << dz[i] << " Error: " << err;
+            }
+        }
+
+        subDomain->RestoreRange(cellRange);
+
+    EndWithMPI
+}
+
 // This tests both the absolute error and the convergence for two data points
 INSTANTIATE_TEST_SUITE_P(
     MeshTests, RBFTestFixture_Derivative,
@@ -970,3 +1041,100 @@ INSTANTIATE_TEST_SUITE_P(
                                                 .x = {{0.52, 0.52, 0.52}},
                                                 .maxError = {1.35e-5}}),
     [](const testing::TestParamInfo<RBFParameters_DerivativeInterpolation> &info) { return info.param.mpiTestParameter.getTestName(); });
+
+class RBFTestFixture_InterpolationWithoutFactors : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<RBFParameters_DerivativeInterpolation> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+// An RBF that only stores derivative weights must still be able to interpolate after the derivative stencils are setup.
+TEST_P(RBFTestFixture_InterpolationWithoutFactors, CheckInterpolationFunctions) {
+    StartWithMPI
+
+        // initialize petsc and mpi
+        environment::RunEnvironment::Initialize(argc, argv);
+        utilities::PetscUtilities::Initialize();
+        auto testingParam = GetParam();
+        std::vector<std::shared_ptr<domain::rbf::RBF>> rbfList = testingParam.rbfList;
+        std::vector<std::vector<PetscReal>> x = testingParam.x;
+
+        //             Make the field
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptor = {
+            std::make_shared<ablate::domain::FieldDescription>("fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::AUX, ablate::domain::FieldType::FVM)};
+
+        //             Create the mesh
+        auto mesh = std::make_shared<domain::BoxMesh>("mesh",
+                                                      fieldDescriptor,
+                                                      std::vector<std::shared_ptr<domain::modifiers::Modifier>>{std::make_shared<domain::modifiers::DistributeWithGhostCells>(3)},
+                                                      testingParam.meshFaces,
+                                                      testingParam.meshStart,
+                                                      testingParam.meshEnd,
+                                                      std::vector<std::string>{},
+                                                      testingParam.meshSimplex);
+
+        mesh->InitializeSubDomains();
+
+        std::shared_ptr<ablate::domain::SubDomain> subDomain = mesh->GetSubDomain(domain::Region::ENTIREDOMAIN);
+
+        // The field containing the data
+        const ablate::domain::Field *field = &(subDomain->GetField("fieldA"));
+
+        ablate::domain::Range cellRange;
+        subDomain->GetCellRange(nullptr, cellRange);
+        for (std::size_t j = 0; j < rbfList.size(); ++j) {
+            rbfList[j]->Setup(subDomain);
+            rbfList[j]->Initialize(cellRange);
+            rbfList[j]->SetupDerivativeStencils();
+        }
+
+        RBFTestFixture_SetData(cellRange, field, subDomain);
+
+        for (std::size_t i = 0; i < x.size(); ++i) {  // Iterate over each of the requested locations
+            PetscReal maxError = testingParam.maxError[i];
+
+            for (std::size_t j = 0; j < rbfList.size(); ++j) {  // Check each RBF
+                PetscReal truth = RBFTestFixture_Function(x[i].data(), 0, 0, 0);
+                PetscReal val = rbfList[j]->Interpolate(field, x[i].data());
+                PetscReal err = PetscAbsReal(val - truth);
+                EXPECT_LT(err, maxError) << "RBF: " << rbfList[j]->type() << " Error: " << err;
+            }
+        }
+
+        subDomain->RestoreRange(cellRange);
+
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    MeshTests, RBFTestFixture_InterpolationWithoutFactors,
+    testing::Values((RBFParameters_DerivativeInterpolation){.mpiTestParameter = testingResources::MpiTestParameter("InterpDerivativeOnly_1DN11"),
+                                                            .meshFaces = {11},
+                                                            .meshStart = {-1.0},
+                                                            .meshEnd = {1.0},
+                                                            .meshSimplex = false,
+                                                            .rbfList = {std::make_shared<ablate::domain::rbf::GA>(4, 1.818181818181817e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::MQ>(4, 1.818181818181817e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::IMQ>(4, 1.818181818181817e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::PHS>(4, 2, false, true)},
+                                                            .dx = {},
+                                                            .dy = {},
+                                                            .dz = {},
+                                                            .cell = -1,
+                                                            .x = {{0.52, 0.0, 0.0}},
+                                                            .maxError = {2.9e-3}},
+                    (RBFParameters_DerivativeInterpolation){.mpiTestParameter = testingResources::MpiTestParameter("InterpDerivativeOnly_2DQuadN11"),
+                                                            .meshFaces = {11, 11},
+                                                            .meshStart = {-1.0, -1.0},
+                                                            .meshEnd = {1.0, 1.0},
+                                                            .meshSimplex = false,
+                                                            .rbfList = {std::make_shared<ablate::domain::rbf::GA>(4, 1.818181818181814e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::MQ>(4, 1.818181818181814e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::IMQ>(4, 1.818181818181814e-01, false, true),
+                                                                        std::make_shared<ablate::domain::rbf::PHS>(4, 2, false, true)},
+                                                            .dx = {},
+                                                            .dy = {},
+                                                            .dz = {},
+                                                            .cell = -1,
+                                                            .x = {{0.52, 0.52, 0.0}},
+                                                            .maxError = {8.0e-4}}),
+    [](const testing::TestParamInfo<RBFParameters_DerivativeInterpolation> &info) { return info.param.mpiTestParameter.getTestName(); });
@@ -0,0 +1,129 @@
+#include <petsc.h>
+#include <memory>
+#include <set>
+#include "MpiTestFixture.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablateTesting::domain::modifier {
+
+/**
+ * The number of locally owned cells and their total weight
+ */
+struct OwnedCellWeight {
+    PetscInt numberCells = 0;
+    PetscReal weight = 0.0;
+};
+
+class DistributeWithGhostCellsTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+
+   protected:
+    /**
+     * Create an undistributed 8x8 quad mesh using a partitioner that supports vertex weights
+     */
+    DM CreateMesh() {
+        DM dm;
+        PetscInt faces[2] = {8, 8};
+        DMPlexCreateBoxMesh(PETSC_COMM_WORLD, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> testErrorChecker;
+        PetscPartitioner partitioner;
+        DMPlexGetPartitioner(dm, &partitioner) >> testErrorChecker;
+#if defined(PETSC_HAVE_PARMETIS)
+        PetscPartitionerSetType(partitioner, PETSCPARTITIONERPARMETIS) >> testErrorChecker;
+#elif defined(PETSC_HAVE_PTSCOTCH)
+        PetscPartitionerSetType(partitioner, PETSCPARTITIONERPTSCOTCH) >> testErrorChecker;
+#endif
+        return dm;
+    }
+
+    /**
+     * Sum the cells owned by this rank and their weight (rounded the same way as the partitioner)
+     */
+    OwnedCellWeight ComputeOwnedCellWeight(DM dm, const std::shared_ptr<ablate::mathFunctions::MathFunction>& cellWeight) {
+        PetscSF pointSF;
+        const PetscInt* leaves;
+        PetscInt numberLeaves;
+        DMGetPointSF(dm, &pointSF) >> testErrorChecker;
+        PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> testErrorChecker;
+        std::set<PetscInt> remotePoints;
+        for (PetscInt l = 0; l < numberLeaves; ++l) {
+            remotePoints.insert(leaves ? leaves[l] : l);
+        }
+
+        OwnedCellWeight owned;
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> testErrorChecker;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            if (remotePoints.count(c)) {
+                continue;
+            }
+            PetscReal centroid[3] = {0.0, 0.0, 0.0};
+            DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> testErrorChecker;
+            owned.numberCells++;
+            owned.weight += (PetscReal)PetscMax(1, (PetscInt)PetscRoundReal(cellWeight->Eval(centroid, 2, 0.0)));
+        }
+        return owned;
+    }
+};
+
+TEST_P(DistributeWithGhostCellsTestFixture, ShouldBalanceTheCellWeightAcrossRanks) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+#if !defined(PETSC_HAVE_PARMETIS) && !defined(PETSC_HAVE_PTSCOTCH)
+            GTEST_SKIP() << "Weighted partitioning requires parmetis or ptscotch";
+#endif
+            // arrange
+            // the cost increases toward the upper right corner, so an equal number of cells per rank is not balanced
+            auto cellWeight = ablate::mathFunctions::Create("1 + 20*x*y");
+            PetscMPIInt size;
+            MPI_Comm_size(PETSC_COMM_WORLD, &size) >> testErrorChecker;
+
+            DM unweightedDm = CreateMesh();
+            DM weightedDm = CreateMesh();
+
+            // act
+            ablate::domain::modifiers::DistributeWithGhostCells().Modify(unweightedDm);
+            ablate::domain::modifiers::DistributeWithGhostCells(1, cellWeight).Modify(weightedDm);
+
+            // assert
+            auto unweighted = ComputeOwnedCellWeight(unweightedDm, cellWeight);
+            auto weighted = ComputeOwnedCellWeight(weightedDm, cellWeight);
+
+            PetscInt totalCells;
+            PetscReal totalWeight, maxUnweightedWeight, maxWeightedWeight;
+            PetscInt minWeightedCells, maxWeightedCells;
+            MPI_Allreduce(&weighted.numberCells, &totalCells, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&weighted.weight, &totalWeight, 1, MPIU_REAL, MPI_SUM, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&unweighted.weight, &maxUnweightedWeight, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&weighted.weight, &maxWeightedWeight, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&weighted.numberCells, &minWeightedCells, 1, MPIU_INT, MPI_MIN, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&weighted.numberCells, &maxWeightedCells, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD) >> testErrorChecker;
+
+            // every cell is owned by exactly one rank
+            ASSERT_EQ(64, totalCells);
+
+            // the weighted partition balances the total weight instead of the number of cells
+            const PetscReal averageWeight = totalWeight / size;
+            ASSERT_LE(maxWeightedWeight, 1.1 * averageWeight) << "The weighted partition should balance the cell weight";
+            ASSERT_LT(maxWeightedWeight, maxUnweightedWeight) << "The weighted partition should be better balanced than the unweighted partition";
+            ASSERT_LT(minWeightedCells, maxWeightedCells) << "The weighted partition should assign a different number of cells to each rank";
+
+            DMDestroy(&unweightedDm) >> testErrorChecker;
+            DMDestroy(&weightedDm) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(DistributeWithGhostCellsTests, DistributeWithGhostCellsTestFixture, testing::Values(testingResources::MpiTestParameter("weighted partition 2 proc", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
+
+}  // namespace ablateTesting::domain::modifier
@@ -0,0 +1,275 @@
+#include <petsc.h>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "MpiTestFixture.hpp"
+#include "PetscTestFixture.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/reorderMesh.hpp"
+#include "environment/runEnvironment.hpp"
+#include "gtest/gtest.h"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablateTesting::domain::modifier {
+
+class ReorderMeshTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<ablate::domain::modifiers::ReorderMesh::Ordering> {
+   protected:
+    /**
+     * Compute the average difference in cell number between neighboring cells
+     */
+    PetscReal ComputeAverageNeighborDistance(DM dm) {
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+        PetscReal distance = 0.0;
+        PetscInt count = 0;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PetscInt coneSize;
+            const PetscInt* cone;
+            DMPlexGetConeSize(dm, c, &coneSize) >> errorChecker;
+            DMPlexGetCone(dm, c, &cone) >> errorChecker;
+            for (PetscInt f = 0; f < coneSize; ++f) {
+                PetscInt supportSize;
+                const PetscInt* support;
+                DMPlexGetSupportSize(dm, cone[f], &supportSize) >> errorChecker;
+                DMPlexGetSupport(dm, cone[f], &support) >> errorChecker;
+                for (PetscInt s = 0; s < supportSize; ++s) {
+                    if (support[s] != c) {
+                        distance += PetscAbsInt(support[s] - c);
+                        count++;
+                    }
+                }
+            }
+        }
+        return distance / count;
+    }
+};
+
+TEST_P(ReorderMeshTestFixture, ShouldImproveLocalityOfShuffledMesh) {
+    // arrange
+    DM dm;
+    PetscInt faces[2] = {12, 12};
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+
+    // randomly number the points in each stratum
+    PetscInt pStart, pEnd, depth;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> errorChecker;
+    DMPlexGetDepth(dm, &depth) >> errorChecker;
+    std::vector<PetscInt> shuffle(pEnd - pStart);
+    std::mt19937 generator(2024);
+    for (PetscInt d = 0; d <= depth; ++d) {
+        PetscInt sStart, sEnd;
+        DMPlexGetDepthStratum(dm, d, &sStart, &sEnd) >> errorChecker;
+        std::vector<PetscInt> stratum(sEnd - sStart);
+        std::iota(stratum.begin(), stratum.end(), sStart);
+        std::shuffle(stratum.begin(), stratum.end(), generator);
+        for (PetscInt p = sStart; p < sEnd; ++p) {
+            shuffle[p] = stratum[p - sStart];
+        }
+    }
+    IS shuffleIs;
+    ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, shuffle.data(), PETSC_COPY_VALUES, &shuffleIs) >> errorChecker;
+    DM shuffledDm;
+    DMPlexPermute(dm, shuffleIs, &shuffledDm) >> errorChecker;
+    ISDestroy(&shuffleIs) >> errorChecker;
+    DMDestroy(&dm) >> errorChecker;
+    dm = shuffledDm;
+
+    const auto shuffledBandwidth = ablate::domain::modifiers::ReorderMesh::ComputeCellBandwidth(dm);
+    const auto shuffledDistance = ComputeAverageNeighborDistance(dm);
+
+    // act
+    ablate::domain::modifiers::ReorderMesh reorderMesh(GetParam(), true);
+    reorderMesh.Modify(dm);
+
+    // assert
+    // the mesh must still be valid and cover the same area
+    DMPlexCheckSymmetry(dm) >> errorChecker;
+    DMPlexCheckSkeleton(dm, 0) >> errorChecker;
+    DMPlexCheckFaces(dm, 0) >> errorChecker;
+    PetscInt cStart, cEnd, fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> errorChecker;
+    ASSERT_EQ(144, cEnd - cStart);
+    PetscReal totalVolume = 0.0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal volume;
+        DMPlexComputeCellGeometryFVM(dm, c, &volume, nullptr, nullptr) >> errorChecker;
+        totalVolume += volume;
+    }
+    ASSERT_NEAR(1.0, totalVolume, 1E-12);
+
+    // the faces should be numbered in the order they are first reached by the cells
+    PetscInt nextFace = fStart;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt coneSize;
+        const PetscInt* cone;
+        DMPlexGetConeSize(dm, c, &coneSize) >> errorChecker;
+        DMPlexGetCone(dm, c, &cone) >> errorChecker;
+        std::vector<PetscInt> coneFaces(cone, cone + coneSize);
+        std::sort(coneFaces.begin(), coneFaces.end());
+        for (const auto& face : coneFaces) {
+            ASSERT_LE(face, nextFace) << "face " << face << " is not numbered after the previous cells";
+            if (face == nextFace) {
+                nextFace++;
+            }
+        }
+    }
+
+    // the locality should be improved
+    ASSERT_LT(ablate::domain::modifiers::ReorderMesh::ComputeCellBandwidth(dm), shuffledBandwidth);
+    ASSERT_LT(ComputeAverageNeighborDistance(dm), shuffledDistance / 4.0);
+
+    DMDestroy(&dm) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(ReorderMeshTests, ReorderMeshTestFixture,
+                         testing::Values(ablate::domain::modifiers::ReorderMesh::Ordering::RCM, ablate::domain::modifiers::ReorderMesh::Ordering::MORTON),
+                         [](const testing::TestParamInfo<ablate::domain::modifiers::ReorderMesh::Ordering>& info) {
+                             std::stringstream name;
+                             name << info.param;
+                             return name.str();
+                         });
+
+/**
+ * Computes a location for every point in the dm (the centroid of cells and faces and the coordinates of vertices) so that points can be matched across ranks
+ */
+static std::vector<std::array<PetscReal, 3>> ComputePointLocations(DM dm) {
+    PetscInt pStart, pEnd, vStart, vEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> ablate::utilities::PetscUtilities::checkError;
+    DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> ablate::utilities::PetscUtilities::checkError;
+    PetscInt cdim;
+    DMGetCoordinateDim(dm, &cdim) >> ablate::utilities::PetscUtilities::checkError;
+
+    PetscSection coordinateSection;
+    Vec coordinates;
+    const PetscScalar* coordinateArray;
+    DMGetCoordinateSection(dm, &coordinateSection) >> ablate::utilities::PetscUtilities::checkError;
+    DMGetCoordinatesLocal(dm, &coordinates) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(coordinates, &coordinateArray) >> ablate::utilities::PetscUtilities::checkError;
+
+    std::vector<std::array<PetscReal, 3>> locations(pEnd - pStart, {0.0, 0.0, 0.0});
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        if (p >= vStart && p < vEnd) {
+            PetscInt offset;
+            PetscSectionGetOffset(coordinateSection, p, &offset) >> ablate::utilities::PetscUtilities::checkError;
+            for (PetscInt d = 0; d < cdim; ++d) {
+                locations[p - pStart][d] = PetscRealPart(coordinateArray[offset + d]);
+            }
+        } else {
+            DMPlexComputeCellGeometryFVM(dm, p, nullptr, locations[p - pStart].data(), nullptr) >> ablate::utilities::PetscUtilities::checkError;
+        }
+    }
+    VecRestoreArrayRead(coordinates, &coordinateArray) >> ablate::utilities::PetscUtilities::checkError;
+    return locations;
+}
+
+class ReorderMeshMpiTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(ReorderMeshMpiTestFixture, ShouldKeepThePointSFConsistentOnADistributedMesh) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // arrange
+            DM dm;
+            PetscInt faces[2] = {8, 8};
+            DMPlexCreateBoxMesh(PETSC_COMM_WORLD, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> testErrorChecker;
+            ablate::domain::modifiers::DistributeWithGhostCells(1).Modify(dm);
+
+            PetscSF pointSF;
+            PetscInt numberLeavesBefore;
+            DMGetPointSF(dm, &pointSF) >> testErrorChecker;
+            PetscSFGetGraph(pointSF, nullptr, &numberLeavesBefore, nullptr, nullptr) >> testErrorChecker;
+
+            // act
+            ablate::domain::modifiers::ReorderMesh reorderMesh(ablate::domain::modifiers::ReorderMesh::Ordering::RCM);
+            reorderMesh.Modify(dm);
+
+            // assert
+            DMPlexCheckSymmetry(dm) >> testErrorChecker;
+            DMPlexCheckSkeleton(dm, 0) >> testErrorChecker;
+            DMPlexCheckFaces(dm, 0) >> testErrorChecker;
+
+            // the same points must still be shared
+            PetscInt numberRoots, numberLeaves;
+            const PetscInt* leaves;
+            DMGetPointSF(dm, &pointSF) >> testErrorChecker;
+            PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, &leaves, nullptr) >> testErrorChecker;
+            ASSERT_EQ(numberLeavesBefore, numberLeaves);
+
+            // every leaf must point at a root at the same location
+            auto locations = ComputePointLocations(dm);
+            for (PetscInt d = 0; d < 3; ++d) {
+                std::vector<PetscReal> rootLocations(numberRoots), leafLocations(numberRoots);
+                for (PetscInt p = 0; p < numberRoots; ++p) {
+                    rootLocations[p] = locations[p][d];
+                    leafLocations[p] = locations[p][d];
+                }
+                PetscSFBcastBegin(pointSF, MPIU_REAL, rootLocations.data(), leafLocations.data(), MPI_REPLACE) >> testErrorChecker;
+                PetscSFBcastEnd(pointSF, MPIU_REAL, rootLocations.data(), leafLocations.data(), MPI_REPLACE) >> testErrorChecker;
+                for (PetscInt l = 0; l < numberLeaves; ++l) {
+                    const PetscInt leaf = leaves ? leaves[l] : l;
+                    ASSERT_NEAR(leafLocations[leaf], locations[leaf][d], 1E-12) << "leaf point " << leaf << " does not match its root in direction " << d;
+                }
+            }
+
+            // a cell field should survive a round trip through the global vector
+            PetscInt cStart, cEnd;
+            DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> testErrorChecker;
+            PetscSection section;
+            PetscInt pStart, pEnd;
+            DMPlexGetChart(dm, &pStart, &pEnd) >> testErrorChecker;
+            PetscSectionCreate(PETSC_COMM_SELF, &section) >> testErrorChecker;
+            PetscSectionSetChart(section, pStart, pEnd) >> testErrorChecker;
+            for (PetscInt c = cStart; c < cEnd; ++c) {
+                PetscSectionSetDof(section, c, 1) >> testErrorChecker;
+            }
+            PetscSectionSetUp(section) >> testErrorChecker;
+            DMSetLocalSection(dm, section) >> testErrorChecker;
+            PetscSectionDestroy(&section) >> testErrorChecker;
+
+            Vec localVec, globalVec;
+            DMCreateLocalVector(dm, &localVec) >> testErrorChecker;
+            DMCreateGlobalVector(dm, &globalVec) >> testErrorChecker;
+            PetscInt globalSize;
+            VecGetSize(globalVec, &globalSize) >> testErrorChecker;
+            ASSERT_EQ(64, globalSize);
+
+            PetscScalar* localArray;
+            VecGetArray(localVec, &localArray) >> testErrorChecker;
+            for (PetscInt c = cStart; c < cEnd; ++c) {
+                localArray[c - cStart] = locations[c - pStart][0] + 10.0 * locations[c - pStart][1];
+            }
+            VecRestoreArray(localVec, &localArray) >> testErrorChecker;
+            DMLocalToGlobal(dm, localVec, INSERT_VALUES, globalVec) >> testErrorChecker;
+            VecZeroEntries(localVec) >> testErrorChecker;
+            DMGlobalToLocal(dm, globalVec, INSERT_VALUES, localVec) >> testErrorChecker;
+
+            const PetscScalar* roundTripArray;
+            VecGetArrayRead(localVec, &roundTripArray) >> testErrorChecker;
+            for (PetscInt c = cStart; c < cEnd; ++c) {
+                ASSERT_NEAR(PetscRealPart(roundTripArray[c - cStart]), locations[c - pStart][0] + 10.0 * locations[c - pStart][1], 1E-12) << "cell " << c << " did not round trip";
+            }
+            VecRestoreArrayRead(localVec, &roundTripArray) >> testErrorChecker;
+
+            VecDestroy(&localVec) >> testErrorChecker;
+            VecDestroy(&globalVec) >> testErrorChecker;
+            DMDestroy(&dm) >> testErrorChecker;
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(ReorderMeshTests, ReorderMeshMpiTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("reorder distributed mesh 2 proc", 2), testingResources::MpiTestParameter("reorder distributed mesh 3 proc", 3)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
+
+}  // namespace ablateTesting::domain::modifier
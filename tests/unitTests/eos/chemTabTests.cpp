@@ -135,6 +135,104 @@ TEST_P(ChemTabTestFixture, ShouldComputeCorrectSource) {
     }
 }
 
+/*******************************************************************************************************
+ * Tests that the batched source calculator matches the single point source
+ */
+TEST_P(ChemTabTestFixture, ShouldComputeBatchedSourceMatchingSinglePointSource) {
+    ONLY_WITH_TENSORFLOW_CHECK;
+
+    // iterate over each test
+    for (const auto& testTarget : testTargets) {
+        // arrange
+        // use a batch size that does not divide the number of cells so that both the full and remainder tensors are used
+        auto chemTabModel = std::make_shared<ablate::eos::ChemTab>(GetParam().modelPath, 2);
+        auto inputProgressVariables = testTarget["input_cpvs"].as<std::vector<double>>();
+        const auto numberProgressVariables = (PetscInt)chemTabModel->GetProgressVariables().size();
+
+        // create a simple 1D mesh holding the euler and density progress fields in each cell
+        const PetscInt numberCells = 5;
+        const PetscInt eulerSize = 3;
+        DM dm;
+        PetscInt faces[1] = {numberCells};
+        DMPlexCreateBoxMesh(PETSC_COMM_SELF, 1, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+        PetscSection section;
+        PetscSectionCreate(PETSC_COMM_SELF, &section) >> errorChecker;
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+        PetscInt pStart, pEnd;
+        DMPlexGetChart(dm, &pStart, &pEnd) >> errorChecker;
+        PetscSectionSetChart(section, pStart, pEnd) >> errorChecker;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PetscSectionSetDof(section, c, eulerSize + numberProgressVariables) >> errorChecker;
+        }
+        PetscSectionSetUp(section) >> errorChecker;
+        DMSetLocalSection(dm, section) >> errorChecker;
+        PetscSectionDestroy(&section) >> errorChecker;
+
+        std::vector<ablate::domain::Field> fields = {
+            ablateTesting::domain::MockField::Create(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD, eulerSize, 0),
+            ablateTesting::domain::MockField::Create(ablate::finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD, numberProgressVariables, eulerSize)};
+
+        // vary the density and progress variables in each cell
+        Vec locX, locF;
+        DMCreateLocalVector(dm, &locX) >> errorChecker;
+        VecDuplicate(locX, &locF) >> errorChecker;
+        VecZeroEntries(locF) >> errorChecker;
+        PetscScalar* xArray;
+        VecGetArray(locX, &xArray) >> errorChecker;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PetscScalar* cellValues;
+            DMPlexPointLocalRef(dm, c, xArray, &cellValues) >> errorChecker;
+            const PetscReal density = 1.0 + 0.1 * (c - cStart);
+            cellValues[ablate::finiteVolume::CompressibleFlowFields::RHO] = density;
+            cellValues[ablate::finiteVolume::CompressibleFlowFields::RHOE] = 0.0;
+            cellValues[ablate::finiteVolume::CompressibleFlowFields::RHOU] = 0.0;
+            for (PetscInt p = 0; p < numberProgressVariables; ++p) {
+                const PetscReal progressVariable = p < (PetscInt)inputProgressVariables.size() ? inputProgressVariables[p] * (1.0 + 0.01 * (c - cStart)) : 0.0;
+                cellValues[eulerSize + p] = progressVariable * density;
+            }
+        }
+        VecRestoreArray(locX, &xArray) >> errorChecker;
+
+        // act
+        ablate::domain::Range cellRange{.start = cStart, .end = cEnd};
+        auto sourceCalculator = chemTabModel->CreateSourceCalculator(fields, cellRange);
+        sourceCalculator->AddSource(cellRange, locX, locF);
+
+        // assert
+        const PetscScalar* xArrayRead;
+        const PetscScalar* fArray;
+        VecGetArrayRead(locX, &xArrayRead) >> errorChecker;
+        VecGetArrayRead(locF, &fArray) >> errorChecker;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            const PetscScalar* cellValues;
+            const PetscScalar* cellSource;
+            DMPlexPointLocalRead(dm, c, xArrayRead, &cellValues) >> errorChecker;
+            DMPlexPointLocalRead(dm, c, fArray, &cellSource) >> errorChecker;
+
+            const PetscReal density = cellValues[ablate::finiteVolume::CompressibleFlowFields::RHO];
+            PetscReal expectedSourceEnergy = 0.0;
+            std::vector<PetscReal> expectedSourceProgress(numberProgressVariables, 0.0);
+            chemTabModel->ChemistrySource(density, cellValues + eulerSize, &expectedSourceEnergy, expectedSourceProgress.data());
+
+            // the model may use different kernels for different batch sizes, so allow for float round off
+            EXPECT_NEAR(expectedSourceEnergy, cellSource[ablate::finiteVolume::CompressibleFlowFields::RHOE], PetscMax(1.0E-5 * PetscAbs(expectedSourceEnergy), 1.0E-8))
+                << "The batched sourceEnergy is incorrect for cell " << c;
+            for (PetscInt p = 0; p < numberProgressVariables; ++p) {
+                EXPECT_NEAR(expectedSourceProgress[p], cellSource[eulerSize + p], PetscMax(1.0E-5 * PetscAbs(expectedSourceProgress[p]), 1.0E-8))
+                    << "The batched progress source [" << p << "] is incorrect for cell " << c;
+            }
+        }
+        VecRestoreArrayRead(locX, &xArrayRead) >> errorChecker;
+        VecRestoreArrayRead(locF, &fArray) >> errorChecker;
+
+        // cleanup
+        VecDestroy(&locX) >> errorChecker;
+        VecDestroy(&locF) >> errorChecker;
+        DMDestroy(&dm) >> errorChecker;
+    }
+}
+
 TEST_P(ChemTabTestFixture, ShouldComputeCorrectThermalProperties) {
     ONLY_WITH_TENSORFLOW_CHECK;
 
@@ -89,6 +89,50 @@ TEST_P(SGThermodynamicPropertyTestFixture, ShouldComputeProperty) {
     }
 }
 
+TEST_P(SGThermodynamicPropertyTestFixture, ShouldComputePropertyInBatch) {
+    // arrange
+    auto parameters = std::make_shared<ablate::parameters::MapParameters>(GetParam().options);
+    std::shared_ptr<ablate::eos::EOS> eos = std::make_shared<ablate::eos::StiffenedGas>(parameters, GetParam().species);
+
+    // get the test params
+    const auto& params = GetParam();
+
+    // copy the state into a padded batch
+    const PetscInt numberStates = 3;
+    const auto stride = (PetscInt)params.conservedValues.size() + 1;
+    std::vector<PetscReal> conservedBatch(numberStates * stride, NAN);
+    for (PetscInt s = 0; s < numberStates; s++) {
+        std::copy(params.conservedValues.begin(), params.conservedValues.end(), conservedBatch.begin() + s * stride);
+    }
+
+    // act/assert check for compute without temperature
+    auto batchFunction = eos->GetThermodynamicBatchFunction(params.thermodynamicProperty, params.fields);
+    ASSERT_EQ(params.expectedValue.size(), batchFunction.propertySize);
+    std::vector<PetscReal> computedProperty(numberStates * params.expectedValue.size(), NAN);
+    ASSERT_EQ(0, batchFunction.function(numberStates, conservedBatch.data(), stride, computedProperty.data(), batchFunction.context.get()));
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
+            ASSERT_NEAR(computedProperty[s * params.expectedValue.size() + c], params.expectedValue[c], 1E-6) << "for batch function ";
+        }
+    }
+
+    // act/assert check for compute when temperature is known
+    auto temperatureFunction = eos->GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty::Temperature, params.fields);
+    std::vector<PetscReal> computedTemperature(numberStates, NAN);
+    ASSERT_EQ(0, temperatureFunction.function(numberStates, conservedBatch.data(), stride, computedTemperature.data(), temperatureFunction.context.get()));
+
+    auto batchTemperatureFunction = eos->GetThermodynamicTemperatureBatchFunction(params.thermodynamicProperty, params.fields);
+    computedProperty = std::vector<PetscReal>(numberStates * params.expectedValue.size(), NAN);
+    ASSERT_EQ(0, batchTemperatureFunction.function(numberStates, conservedBatch.data(), stride, computedTemperature.data(), computedProperty.data(), batchTemperatureFunction.context.get()));
+
+    for (PetscInt s = 0; s < numberStates; s++) {
+        for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
+            ASSERT_NEAR(computedProperty[s * params.expectedValue.size() + c], params.expectedValue[c], 1E-6) << "for batch temperature function ";
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(StiffenedGasEOSTests, SGThermodynamicPropertyTestFixture,
                          testing::Values((SGTestParameters){.options = {{"gamma", "1.932"}, {"Cp", "8095.08"}, {"p0", "1.1645E9"}},
                                                             .species = {},
@@ -0,0 +1,138 @@
+#include <cmath>
+#include "eos/tChem/isatTable.hpp"
+#include "gtest/gtest.h"
+
+TEST(IsatTableTests, ShouldMissWhenEmpty) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(2, 1, 1E-2, 1E-2, 10);
+    double key[2] = {0.0, 0.0};
+    double value[1] = {NAN};
+
+    // act
+    auto retrieved = table.Retrieve(key, value);
+
+    // assert
+    ASSERT_FALSE(retrieved);
+    ASSERT_EQ(1, table.GetStatistics().misses);
+}
+
+TEST(IsatTableTests, ShouldRetrieveInsideTheRegionOfAccuracy) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(2, 1, 1E-2, 1E-2, 10);
+    double key[2] = {1.0, 2.0};
+    double value[1] = {3.0};
+    table.Add(key, value);
+
+    // act
+    double nearKey[2] = {1.005, 2.0};
+    double farKey[2] = {1.5, 2.0};
+    double nearValue[1] = {NAN};
+    double farValue[1] = {NAN};
+    auto nearRetrieved = table.Retrieve(nearKey, nearValue);
+    auto farRetrieved = table.Retrieve(farKey, farValue);
+
+    // assert
+    ASSERT_TRUE(nearRetrieved);
+    ASSERT_DOUBLE_EQ(3.0, nearValue[0]);
+    ASSERT_FALSE(farRetrieved);
+    ASSERT_EQ(1, table.GetStatistics().hits);
+    ASSERT_EQ(1, table.GetStatistics().misses);
+}
+
+TEST(IsatTableTests, ShouldGrowWhenTheRecordPredictsTheValue) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(2, 1, 1E-2, 1E-2, 10);
+    double key[2] = {1.0, 2.0};
+    double value[1] = {3.0};
+    table.Add(key, value);
+
+    // act
+    double grownKey[2] = {1.5, 2.0};
+    double grownValue[1] = {3.005};
+    table.Add(grownKey, grownValue);
+    double retrievedValue[1] = {NAN};
+    double queryKey[2] = {1.4, 2.0};
+    auto retrieved = table.Retrieve(queryKey, retrievedValue);
+
+    // assert
+    ASSERT_EQ(1, table.Size());
+    ASSERT_EQ(1, table.GetStatistics().grows);
+    ASSERT_TRUE(retrieved);
+    ASSERT_DOUBLE_EQ(3.0, retrievedValue[0]);
+}
+
+TEST(IsatTableTests, ShouldOnlyGrowAlongTheCheckedDirection) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(2, 1, 1E-2, 1E-2, 10);
+    double key[2] = {1.0, 2.0};
+    double value[1] = {3.0};
+    table.Add(key, value);
+
+    // act
+    double grownKey[2] = {1.5, 2.0};
+    double grownValue[1] = {3.005};
+    table.Add(grownKey, grownValue);
+    double retrievedValue[1] = {NAN};
+    double originalRegionKey[2] = {1.0, 2.009};
+    double uncheckedKey[2] = {1.0, 2.4};
+    auto originalRegionRetrieved = table.Retrieve(originalRegionKey, retrievedValue);
+    auto uncheckedRetrieved = table.Retrieve(uncheckedKey, retrievedValue);
+
+    // assert
+    ASSERT_TRUE(originalRegionRetrieved) << "the initial region of accuracy should be kept";
+    ASSERT_FALSE(uncheckedRetrieved) << "the region of accuracy should not grow in the unchecked direction";
+}
+
+TEST(IsatTableTests, ShouldAddRecordWhenTheGrowthLimitIsReached) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(2, 1, 1E-2, 1E-2, 10, 1);
+    double key[2] = {1.0, 2.0};
+    double value[1] = {3.0};
+    table.Add(key, value);
+
+    // act
+    double firstKey[2] = {1.5, 2.0};
+    double secondKey[2] = {1.0, 2.5};
+    double grownValue[1] = {3.005};
+    table.Add(firstKey, grownValue);
+    table.Add(secondKey, grownValue);
+
+    // assert
+    ASSERT_EQ(1, table.GetStatistics().grows);
+    ASSERT_EQ(2, table.Size());
+}
+
+TEST(IsatTableTests, ShouldAddRecordsAndSearchTheTree) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(1, 1, 1E-3, 1E-3, 10);
+    for (int i = 0; i < 5; ++i) {
+        double key[1] = {(double)i};
+        double value[1] = {10.0 * i};
+        table.Add(key, value);
+    }
+
+    // act/assert
+    ASSERT_EQ(5, table.Size());
+    ASSERT_EQ(5, table.GetStatistics().adds);
+    for (int i = 0; i < 5; ++i) {
+        double key[1] = {i + 1E-4};
+        double value[1] = {NAN};
+        ASSERT_TRUE(table.Retrieve(key, value)) << "key " << i << " should be retrieved";
+        ASSERT_DOUBLE_EQ(10.0 * i, value[0]);
+    }
+}
+
+TEST(IsatTableTests, ShouldNotAddPastTheMaximumNumberOfRecords) {
+    // arrange
+    ablate::eos::tChem::IsatTable table(1, 1, 1E-3, 1E-3, 2);
+
+    // act
+    for (int i = 0; i < 5; ++i) {
+        double key[1] = {(double)i};
+        double value[1] = {10.0 * i};
+        table.Add(key, value);
+    }
+
+    // assert
+    ASSERT_EQ(2, table.Size());
+}
@@ -0,0 +1,281 @@
+#include <petsc.h>
+#include <memory>
+#include <set>
+#include <vector>
+#include "MpiTestFixture.hpp"
+#include "PetscTestFixture.hpp"
+#include "domain/boxMesh.hpp"
+#include "domain/dynamicRange.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/tChem.hpp"
+#include "eos/tChem/sourceCalculator.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablateTesting::eos::tChem {
+
+class SourceCalculatorLoadBalanceTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+
+   protected:
+    //! a partially reacted gri30 state
+    inline static const std::vector<PetscReal> eulerValues = {0.280629, 214342., 0.};
+    inline static const std::vector<PetscReal> densityYiValues = {
+        2.70155e-06, 2.42588e-10, 1.75298e-09, 0.0615735,   5.91967e-09, 0.00013291,  1.42223e-06, 2.69273e-07, 1.17659e-25, 2.62694e-19,  1.04261e-12, 1.55473e-13, 3.29875e-06, 0.0153352,
+        3.5785e-05,  2.61125e-07, 2.32785e-10, 0.000118819, 2.02248e-12, 3.19032e-09, 1.6112e-06,  3.70467e-18, 1.90909e-09, 1.00394e-12,  3.84067e-06, 1.46041e-09, 5.52161e-05, 1.51027e-14,
+        3.77118e-08, 8.45969e-14, 1.76002e-20, 3.66826e-19, 2.92689e-20, 3.18488e-20, 4.77626e-15, 1.73259e-15, 1.22235e-15, 1.81966e-10, 7.66494e-19, 1.00758e-26, 1.13374e-17, 2.26247e-22,
+        3.89214e-21, 2.08805e-21, 1.82355e-22, 2.25953e-19, 1.26537e-19, -4.31761e-27, 6.78129e-13, 1.13467e-08, 8.23985e-12, 1.12011e-10, 0.203364};
+
+    /**
+     * Computes the euler and densityYi source for each cell in the range
+     */
+    std::vector<std::vector<PetscReal>> ComputeSource(const std::shared_ptr<ablate::eos::TChem>& eos, const std::shared_ptr<ablate::domain::BoxMesh>& domain, const ablate::domain::Range& range,
+                                                      PetscReal dt) {
+        Vec computedF;
+        DMGetLocalVector(domain->GetDM(), &computedF) >> testErrorChecker;
+        VecZeroEntries(computedF) >> testErrorChecker;
+
+        auto sourceTermCalculator = eos->CreateSourceCalculator(domain->GetFields(), range);
+        sourceTermCalculator->ComputeSource(range, 0.0, dt, domain->GetSolutionVector());
+        sourceTermCalculator->AddSource(range, domain->GetSolutionVector(), computedF);
+
+        std::vector<std::vector<PetscReal>> sources;
+        PetscScalar* sourceArray;
+        VecGetArray(computedF, &sourceArray) >> testErrorChecker;
+        for (PetscInt c = range.start; c < range.end; ++c) {
+            const PetscInt cell = range.points ? range.points[c] : c;
+            PetscScalar* eulerSource = nullptr;
+            DMPlexPointLocalFieldRef(domain->GetDM(), cell, domain->GetField("euler").id, sourceArray, &eulerSource) >> testErrorChecker;
+            PetscScalar* densityYiSource = nullptr;
+            DMPlexPointLocalFieldRef(domain->GetDM(), cell, domain->GetField("densityYi").id, sourceArray, &densityYiSource) >> testErrorChecker;
+
+            std::vector<PetscReal> cellSource(eulerSource, eulerSource + eulerValues.size());
+            cellSource.insert(cellSource.end(), densityYiSource, densityYiSource + densityYiValues.size());
+            sources.push_back(cellSource);
+        }
+        VecRestoreArray(computedF, &sourceArray) >> testErrorChecker;
+        DMRestoreLocalVector(domain->GetDM(), &computedF) >> testErrorChecker;
+        return sources;
+    }
+};
+
+TEST_P(SourceCalculatorLoadBalanceTestFixture, ShouldComputeTheSameSourceWhenBalanced) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // arrange
+            const PetscReal dt = 0.017418748136926492;
+            auto directEos = std::make_shared<ablate::eos::TChem>("inputs/eos/gri30.yaml");
+            auto balancedEos = std::make_shared<ablate::eos::TChem>("inputs/eos/gri30.yaml", nullptr, ablate::parameters::MapParameters::Create({{"loadBalanceTolerance", "1.05"}}));
+
+            auto domain = std::make_shared<ablate::domain::BoxMesh>("oneD",
+                                                                    std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(directEos)},
+                                                                    std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                    std::vector<int>{12},
+                                                                    std::vector<double>{0.0},
+                                                                    std::vector<double>{1.0});
+            domain->InitializeSubDomains();
+
+            // the first rank computes the source in every local cell while the other ranks compute at most one cell
+            PetscMPIInt rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            PetscInt cStart, cEnd;
+            DMPlexGetHeightStratum(domain->GetDM(), 0, &cStart, &cEnd) >> testErrorChecker;
+            if (rank != 0) {
+                cEnd = PetscMin(cEnd, cStart + 1);
+            }
+
+            // give each cell a different energy so that a misplaced result changes the source
+            PetscScalar* solution;
+            VecGetArray(domain->GetSolutionVector(), &solution) >> testErrorChecker;
+            ablate::domain::DynamicRange range;
+            for (PetscInt c = cStart; c < cEnd; ++c) {
+                PetscScalar* eulerField = nullptr;
+                DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("euler").id, solution, &eulerField) >> testErrorChecker;
+                for (std::size_t i = 0; i < eulerValues.size(); i++) {
+                    eulerField[i] = eulerValues[i];
+                }
+                eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] *= (1.0 + 1.0E-2 * (c - cStart + rank));
+
+                PetscScalar* densityYiField = nullptr;
+                DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("densityYi").id, solution, &densityYiField) >> testErrorChecker;
+                for (std::size_t i = 0; i < densityYiValues.size(); i++) {
+                    densityYiField[i] = densityYiValues[i];
+                }
+                range.Add(c);
+            }
+            VecRestoreArray(domain->GetSolutionVector(), &solution) >> testErrorChecker;
+
+            // make sure that the work is unbalanced
+            PetscInt localCells = cEnd - cStart, minCells, maxCells;
+            MPI_Allreduce(&localCells, &minCells, 1, MPIU_INT, MPI_MIN, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&localCells, &maxCells, 1, MPIU_INT, MPI_MAX, PETSC_COMM_WORLD) >> testErrorChecker;
+            ASSERT_GT(maxCells, minCells + 1) << "The test requires an unbalanced number of cells";
+
+            // act
+            auto expectedSources = ComputeSource(directEos, domain, range.GetRange(), dt);
+            auto balancedSources = ComputeSource(balancedEos, domain, range.GetRange(), dt);
+
+            // assert
+            ASSERT_EQ(expectedSources.size(), balancedSources.size());
+            for (std::size_t c = 0; c < expectedSources.size(); ++c) {
+                ASSERT_GT(PetscAbs(expectedSources[c][ablate::finiteVolume::CompressibleFlowFields::RHOE]), 0.0) << "The energy source should be nonzero in cell " << c;
+                for (std::size_t i = 0; i < expectedSources[c].size(); i++) {
+                    ASSERT_NEAR(expectedSources[c][i], balancedSources[c][i], 1E-6 * PetscAbs(expectedSources[c][i]) + 1E-10)
+                        << "The balanced source for component " << i << " in cell " << c << " on rank " << rank << " should match the unbalanced source";
+                }
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(SourceCalculatorTests, SourceCalculatorLoadBalanceTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("load balance 2 proc", 2), testingResources::MpiTestParameter("load balance 3 proc", 3)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
+
+/**
+ * Source calculator that marks the selected cells as failed after the first integration so that they must be retried
+ */
+class FailingCellsSourceCalculator : public ablate::eos::tChem::SourceCalculator {
+   public:
+    using SourceCalculator::SourceCalculator;
+
+    //! the chemIndex of each cell to mark as failed after the first integration
+    std::set<ordinal_type> failedCells;
+
+    //! the batch size of each call to IntegrateBatch
+    std::vector<ordinal_type> batchSizes;
+
+   protected:
+    void IntegrateBatch(ordinal_type batchSize, const real_type_2d_view& fac, const time_advance_type_1d_view& timeAdvance, const real_type_2d_view& state, const real_type_1d_view& timeView,
+                        const real_type_1d_view& dtView, const real_type_2d_view& endState) override {
+        SourceCalculator::IntegrateBatch(batchSize, fac, timeAdvance, state, timeView, dtView, endState);
+        batchSizes.push_back(batchSize);
+
+        // the reactors mark a failed integration with a zero pressure
+        if (batchSizes.size() == 1) {
+            auto endStateHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), endState);
+            for (auto chemIndex : failedCells) {
+                Impl::StateVector<real_type_1d_view_host> stateVector((ordinal_type)endStateHost.extent(1) - 3, Kokkos::subview(endStateHost, chemIndex, Kokkos::ALL()));
+                stateVector.Pressure() = 0.0;
+            }
+            Kokkos::deep_copy(endState, endStateHost);
+        }
+    }
+};
+
+class SourceCalculatorRetryTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    //! a partially reacted gri30 state
+    inline static const std::vector<PetscReal> eulerValues = {0.280629, 214342., 0.};
+    inline static const std::vector<PetscReal> densityYiValues = {
+        2.70155e-06, 2.42588e-10, 1.75298e-09, 0.0615735,   5.91967e-09, 0.00013291,  1.42223e-06, 2.69273e-07, 1.17659e-25, 2.62694e-19,  1.04261e-12, 1.55473e-13, 3.29875e-06, 0.0153352,
+        3.5785e-05,  2.61125e-07, 2.32785e-10, 0.000118819, 2.02248e-12, 3.19032e-09, 1.6112e-06,  3.70467e-18, 1.90909e-09, 1.00394e-12,  3.84067e-06, 1.46041e-09, 5.52161e-05, 1.51027e-14,
+        3.77118e-08, 8.45969e-14, 1.76002e-20, 3.66826e-19, 2.92689e-20, 3.18488e-20, 4.77626e-15, 1.73259e-15, 1.22235e-15, 1.81966e-10, 7.66494e-19, 1.00758e-26, 1.13374e-17, 2.26247e-22,
+        3.89214e-21, 2.08805e-21, 1.82355e-22, 2.25953e-19, 1.26537e-19, -4.31761e-27, 6.78129e-13, 1.13467e-08, 8.23985e-12, 1.12011e-10, 0.203364};
+
+    /**
+     * Computes the euler and densityYi source for each cell in the range
+     */
+    std::vector<std::vector<PetscReal>> ComputeSource(ablate::eos::tChem::SourceCalculator& sourceTermCalculator, const std::shared_ptr<ablate::domain::BoxMesh>& domain,
+                                                      const ablate::domain::Range& range, PetscReal dt) {
+        Vec computedF;
+        DMGetLocalVector(domain->GetDM(), &computedF) >> errorChecker;
+        VecZeroEntries(computedF) >> errorChecker;
+
+        sourceTermCalculator.ComputeSource(range, 0.0, dt, domain->GetSolutionVector());
+        sourceTermCalculator.AddSource(range, domain->GetSolutionVector(), computedF);
+
+        std::vector<std::vector<PetscReal>> sources;
+        PetscScalar* sourceArray;
+        VecGetArray(computedF, &sourceArray) >> errorChecker;
+        for (PetscInt c = range.start; c < range.end; ++c) {
+            const PetscInt cell = range.points ? range.points[c] : c;
+            PetscScalar* eulerSource = nullptr;
+            DMPlexPointLocalFieldRef(domain->GetDM(), cell, domain->GetField("euler").id, sourceArray, &eulerSource) >> errorChecker;
+            PetscScalar* densityYiSource = nullptr;
+            DMPlexPointLocalFieldRef(domain->GetDM(), cell, domain->GetField("densityYi").id, sourceArray, &densityYiSource) >> errorChecker;
+
+            std::vector<PetscReal> cellSource(eulerSource, eulerSource + eulerValues.size());
+            cellSource.insert(cellSource.end(), densityYiSource, densityYiSource + densityYiValues.size());
+            sources.push_back(cellSource);
+        }
+        VecRestoreArray(computedF, &sourceArray) >> errorChecker;
+        DMRestoreLocalVector(domain->GetDM(), &computedF) >> errorChecker;
+        return sources;
+    }
+};
+
+TEST_F(SourceCalculatorRetryTestFixture, ShouldOnlyRetryTheFailedCells) {
+    // arrange
+    const PetscReal dt = 0.017418748136926492;
+    const PetscInt numberCells = 6;
+    auto eos = std::make_shared<ablate::eos::TChem>("inputs/eos/gri30.yaml");
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("oneD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{numberCells},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // give each cell a different energy so that a misplaced result changes the source
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> errorChecker;
+    ablate::domain::DynamicRange range;
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscScalar* eulerField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("euler").id, solution, &eulerField) >> errorChecker;
+        for (std::size_t i = 0; i < eulerValues.size(); i++) {
+            eulerField[i] = eulerValues[i];
+        }
+        eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] *= (1.0 + 1.0E-2 * c);
+
+        PetscScalar* densityYiField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("densityYi").id, solution, &densityYiField) >> errorChecker;
+        for (std::size_t i = 0; i < densityYiValues.size(); i++) {
+            densityYiField[i] = densityYiValues[i];
+        }
+        range.Add(c);
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> errorChecker;
+
+    const ablate::eos::tChem::SourceCalculator::ChemistryConstraints constraints{};
+    ablate::eos::tChem::SourceCalculator sourceCalculator(domain->GetFields(), eos, constraints, range.GetRange());
+    FailingCellsSourceCalculator failingSourceCalculator(domain->GetFields(), eos, constraints, range.GetRange());
+    failingSourceCalculator.failedCells = {1, 4};
+
+    // act
+    auto expectedSources = ComputeSource(sourceCalculator, domain, range.GetRange(), dt);
+    auto retriedSources = ComputeSource(failingSourceCalculator, domain, range.GetRange(), dt);
+
+    // assert
+    ASSERT_EQ((std::vector<ordinal_type>{(ordinal_type)numberCells, 2}), failingSourceCalculator.batchSizes) << "Only the failed cells should be retried, and only once";
+    ASSERT_EQ(expectedSources.size(), retriedSources.size());
+    for (std::size_t c = 0; c < expectedSources.size(); ++c) {
+        ASSERT_GT(PetscAbs(expectedSources[c][ablate::finiteVolume::CompressibleFlowFields::RHOE]), 0.0) << "The energy source should be nonzero in cell " << c;
+        if (failingSourceCalculator.failedCells.count((ordinal_type)c)) {
+            // the retried cells start with a smaller dt so compare the norm of the source
+            PetscReal differenceNorm = 0.0;
+            PetscReal expectedNorm = 0.0;
+            for (std::size_t i = 0; i < expectedSources[c].size(); i++) {
+                differenceNorm += PetscSqr(expectedSources[c][i] - retriedSources[c][i]);
+                expectedNorm += PetscSqr(expectedSources[c][i]);
+            }
+            ASSERT_LT(PetscSqrtReal(differenceNorm), 1E-3 * PetscSqrtReal(expectedNorm)) << "The retried source for cell " << c << " should be scattered back to the same cell";
+        } else {
+            for (std::size_t i = 0; i < expectedSources[c].size(); i++) {
+                ASSERT_DOUBLE_EQ(expectedSources[c][i], retriedSources[c][i]) << "The source for component " << i << " in the converged cell " << c << " should not be changed by the retry";
+            }
+        }
+    }
+}
+
+}  // namespace ablateTesting::eos::tChem
@@ -6,6 +6,7 @@
 #include "eos/tChem.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
 
 /*
  * Helper function to fill mass fraction
@@ -257,6 +258,71 @@ TEST_P(TCThermodynamicPropertyTestFixture, ShouldComputePropertyUsingMassFractio
     }
 }
 
+TEST_P(TCThermodynamicPropertyTestFixture, ShouldComputeBatchedPropertiesMatchingSingleState) {
+    // arrange
+    std::shared_ptr<ablate::eos::EOS> eos = std::make_shared<ablate::eos::TChem>(GetParam().mechFile);
+
+    // get the test params
+    const auto& params = GetParam();
+
+    // build the conserved values for a single state, the extra buffer results in a non-unit stride between the states in the batch
+    auto conservedValuesSize = std::accumulate(params.fields.begin(), params.fields.end(), 0, [](int a, const ablate::domain::Field& field) { return a + field.numberComponents; });
+    std::vector<PetscReal> conservedValues(conservedValuesSize + 10, 0.0);
+    const auto eulerOffset = std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) { return field.name == "euler"; })->offset;
+    std::copy(params.conservedEulerValues.begin(), params.conservedEulerValues.end(), conservedValues.begin() + eulerOffset);
+    FillDensityMassFraction(*std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) { return field.name == "densityYi"; }),
+                            eos->GetSpeciesVariables(),
+                            params.yiMap,
+                            params.conservedEulerValues[0],
+                            conservedValues);
+
+    // copy the state into a batch where each state has a different energy
+    const auto stride = (PetscInt)conservedValues.size();
+    const PetscInt maxNumberStates = 7;
+    std::vector<PetscReal> conservedBatch(maxNumberStates * stride, NAN);
+    for (PetscInt s = 0; s < maxNumberStates; s++) {
+        std::copy(conservedValues.begin(), conservedValues.end(), conservedBatch.begin() + s * stride);
+        conservedBatch[s * stride + eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] *= (1.0 + 0.05 * s);
+    }
+
+    for (auto thermodynamicProperty : {ablate::eos::ThermodynamicProperty::Temperature, ablate::eos::ThermodynamicProperty::Pressure, ablate::eos::ThermodynamicProperty::SpeedOfSound}) {
+        // compute the expected values one state at a time
+        auto temperatureFunction = eos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, params.fields);
+        auto thermodynamicFunction = eos->GetThermodynamicFunction(thermodynamicProperty, params.fields);
+        std::vector<PetscReal> expectedTemperature(maxNumberStates);
+        std::vector<PetscReal> expectedProperty(maxNumberStates);
+        for (PetscInt s = 0; s < maxNumberStates; s++) {
+            ASSERT_EQ(0, temperatureFunction.function(conservedBatch.data() + s * stride, &expectedTemperature[s], temperatureFunction.context.get()));
+            ASSERT_EQ(0, thermodynamicFunction.function(conservedBatch.data() + s * stride, &expectedProperty[s], thermodynamicFunction.context.get()));
+        }
+
+        // reuse the same batch functions with a small, a larger (forcing the views to grow), and then a small batch again
+        auto batchFunction = eos->GetThermodynamicBatchFunction(thermodynamicProperty, params.fields);
+        auto batchTemperatureFunction = eos->GetThermodynamicTemperatureBatchFunction(thermodynamicProperty, params.fields);
+        ASSERT_EQ(1, batchFunction.propertySize);
+        ASSERT_EQ(1, batchTemperatureFunction.propertySize);
+        for (PetscInt numberStates : {2, maxNumberStates, 3}) {
+            // act
+            std::vector<PetscReal> computedProperty(numberStates, NAN);
+            ASSERT_EQ(0, batchFunction.function(numberStates, conservedBatch.data(), stride, computedProperty.data(), batchFunction.context.get()));
+            std::vector<PetscReal> computedTemperatureProperty(numberStates, NAN);
+            ASSERT_EQ(0,
+                      batchTemperatureFunction.function(
+                          numberStates, conservedBatch.data(), stride, expectedTemperature.data(), computedTemperatureProperty.data(), batchTemperatureFunction.context.get()));
+
+            // assert
+            for (PetscInt s = 0; s < numberStates; s++) {
+                ASSERT_LT(PetscAbs((expectedProperty[s] - computedProperty[s]) / expectedProperty[s]), params.errorTolerance)
+                    << "The batched " << to_string(thermodynamicProperty) << " (" << expectedProperty[s] << " vs " << computedProperty[s] << ") for state " << s << " of " << numberStates
+                    << " should match the single state function";
+                ASSERT_LT(PetscAbs((expectedProperty[s] - computedTemperatureProperty[s]) / expectedProperty[s]), params.errorTolerance)
+                    << "The batched temperature " << to_string(thermodynamicProperty) << " (" << expectedProperty[s] << " vs " << computedTemperatureProperty[s] << ") for state " << s << " of "
+                    << numberStates << " should match the single state function";
+            }
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TChemTests, TCThermodynamicPropertyTestFixture,
     testing::Values(
@@ -734,6 +800,111 @@ TEST_P(TCComputeSourceTestFixture, ShouldComputeCorrectSource) {
     DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::utilities::PetscUtilities::checkError;
 }
 
+/**
+ * Computes the source for several nearly identical cells, calling ComputeSource numberSteps times so that a tabulating eos can retrieve the result
+ */
+static std::vector<std::vector<PetscReal>> ComputeSourceForNearlyIdenticalCells(const std::shared_ptr<ablate::eos::TChem>& eos, const TCComputeSourceTestParameters& params, PetscInt numberCells,
+                                                                                 int numberSteps) {
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("oneD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{numberCells},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // perturb the energy in each cell so that each cell has a slightly different temperature
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::utilities::PetscUtilities::checkError;
+    ablate::domain::DynamicRange range;
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscScalar* eulerField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("euler").id, solution, &eulerField) >> ablate::utilities::PetscUtilities::checkError;
+        for (std::size_t i = 0; i < params.inputEulerValues.size(); i++) {
+            eulerField[i] = params.inputEulerValues[i];
+        }
+        eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] *= (1.0 + 1.0E-7 * c);
+
+        PetscScalar* densityYiField = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::utilities::PetscUtilities::checkError;
+        for (std::size_t i = 0; i < params.inputDensityYiValues.size(); i++) {
+            densityYiField[i] = params.inputDensityYiValues[i];
+        }
+        range.Add(c);
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::utilities::PetscUtilities::checkError;
+
+    Vec computedF;
+    DMGetLocalVector(domain->GetDM(), &computedF) >> ablate::utilities::PetscUtilities::checkError;
+    VecZeroEntries(computedF) >> ablate::utilities::PetscUtilities::checkError;
+
+    auto sourceTermCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    for (int step = 0; step < numberSteps; ++step) {
+        sourceTermCalculator->ComputeSource(range.GetRange(), 0.0, params.dt, domain->GetSolutionVector());
+    }
+    sourceTermCalculator->AddSource(range.GetRange(), domain->GetSolutionVector(), computedF);
+
+    // copy the euler and densityYi source for each cell
+    std::vector<std::vector<PetscReal>> sources;
+    PetscScalar* sourceArray;
+    VecGetArray(computedF, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscScalar* eulerSource = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("euler").id, sourceArray, &eulerSource) >> ablate::utilities::PetscUtilities::checkError;
+        PetscScalar* densityYiSource = nullptr;
+        DMPlexPointLocalFieldRef(domain->GetDM(), c, domain->GetField("densityYi").id, sourceArray, &densityYiSource) >> ablate::utilities::PetscUtilities::checkError;
+
+        std::vector<PetscReal> cellSource(eulerSource, eulerSource + params.inputEulerValues.size());
+        cellSource.insert(cellSource.end(), densityYiSource, densityYiSource + params.inputDensityYiValues.size());
+        sources.push_back(cellSource);
+    }
+    VecRestoreArray(computedF, &sourceArray) >> ablate::utilities::PetscUtilities::checkError;
+    DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::utilities::PetscUtilities::checkError;
+    return sources;
+}
+
+TEST_P(TCComputeSourceTestFixture, ShouldComputeTabulatedSourceMatchingDirectIntegration) {
+    // ARRANGE
+    const auto& params = GetParam();
+    const PetscInt numberCells = 4;
+    auto directEos = std::make_shared<ablate::eos::TChem>(params.mechFile);
+    auto tabulatedEos = std::make_shared<ablate::eos::TChem>(params.mechFile, nullptr, ablate::parameters::MapParameters::Create({{"isatTolerance", "1E-4"}, {"isatRadius", "1E-3"}}));
+
+    // ACT
+    auto expectedSources = ComputeSourceForNearlyIdenticalCells(directEos, params, numberCells, 1);
+    // the first step fills the table and the second step retrieves every cell from it
+    auto tabulatedSources = ComputeSourceForNearlyIdenticalCells(tabulatedEos, params, numberCells, 2);
+
+    // ASSERT, the table tolerance bounds the error in the integrated state so compare the norm of the source in each cell
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        PetscReal differenceNorm = 0.0;
+        PetscReal expectedNorm = 0.0;
+        for (std::size_t i = 0; i < expectedSources[c].size(); i++) {
+            differenceNorm += PetscSqr(expectedSources[c][i] - tabulatedSources[c][i]);
+            expectedNorm += PetscSqr(expectedSources[c][i]);
+        }
+        ASSERT_LT(PetscSqrtReal(differenceNorm), 1E-2 * PetscSqrtReal(expectedNorm) + 1E-10) << "The tabulated source for cell " << c << " should match the directly integrated source";
+    }
+}
+
+TEST_P(TCComputeSourceTestFixture, ShouldRejectLoadBalancingWithTabulation) {
+    // ARRANGE
+    const auto& params = GetParam();
+    auto eos = std::make_shared<ablate::eos::TChem>(params.mechFile, nullptr, ablate::parameters::MapParameters::Create({{"isatTolerance", "1E-4"}, {"loadBalanceTolerance", "1.1"}}));
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("zeroD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{1},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+    ablate::domain::DynamicRange range;
+    range.Add(0);
+
+    // ACT/ASSERT
+    ASSERT_THROW(eos->CreateSourceCalculator(domain->GetFields(), range.GetRange()), std::invalid_argument);
+}
+
 INSTANTIATE_TEST_SUITE_P(TChemTests, TCComputeSourceTestFixture,
                          testing::Values((TCComputeSourceTestParameters){
                              .mechFile = "inputs/eos/gri30.yaml",
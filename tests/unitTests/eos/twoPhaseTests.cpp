@@ -1,3 +1,4 @@
+#include <map>
 #include "PetscTestFixture.hpp"
 #include "domain/mockField.hpp"
 #include "eos/perfectGas.hpp"
@@ -88,6 +89,20 @@ TEST_P(TPThermodynamicPropertyTestFixture, ShouldComputeProperty) {
     for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
         ASSERT_NEAR(computedProperty[c], params.expectedValue[c], 1E-6) << "for direct function ";
     }
+
+    // act/assert check that the decode state function produces the same value
+    auto decodeStateFunction = std::dynamic_pointer_cast<ablate::eos::TwoPhase>(twoPhaseEos)->GetDecodeStateFunction(params.fields);
+    ablate::eos::TwoPhase::DecodedState decodedState{};
+    ierr = decodeStateFunction.function(params.conservedValues.data(), &decodedState, decodeStateFunction.context.get());
+    ASSERT_EQ(ierr, 0);
+    std::map<ablate::eos::ThermodynamicProperty, PetscReal> decodedProperties = {{ablate::eos::ThermodynamicProperty::Density, decodedState.density},
+                                                                                  {ablate::eos::ThermodynamicProperty::Pressure, decodedState.p},
+                                                                                  {ablate::eos::ThermodynamicProperty::Temperature, decodedState.T},
+                                                                                  {ablate::eos::ThermodynamicProperty::InternalSensibleEnergy, decodedState.internalEnergy},
+                                                                                  {ablate::eos::ThermodynamicProperty::SpeedOfSound, decodedState.speedOfSound}};
+    if (decodedProperties.count(params.thermodynamicProperty)) {
+        ASSERT_NEAR(decodedProperties[params.thermodynamicProperty], params.expectedValue[0], 1E-6) << "for decode state function ";
+    }
     // act/assert check for compute when temperature is known
     auto temperatureFunction = twoPhaseEos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, params.fields);
     PetscReal computedTemperature;
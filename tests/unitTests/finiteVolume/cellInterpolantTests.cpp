@@ -0,0 +1,127 @@
+#include <petsc.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "MpiTestFixture.hpp"
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "environment/runEnvironment.hpp"
+#include "finiteVolume/finiteVolumeSolver.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "utilities/petscUtilities.hpp"
+
+namespace ablateTesting::finiteVolume {
+
+class CellInterpolantTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+
+   protected:
+    /**
+     * Upwind a constant velocity so the flux depends on the face values reconstructed from the cell gradients
+     */
+    static PetscErrorCode AdvectionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[], const PetscInt aOff[],
+                                        const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar flux[], void* ctx) {
+        PetscFunctionBeginUser;
+        const PetscReal velocity[3] = {1.0, 0.5, 0.25};
+        PetscReal normalVelocity = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            normalVelocity += velocity[d] * fg->normal[d];
+        }
+        flux[0] = normalVelocity * (normalVelocity > 0 ? fieldL[uOff[0]] : fieldR[uOff[0]]);
+        PetscFunctionReturn(0);
+    }
+
+    /**
+     * Create a distributed mesh and finite volume solver, then return the local rhs computed by the cell interpolant
+     */
+    std::vector<PetscScalar> ComputeLocalRHS(bool overlapGradientCommunication) {
+        // use a least squares reconstruction so the flux needs the cell gradients on both sides of each face
+        auto fieldOptions = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"petscfv_type", "leastsquares"}, {"petscfv_compute_gradients", "true"}});
+        auto mesh = std::make_shared<ablate::domain::BoxMesh>(
+            "test",
+            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::domain::FieldDescription>(
+                "fieldA", "", ablate::domain::FieldDescription::ONECOMPONENT, ablate::domain::FieldLocation::SOL, ablate::domain::FieldType::FVM, nullptr, fieldOptions)},
+            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{std::make_shared<ablate::domain::modifiers::DistributeWithGhostCells>(),
+                                                                              std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>()},
+            std::vector<int>{10, 10},
+            std::vector<double>{0.0, 0.0},
+            std::vector<double>{1.0, 1.0},
+            std::vector<std::string>{"NONE", "NONE"} /*boundary*/,
+            false /*simplex*/);
+
+        auto solverOptions =
+            std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"overlapGradientCommunication", overlapGradientCommunication ? "true" : "false"}});
+        auto fvSolver = std::make_shared<ablate::finiteVolume::FiniteVolumeSolver>("testSolver",
+                                                                                   ablate::domain::Region::ENTIREDOMAIN,
+                                                                                   solverOptions,
+                                                                                   std::vector<std::shared_ptr<ablate::finiteVolume::processes::Process>>{},
+                                                                                   std::vector<std::shared_ptr<ablate::finiteVolume::boundaryConditions::BoundaryCondition>>{});
+        mesh->InitializeSubDomains({fvSolver}, {});
+        fvSolver->RegisterRHSFunction(AdvectionFlux, nullptr, "fieldA", {"fieldA"}, {});
+
+        // set a non uniform solution so the gradients are not zero
+        mesh->ProjectFieldFunctions({std::make_shared<ablate::mathFunctions::FieldFunction>("fieldA", ablate::mathFunctions::Create("x*x + sin(3*y) + x*y"))}, mesh->GetSolutionVector());
+
+        Vec locX, locF;
+        DMGetLocalVector(mesh->GetDM(), &locX) >> testErrorChecker;
+        DMGlobalToLocal(mesh->GetDM(), mesh->GetSolutionVector(), INSERT_VALUES, locX) >> testErrorChecker;
+        DMGetLocalVector(mesh->GetDM(), &locF) >> testErrorChecker;
+        VecZeroEntries(locF) >> testErrorChecker;
+
+        fvSolver->ComputeRHSFunction(0.0, locX, locF) >> testErrorChecker;
+
+        PetscInt size;
+        const PetscScalar* locFArray;
+        VecGetLocalSize(locF, &size) >> testErrorChecker;
+        VecGetArrayRead(locF, &locFArray) >> testErrorChecker;
+        std::vector<PetscScalar> rhs(locFArray, locFArray + size);
+        VecRestoreArrayRead(locF, &locFArray) >> testErrorChecker;
+
+        DMRestoreLocalVector(mesh->GetDM(), &locX) >> testErrorChecker;
+        DMRestoreLocalVector(mesh->GetDM(), &locF) >> testErrorChecker;
+        return rhs;
+    }
+};
+
+TEST_P(CellInterpolantTestFixture, ShouldComputeTheSameRHSWithOverlappedGradientCommunication) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // act
+            // both meshes are distributed the same way, so the local rhs arrays have the same layout
+            auto overlappedRHS = ComputeLocalRHS(true);
+            auto referenceRHS = ComputeLocalRHS(false);
+
+            // assert
+            ASSERT_EQ(overlappedRHS.size(), referenceRHS.size());
+            PetscReal localMaxDifference = 0.0;
+            PetscReal localNorm = 0.0;
+            for (std::size_t i = 0; i < referenceRHS.size(); ++i) {
+                localMaxDifference = PetscMax(localMaxDifference, PetscAbsScalar(overlappedRHS[i] - referenceRHS[i]));
+                localNorm += PetscSqr(PetscAbsScalar(referenceRHS[i]));
+            }
+
+            PetscReal maxDifference, norm;
+            MPI_Allreduce(&localMaxDifference, &maxDifference, 1, MPIU_REAL, MPI_MAX, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&localNorm, &norm, 1, MPIU_REAL, MPI_SUM, PETSC_COMM_WORLD) >> testErrorChecker;
+
+            ASSERT_GT(norm, 0.0) << "The reference rhs should not be zero";
+            // only the order the face fluxes are added to each cell changes, so allow for round off
+            ASSERT_LT(maxDifference, 1E-10) << "The overlapped rhs should match the rhs computed after the gradient communication is complete";
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(CellInterpolantTests, CellInterpolantTestFixture, testing::Values(testingResources::MpiTestParameter("overlapped gradient communication 2 proc", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
+
+}  // namespace ablateTesting::finiteVolume
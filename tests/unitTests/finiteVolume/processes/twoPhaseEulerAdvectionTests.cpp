@@ -1,5 +1,6 @@
 #include <petsc.h>
 #include <PetscTestFixture.hpp>
+#include <array>
 #include <cmath>
 #include <memory>
 #include <vector>
@@ -307,3 +308,121 @@ INSTANTIATE_TEST_SUITE_P(
                                                           .expectedPressure = 100000.0,
                                                           .expectedAlpha = 0.0}),
     [](const testing::TestParamInfo<TwoPhaseEulerAdvectionTestDecodeStateParameters>& info) { return std::to_string(info.index); });
+
+class TwoPhaseEulerAdvectionDecoderOrderTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(TwoPhaseEulerAdvectionDecoderOrderTestFixture, ShouldDecodeStiffenedGasStatesIndependentOfOrder) {
+    // arrange
+    auto eosGas = std::make_shared<eos::StiffenedGas>(
+        std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "2.31015"}, {"Cp", "4643.4015"}, {"p0", "6.0695E8"}}));
+    auto eosLiquid =
+        std::make_shared<eos::StiffenedGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.932"}, {"Cp", "8095.08"}, {"p0", "1.1645E9"}}));
+    const PetscInt dim = 3;
+    PetscInt uOff[3] = {3 + dim /*alpha*/, 2 + dim /*rho1alpha1*/, 0 /*euler*/};
+    const std::vector<PetscReal> normal = {0.5, 0.5, 0.7071};
+
+    // the conserved states (RHO, RHOE, RHOU, RHOV, RHOW, RHOALPHA) and the densityG, densityL, pressure computed by the previous SNES based decoder
+    const std::vector<std::vector<PetscReal>> conservedValues = {{847.3900023809954, 1541208988.157894, 8473.900023809954, -16947.80004761991, 25421.700071429863, 499.45858996434845},
+                                                                 {768.3978307143822, 1070293891.9207724, 0.0, 0.0, 0.0, 768.3978307143822},
+                                                                 {994.0897497618486, 2414070815.450644, 0.0, 0.0, 0.0, 0.0}};
+    const std::vector<std::array<PetscReal, 3>> expectedValues = {
+        {768.3978307143823, 994.0897497618482, 100000.0}, {768.3978307143822, 994.0897497618488, 100000.0}, {768.3978307143825, 994.0897497618486, 100000.0}};
+
+    auto decode = [&](const auto& decoder, std::size_t s) {
+        PetscReal density, densityG, densityL, normalVelocity, internalEnergy, internalEnergyG, internalEnergyL, soundSpeedG, soundSpeedL, MG, ML, pressure, temperature, alpha;
+        std::vector<PetscReal> velocity(3);
+        decoder->DecodeTwoPhaseEulerState(dim,
+                                          uOff,
+                                          conservedValues[s].data(),
+                                          normal.data(),
+                                          &density,
+                                          &densityG,
+                                          &densityL,
+                                          &normalVelocity,
+                                          velocity.data(),
+                                          &internalEnergy,
+                                          &internalEnergyG,
+                                          &internalEnergyL,
+                                          &soundSpeedG,
+                                          &soundSpeedL,
+                                          &MG,
+                                          &ML,
+                                          &pressure,
+                                          &temperature,
+                                          &alpha);
+        return std::array<PetscReal, 3>{densityG, densityL, pressure};
+    };
+
+    // act
+    // decode the states forward and backward with the same decoders
+    auto forwardDecoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(dim, eosGas, eosLiquid);
+    auto backwardDecoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(dim, eosGas, eosLiquid);
+    std::vector<std::array<PetscReal, 3>> forwardValues(conservedValues.size());
+    std::vector<std::array<PetscReal, 3>> backwardValues(conservedValues.size());
+    for (std::size_t s = 0; s < conservedValues.size(); ++s) {
+        forwardValues[s] = decode(forwardDecoder, s);
+    }
+    for (std::size_t s = conservedValues.size(); s-- > 0;) {
+        backwardValues[s] = decode(backwardDecoder, s);
+    }
+
+    // assert
+    for (std::size_t s = 0; s < conservedValues.size(); ++s) {
+        for (std::size_t v = 0; v < 3; ++v) {
+            ASSERT_DOUBLE_EQ(forwardValues[s][v], backwardValues[s][v]) << "The decoded state " << s << " should not depend on the decode order";
+        }
+        ASSERT_NEAR(expectedValues[s][0], forwardValues[s][0], 1E-6) << "densityG for state " << s;
+        ASSERT_NEAR(expectedValues[s][1], forwardValues[s][1], 1E-6) << "densityL for state " << s;
+        ASSERT_NEAR(expectedValues[s][2], forwardValues[s][2], 1E-2) << "pressure for state " << s;
+    }
+}
+
+TEST_F(TwoPhaseEulerAdvectionDecoderOrderTestFixture, ShouldReportUnconvergedStiffenedGasDecodes) {
+    // arrange
+    auto eosGas = std::make_shared<eos::StiffenedGas>(
+        std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "2.31015"}, {"Cp", "4643.4015"}, {"p0", "6.0695E8"}}));
+    auto eosLiquid =
+        std::make_shared<eos::StiffenedGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.932"}, {"Cp", "8095.08"}, {"p0", "1.1645E9"}}));
+    const PetscInt dim = 3;
+    PetscInt uOff[3] = {3 + dim /*alpha*/, 2 + dim /*rho1alpha1*/, 0 /*euler*/};
+    const std::vector<PetscReal> normal = {0.5, 0.5, 0.7071};
+
+    // the first state has a physical equilibrium, there is no equilibrium with positive phase energies for the negative total energy in the second state
+    const std::vector<std::vector<PetscReal>> conservedValues = {{847.3900023809954, 1541208988.157894, 8473.900023809954, -16947.80004761991, 25421.700071429863, 499.45858996434845},
+                                                                 {847.3900023809954, -1541208988.157894, 0.0, 0.0, 0.0, 499.45858996434845}};
+    auto decoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(dim, eosGas, eosLiquid);
+
+    auto decode = [&](std::size_t s) {
+        PetscReal density, densityG, densityL, normalVelocity, internalEnergy, internalEnergyG, internalEnergyL, soundSpeedG, soundSpeedL, MG, ML, pressure, temperature, alpha;
+        std::vector<PetscReal> velocity(3);
+        decoder->DecodeTwoPhaseEulerState(dim,
+                                          uOff,
+                                          conservedValues[s].data(),
+                                          normal.data(),
+                                          &density,
+                                          &densityG,
+                                          &densityL,
+                                          &normalVelocity,
+                                          velocity.data(),
+                                          &internalEnergy,
+                                          &internalEnergyG,
+                                          &internalEnergyL,
+                                          &soundSpeedG,
+                                          &soundSpeedL,
+                                          &MG,
+                                          &ML,
+                                          &pressure,
+                                          &temperature,
+                                          &alpha);
+    };
+
+    // act
+    decode(0);
+    auto convergedCount = decoder->GetNumberUnconvergedDecodes();
+    decode(1);
+    auto unconvergedCount = decoder->GetNumberUnconvergedDecodes();
+
+    // assert
+    ASSERT_EQ(0, convergedCount) << "The physical state should converge";
+    ASSERT_EQ(1, unconvergedCount) << "The state without an equilibrium should be reported as unconverged";
+}
@@ -0,0 +1,125 @@
+#include <petsc.h>
+#include <yaml-cpp/yaml.h>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "PetscTestFixture.hpp"
+#include "domain/boxMesh.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "gtest/gtest.h"
+#include "io/hdf5MultiFileSerializer.hpp"
+#include "io/interval/fixedInterval.hpp"
+#include "parameters/mapParameters.hpp"
+#include "testRunEnvironment.hpp"
+#include "utilities/petscUtilities.hpp"
+
+class Hdf5MultiFileSerializerTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    std::filesystem::path outputDirectory;
+    std::filesystem::path stagingDirectory;
+
+    void SetUp() override {
+        PetscTestFixture::SetUp();
+        auto directory = std::filesystem::temp_directory_path() / ("hdf5MultiFileSerializerTest_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(directory);
+        outputDirectory = directory / "output";
+        stagingDirectory = directory / "staging";
+    }
+
+    /**
+     * Creates a simple domain with a single serializable sub domain
+     */
+    static std::shared_ptr<ablate::domain::BoxMesh> CreateDomain() {
+        auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+        auto domain = std::make_shared<ablate::domain::BoxMesh>("domain",
+                                                                std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                                std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                std::vector<int>{3, 3},
+                                                                std::vector<double>{0.0, 0.0},
+                                                                std::vector<double>{1.0, 1.0});
+        domain->InitializeSubDomains();
+        VecSet(domain->GetSolutionVector(), 1.0) >> ablate::utilities::PetscUtilities::checkError;
+        return domain;
+    }
+
+    static std::filesystem::path GetOutputFile(const std::filesystem::path& directory, const std::string& id, PetscInt sequenceNumber) {
+        std::stringstream fileName;
+        fileName << id << "." << std::setw(5) << std::setfill('0') << sequenceNumber << ".hdf5";
+        return directory / id / fileName.str();
+    }
+};
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldMoveStagedOutputBeforeUpdatingTheRestartFile) {
+    // arrange
+    testingResources::TestRunEnvironment testRunEnvironment(outputDirectory.string());
+    auto domain = CreateDomain();
+    auto subDomain = domain->GetSerializableSubDomains().front();
+    const auto id = subDomain.lock()->GetId();
+
+    auto serializer = std::make_shared<ablate::io::Hdf5MultiFileSerializer>(std::make_shared<ablate::io::interval::FixedInterval>(), nullptr, stagingDirectory.string());
+    serializer->Register(subDomain);
+
+    TS ts;
+    TSCreate(PETSC_COMM_WORLD, &ts) >> errorChecker;
+    auto saveFunction = serializer->GetSerializeFunction();
+
+    // act
+    saveFunction(ts, 1, 0.1, nullptr, serializer->GetContext()) >> errorChecker;
+    saveFunction(ts, 2, 0.2, nullptr, serializer->GetContext()) >> errorChecker;
+    serializer.reset();
+
+    // assert
+    auto restart = YAML::LoadFile(outputDirectory / "restart.rst");
+    ASSERT_EQ(restart["timeStep"].as<PetscInt>(), 2);
+    ASSERT_EQ(restart["sequenceNumber"].as<PetscInt>(), 1);
+    for (PetscInt s = 0; s < 2; ++s) {
+        ASSERT_TRUE(std::filesystem::exists(GetOutputFile(outputDirectory, id, s))) << "The output " << s << " should be moved to the output directory";
+        ASSERT_FALSE(std::filesystem::exists(GetOutputFile(stagingDirectory, id, s))) << "The staged output " << s << " should be removed";
+    }
+    for (const auto& file : std::filesystem::directory_iterator(outputDirectory / id)) {
+        ASSERT_NE(file.path().extension(), ".staging") << "No temporary files should be left in the output directory";
+    }
+    ASSERT_TRUE(std::filesystem::exists(outputDirectory / id / (id + ".xmf")));
+
+    TSDestroy(&ts) >> errorChecker;
+}
+
+TEST_F(Hdf5MultiFileSerializerTestFixture, ShouldKeepTheRestartFileWhenTheStagedMoveFails) {
+    // arrange
+    testingResources::TestRunEnvironment testRunEnvironment(outputDirectory.string());
+    auto domain = CreateDomain();
+    auto subDomain = domain->GetSerializableSubDomains().front();
+    const auto id = subDomain.lock()->GetId();
+
+    auto serializer = std::make_shared<ablate::io::Hdf5MultiFileSerializer>(std::make_shared<ablate::io::interval::FixedInterval>(), nullptr, stagingDirectory.string());
+    serializer->Register(subDomain);
+
+    // block the temporary file used to move the second output, the restart file must only be updated once an output is in the output directory
+    auto blockedPath = GetOutputFile(outputDirectory, id, 1);
+    blockedPath += ".staging";
+    std::filesystem::create_directories(blockedPath);
+    std::ofstream(blockedPath / "blocker") << "blocker";
+
+    TS ts;
+    TSCreate(PETSC_COMM_WORLD, &ts) >> errorChecker;
+    auto saveFunction = serializer->GetSerializeFunction();
+
+    // act
+    saveFunction(ts, 1, 0.1, nullptr, serializer->GetContext()) >> errorChecker;
+    saveFunction(ts, 2, 0.2, nullptr, serializer->GetContext()) >> errorChecker;
+    ASSERT_NO_THROW(serializer.reset()) << "The destructor should report the failed move instead of throwing";
+
+    // assert
+    auto restart = YAML::LoadFile(outputDirectory / "restart.rst");
+    ASSERT_EQ(restart["timeStep"].as<PetscInt>(), 1) << "The restart file should not be updated for an output that was not moved";
+    ASSERT_EQ(restart["sequenceNumber"].as<PetscInt>(), 0);
+    ASSERT_TRUE(std::filesystem::exists(GetOutputFile(outputDirectory, id, 0)));
+    ASSERT_FALSE(std::filesystem::exists(GetOutputFile(outputDirectory, id, 1)));
+    ASSERT_TRUE(std::filesystem::exists(GetOutputFile(stagingDirectory, id, 1))) << "The staged output should be kept when it could not be moved";
+
+    TSDestroy(&ts) >> errorChecker;
+}
@@ -0,0 +1,194 @@
+#include <petsc.h>
+#include <petscviewerhdf5.h>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "domain/boxMesh.hpp"
+#include "eos/perfectGas.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "generators.hpp"
+#include "gtest/gtest.h"
+#include "io/hdf5VisualizationSerializer.hpp"
+#include "parameters/mapParameters.hpp"
+
+class Hdf5VisualizationSerializerTestFixture : public testingResources::PetscTestFixture {};
+
+/**
+ * Write a double precision dataset with the supplied dimensions
+ */
+static void WriteDataset(hid_t location, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<double>& values) {
+    hid_t space = H5Screate_simple((int)dims.size(), dims.data(), nullptr);
+    hid_t dataset = H5Dcreate2(location, name.c_str(), H5T_IEEE_F64LE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+    H5Dclose(dataset);
+    H5Sclose(space);
+}
+
+/**
+ * Returns the size in bytes of the stored dataset type
+ */
+static std::size_t GetDatasetTypeSize(hid_t file, const std::string& name) {
+    hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+    hid_t type = H5Dget_type(dataset);
+    auto size = H5Tget_size(type);
+    H5Tclose(type);
+    H5Dclose(dataset);
+    return size;
+}
+
+/**
+ * Returns the ids of the filters applied to the dataset
+ */
+static std::vector<H5Z_filter_t> GetDatasetFilters(hid_t file, const std::string& name) {
+    hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+    hid_t createProperties = H5Dget_create_plist(dataset);
+    std::vector<H5Z_filter_t> filters;
+    for (int f = 0; f < H5Pget_nfilters(createProperties); ++f) {
+        unsigned int flags;
+        size_t numberElements = 0;
+        unsigned int filterConfig;
+        filters.push_back(H5Pget_filter2(createProperties, (unsigned)f, &flags, &numberElements, nullptr, 0, nullptr, &filterConfig));
+    }
+    H5Pclose(createProperties);
+    H5Dclose(dataset);
+    return filters;
+}
+
+/**
+ * Reads the dataset as doubles
+ */
+static std::vector<double> ReadDataset(hid_t file, const std::string& name, std::size_t size) {
+    std::vector<double> values(size);
+    hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+    H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+    H5Dclose(dataset);
+    return values;
+}
+
+TEST_F(Hdf5VisualizationSerializerTestFixture, ShouldCompressFieldDatasets) {
+    // arrange
+    auto filePath = std::filesystem::temp_directory_path() / "hdf5VisualizationSerializerCompressTest.hdf5";
+    const std::vector<hsize_t> fieldDims = {3, 40, 4};
+    const std::vector<hsize_t> vertexDims = {40, 2};
+    std::vector<double> fieldValues(3 * 40 * 4);
+    for (std::size_t i = 0; i < fieldValues.size(); ++i) {
+        fieldValues[i] = 1.0 + std::sin(0.1234567890123 * (double)i) * 1.0E3;
+    }
+    std::vector<double> vertexValues(40 * 2);
+    for (std::size_t i = 0; i < vertexValues.size(); ++i) {
+        vertexValues[i] = 0.1234567890123 * (double)i;
+    }
+
+    {
+        hid_t file = H5Fcreate(filePath.string().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        hid_t geometry = H5Gcreate2(file, "geometry", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        WriteDataset(geometry, "vertices", vertexDims, vertexValues);
+        H5Gclose(geometry);
+
+        hid_t fields = H5Gcreate2(file, "fields", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        WriteDataset(fields, "solution_euler", fieldDims, fieldValues);
+        WriteDataset(fields, "solution_densityYi", fieldDims, fieldValues);
+
+        // add a variable length string attribute like the ones written by petsc
+        hid_t stringType = H5Tcopy(H5T_C_S1);
+        H5Tset_size(stringType, H5T_VARIABLE);
+        hid_t scalarSpace = H5Screate(H5S_SCALAR);
+        hid_t attribute = H5Acreate2(fields, "units", stringType, scalarSpace, H5P_DEFAULT, H5P_DEFAULT);
+        const char* units = "kg/m^3";
+        H5Awrite(attribute, stringType, &units);
+        H5Aclose(attribute);
+        H5Sclose(scalarSpace);
+        H5Tclose(stringType);
+        H5Gclose(fields);
+        H5Fclose(file);
+    }
+
+    ablate::io::Hdf5VisualizationSerializer serializer(nullptr, nullptr, {"euler"}, 4, 0);
+
+    // act
+    serializer.CompressFile(filePath);
+
+    // assert
+    hid_t file = H5Fopen(filePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(file, 0);
+
+    // the double precision field and mesh are kept exactly
+    ASSERT_EQ(GetDatasetTypeSize(file, "/fields/solution_euler"), sizeof(double));
+    ASSERT_EQ(GetDatasetTypeSize(file, "/geometry/vertices"), sizeof(double));
+    ASSERT_EQ(ReadDataset(file, "/fields/solution_euler", fieldValues.size()), fieldValues);
+    ASSERT_EQ(ReadDataset(file, "/geometry/vertices", vertexValues.size()), vertexValues);
+
+    // the other fields are written in single precision
+    ASSERT_EQ(GetDatasetTypeSize(file, "/fields/solution_densityYi"), sizeof(float));
+    auto compressedValues = ReadDataset(file, "/fields/solution_densityYi", fieldValues.size());
+    for (std::size_t i = 0; i < fieldValues.size(); ++i) {
+        ASSERT_NEAR(compressedValues[i], fieldValues[i], std::abs(fieldValues[i]) * 1E-6) << "at index " << i;
+    }
+
+    // only the field datasets are compressed
+    const std::vector<H5Z_filter_t> expectedFilters = {H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE};
+    ASSERT_EQ(GetDatasetFilters(file, "/fields/solution_euler"), expectedFilters);
+    ASSERT_EQ(GetDatasetFilters(file, "/fields/solution_densityYi"), expectedFilters);
+    ASSERT_TRUE(GetDatasetFilters(file, "/geometry/vertices").empty());
+
+    // the variable length attribute is preserved
+    hid_t attribute = H5Aopen_by_name(file, "/fields", "units", H5P_DEFAULT, H5P_DEFAULT);
+    ASSERT_GE(attribute, 0);
+    hid_t stringType = H5Aget_type(attribute);
+    ASSERT_GT(H5Tis_variable_str(stringType), 0);
+    char* units = nullptr;
+    H5Aread(attribute, stringType, &units);
+    ASSERT_STREQ(units, "kg/m^3");
+    H5free_memory(units);
+    H5Tclose(stringType);
+    H5Aclose(attribute);
+    H5Fclose(file);
+
+    std::filesystem::remove(filePath);
+}
+
+TEST_F(Hdf5VisualizationSerializerTestFixture, ShouldGenerateXdmfForCompressedDomainFile) {
+    // arrange
+    auto directory = std::filesystem::temp_directory_path() / "hdf5VisualizationSerializerXdmfTest";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    auto filePath = directory / "domain.00000000.hdf5";
+    auto xdmfPath = directory / "domain.xmf";
+
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("domain",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{3, 3},
+                                                            std::vector<double>{0.0, 0.0},
+                                                            std::vector<double>{1.0, 1.0});
+    domain->InitializeSubDomains();
+    VecSet(domain->GetSolutionVector(), 1.0) >> errorChecker;
+    auto subDomain = domain->GetSerializableSubDomains().front().lock();
+    ASSERT_TRUE(subDomain);
+
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &viewer) >> errorChecker;
+    subDomain->Save(viewer, 0, 0.0) >> errorChecker;
+    PetscViewerDestroy(&viewer) >> errorChecker;
+
+    ablate::io::Hdf5VisualizationSerializer serializer(nullptr, nullptr, {}, 1, 3);
+
+    // act
+    serializer.CompressFile(filePath);
+    xdmfGenerator::Generate(std::vector<std::filesystem::path>{filePath}, xdmfPath);
+
+    // assert
+    hid_t file = H5Fopen(filePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(file, 0);
+    ASSERT_EQ(GetDatasetTypeSize(file, "/geometry/vertices"), sizeof(double));
+    H5Fclose(file);
+
+    ASSERT_TRUE(std::filesystem::exists(xdmfPath));
+    ASSERT_GT(std::filesystem::file_size(xdmfPath), 0u);
+
+    std::filesystem::remove_all(directory);
+}
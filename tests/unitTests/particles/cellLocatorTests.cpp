@@ -0,0 +1,114 @@
+#include <petsc.h>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "gtest/gtest.h"
+#include "particles/cellLocator.hpp"
+
+namespace ablateTesting::particles {
+
+struct CellLocatorTestParameters {
+    PetscBool simplex;
+    std::vector<PetscReal> coordinates;
+    std::vector<PetscInt> cellGuess;
+};
+
+class CellLocatorTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<CellLocatorTestParameters> {};
+
+TEST_P(CellLocatorTestFixture, ShouldLocateTheSameCellsAsDMLocatePoints) {
+    // arrange
+    const auto& params = GetParam();
+    DM dm;
+    PetscInt faces[] = {5, 4};
+    PetscReal lower[] = {0.0, 0.0};
+    PetscReal upper[] = {1.0, 2.0};
+    DMBoundaryType bcType[] = {DM_BOUNDARY_NONE, DM_BOUNDARY_NONE};
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, params.simplex, faces, lower, upper, bcType, PETSC_TRUE, &dm) >> errorChecker;
+
+    // compute the expected cells with a search
+    const auto np = (PetscInt)params.cellGuess.size();
+    Vec locVec;
+    VecCreateSeq(PETSC_COMM_SELF, np * 2, &locVec) >> errorChecker;
+    VecSetBlockSize(locVec, 2) >> errorChecker;
+    PetscScalar* locArray;
+    VecGetArray(locVec, &locArray) >> errorChecker;
+    PetscArraycpy(locArray, params.coordinates.data(), np * 2) >> errorChecker;
+    VecRestoreArray(locVec, &locArray) >> errorChecker;
+    PetscSF cellSF = nullptr;
+    DMLocatePoints(dm, locVec, DM_POINTLOCATION_NONE, &cellSF) >> errorChecker;
+    const PetscSFNode* expectedCells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &expectedCells) >> errorChecker;
+
+    // act
+    std::vector<PetscInt> cells = params.cellGuess;
+    {
+        ablate::particles::CellLocator cellLocator;
+        cellLocator.Locate(dm, np, params.coordinates.data(), cells.data());
+    }
+
+    // assert
+    for (PetscInt p = 0; p < np; ++p) {
+        ASSERT_EQ(cells[p], expectedCells[p].index >= 0 ? expectedCells[p].index : -1) << "for point " << p;
+    }
+
+    // cleanup
+    PetscSFDestroy(&cellSF) >> errorChecker;
+    VecDestroy(&locVec) >> errorChecker;
+    DMDestroy(&dm) >> errorChecker;
+}
+
+TEST_P(CellLocatorTestFixture, ShouldRebuildTheGeometryWhenTheDmChanges) {
+    // arrange
+    const auto& params = GetParam();
+    PetscInt faces[] = {5, 4};
+    PetscReal lower[] = {0.0, 0.0};
+    PetscReal upper[] = {1.0, 2.0};
+    PetscReal shiftedUpper[] = {2.0, 2.0};
+    DMBoundaryType bcType[] = {DM_BOUNDARY_NONE, DM_BOUNDARY_NONE};
+    DM dm, shiftedDm;
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, params.simplex, faces, lower, upper, bcType, PETSC_TRUE, &dm) >> errorChecker;
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, params.simplex, faces, lower, shiftedUpper, bcType, PETSC_TRUE, &shiftedDm) >> errorChecker;
+
+    // compute the expected cells in the second dm with a search
+    const auto np = (PetscInt)params.cellGuess.size();
+    Vec locVec;
+    VecCreateSeq(PETSC_COMM_SELF, np * 2, &locVec) >> errorChecker;
+    VecSetBlockSize(locVec, 2) >> errorChecker;
+    PetscScalar* locArray;
+    VecGetArray(locVec, &locArray) >> errorChecker;
+    PetscArraycpy(locArray, params.coordinates.data(), np * 2) >> errorChecker;
+    VecRestoreArray(locVec, &locArray) >> errorChecker;
+    PetscSF cellSF = nullptr;
+    DMLocatePoints(shiftedDm, locVec, DM_POINTLOCATION_NONE, &cellSF) >> errorChecker;
+    const PetscSFNode* expectedCells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &expectedCells) >> errorChecker;
+
+    // act
+    // the same locator is used with both dms, so the geometry from the first dm must not be used for the second
+    std::vector<PetscInt> cells = params.cellGuess;
+    {
+        ablate::particles::CellLocator cellLocator;
+        cellLocator.Locate(dm, np, params.coordinates.data(), cells.data());
+        cellLocator.Locate(shiftedDm, np, params.coordinates.data(), cells.data());
+    }
+
+    // assert
+    for (PetscInt p = 0; p < np; ++p) {
+        ASSERT_EQ(cells[p], expectedCells[p].index >= 0 ? expectedCells[p].index : -1) << "for point " << p;
+    }
+
+    // cleanup
+    PetscSFDestroy(&cellSF) >> errorChecker;
+    VecDestroy(&locVec) >> errorChecker;
+    DMDestroy(&shiftedDm) >> errorChecker;
+    DMDestroy(&dm) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(CellLocatorTests, CellLocatorTestFixture,
+                         testing::Values((CellLocatorTestParameters){.simplex = PETSC_FALSE,
+                                                                     .coordinates = {0.1, 0.1, 0.9, 1.9, 0.5, 1.1, 0.33, 0.77, 0.05, 1.95, 1.5, 0.5},
+                                                                     .cellGuess = {0, 0, 19, -1, 7, 3}},
+                                         (CellLocatorTestParameters){.simplex = PETSC_TRUE,
+                                                                     .coordinates = {0.1, 0.1, 0.9, 1.9, 0.5, 1.1, 0.33, 0.77, 0.05, 1.95, 1.5, 0.5},
+                                                                     .cellGuess = {0, 0, 39, -1, 7, 3}}));
+
+}  // namespace ablateTesting::particles
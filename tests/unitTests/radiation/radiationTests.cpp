@@ -1,6 +1,9 @@
 #include <petsc.h>
+#include <petscviewerhdf5.h>
 #include <mathFunctions/functionFactory.hpp>
+#include <algorithm>
 #include <memory>
+#include <utility>
 #include "MpiTestFixture.hpp"
 #include "builder.hpp"
 #include "convergenceTester.hpp"
@@ -418,3 +421,237 @@ INSTANTIATE_TEST_SUITE_P(
                                           return std::make_shared<ablate::radiation::RaySharingRadiation>("radiationBase", interiorLabel, 20, radiationModelIn, nullptr);
                                       }}),
     [](const testing::TestParamInfo<RadiationTestParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
+
+/**
+ * Provides access to the traced ray data for the serialization tests
+ */
+class RayAccessRadiation : public ablate::radiation::Radiation {
+   public:
+    using ablate::radiation::Radiation::Radiation;
+
+    [[nodiscard]] bool RayDataReady() const { return rayDataReady; }
+    [[nodiscard]] const std::vector<PetscInt>& GetRaySegmentOffsets() const { return raySegmentOffsets; }
+    [[nodiscard]] const std::vector<PetscReal>& GetSegmentPathLengths() const { return segmentPathLengths; }
+    [[nodiscard]] const std::vector<PetscInt>& GetSegmentPropertyIndices() const { return segmentPropertyIndices; }
+    [[nodiscard]] const std::vector<PetscInt>& GetPropertyCells() const { return propertyCells; }
+    [[nodiscard]] PetscInt GetNumberOriginRays() const { return numberOriginRays; }
+};
+
+/**
+ * Holds everything needed to evaluate a radiation solver on a simple mesh
+ */
+struct RadiationSerializationSetup {
+    std::shared_ptr<ablate::domain::BoxMeshBoundaryCells> domain;
+    std::shared_ptr<ablate::solver::TimeStepper> timeStepper;
+    std::shared_ptr<RayAccessRadiation> radiation;
+    std::shared_ptr<ablate::radiation::VolumeRadiation> volumeRadiation;
+};
+
+static RadiationSerializationSetup CreateRadiationSerializationSetup(const std::vector<int>& meshFaces, bool marchLocally = true) {
+    RadiationSerializationSetup setup;
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+    std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {
+        std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos, std::make_shared<ablate::domain::Region>("domain"))};
+
+    setup.domain = std::make_shared<ablate::domain::BoxMeshBoundaryCells>("simpleMesh",
+                                                                          fieldDescriptors,
+                                                                          std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                          std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                          meshFaces,
+                                                                          std::vector<double>{-0.5, -0.0105},
+                                                                          std::vector<double>{0.5, 0.0105},
+                                                                          false,
+                                                                          ablate::parameters::MapParameters::Create({{"dm_plex_hash_location", "true"}}));
+
+    auto initialConditionEuler = std::make_shared<ablate::mathFunctions::FieldFunction>("euler", std::make_shared<ablate::mathFunctions::ConstantValue>(0.0));
+    setup.timeStepper = std::make_shared<ablate::solver::TimeStepper>(
+        "timeStepper", setup.domain, ablate::parameters::MapParameters::Create({{"ts_max_steps", 0}}), nullptr, std::make_shared<ablate::domain::Initializer>(initialConditionEuler));
+
+    auto interiorLabel = std::make_shared<ablate::domain::Region>("interiorCells");
+    setup.radiation = std::make_shared<RayAccessRadiation>("radiationBase", interiorLabel, 10, std::make_shared<ablate::eos::radiationProperties::Constant>(1.0, 1.0), nullptr, marchLocally);
+    setup.volumeRadiation = std::make_shared<ablate::radiation::VolumeRadiation>("radiation", nullptr, setup.radiation, nullptr, nullptr);
+    setup.timeStepper->Register(setup.volumeRadiation);
+    setup.timeStepper->Solve();
+
+    // set a known temperature field
+    auto auxVec = setup.volumeRadiation->GetSubDomain().GetAuxVector();
+    setup.volumeRadiation->GetSubDomain().ProjectFieldFunctionsToLocalVector(
+        {std::make_shared<ablate::mathFunctions::FieldFunction>(
+            ablate::finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD, ablate::mathFunctions::Create("1500.0 + 2.0E4*y"), nullptr, std::make_shared<ablate::domain::Region>("domain"))},
+        auxVec);
+    return setup;
+}
+
+/**
+ * Evaluates the radiation rhs, tracing the rays if they are not yet available
+ */
+static std::vector<PetscScalar> ComputeRadiationRhs(RadiationSerializationSetup& setup) {
+    Vec rhs;
+    DMGetLocalVector(setup.domain->GetDM(), &rhs) >> ablate::utilities::PetscUtilities::checkError;
+    VecZeroEntries(rhs) >> ablate::utilities::PetscUtilities::checkError;
+    setup.volumeRadiation->PreRHSFunction(setup.timeStepper->GetTS(), 0.0, true, nullptr) >> ablate::utilities::PetscUtilities::checkError;
+    setup.volumeRadiation->ComputeRHSFunction(0, rhs, rhs) >> ablate::utilities::PetscUtilities::checkError;
+
+    PetscInt size;
+    const PetscScalar* rhsArray;
+    VecGetLocalSize(rhs, &size) >> ablate::utilities::PetscUtilities::checkError;
+    VecGetArrayRead(rhs, &rhsArray) >> ablate::utilities::PetscUtilities::checkError;
+    std::vector<PetscScalar> values(rhsArray, rhsArray + size);
+    VecRestoreArrayRead(rhs, &rhsArray) >> ablate::utilities::PetscUtilities::checkError;
+    DMRestoreLocalVector(setup.domain->GetDM(), &rhs) >> ablate::utilities::PetscUtilities::checkError;
+    return values;
+}
+
+class RadiationSerializationTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(RadiationSerializationTestFixture, ShouldRestoreSavedRaysForTheSameMesh) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // ARRANGE
+            auto raysFile = MakeTemporaryPath("radiationRays.h5", PETSC_COMM_WORLD);
+            auto original = CreateRadiationSerializationSetup({3, 20});
+            auto expectedRhs = ComputeRadiationRhs(original);
+
+            PetscViewer viewer;
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, raysFile.c_str(), FILE_MODE_WRITE, &viewer) >> testErrorChecker;
+            original.volumeRadiation->Save(viewer, 0, 0.0) >> testErrorChecker;
+            PetscViewerDestroy(&viewer) >> testErrorChecker;
+
+            auto restored = CreateRadiationSerializationSetup({3, 20});
+            ASSERT_FALSE(restored.radiation->RayDataReady()) << "The rays should not be traced before they are needed";
+
+            // ACT
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, raysFile.c_str(), FILE_MODE_READ, &viewer) >> testErrorChecker;
+            restored.volumeRadiation->Restore(viewer, 0, 0.0) >> testErrorChecker;
+            PetscViewerDestroy(&viewer) >> testErrorChecker;
+
+            // ASSERT
+            ASSERT_TRUE(restored.radiation->RayDataReady()) << "The saved rays should be used for the same mesh";
+            ASSERT_EQ(original.radiation->GetRaySegmentOffsets(), restored.radiation->GetRaySegmentOffsets());
+            ASSERT_EQ(original.radiation->GetSegmentPathLengths(), restored.radiation->GetSegmentPathLengths());
+            ASSERT_EQ(original.radiation->GetSegmentPropertyIndices(), restored.radiation->GetSegmentPropertyIndices());
+            ASSERT_EQ(original.radiation->GetPropertyCells(), restored.radiation->GetPropertyCells());
+
+            auto restoredRhs = ComputeRadiationRhs(restored);
+            ASSERT_EQ(expectedRhs.size(), restoredRhs.size());
+            for (std::size_t i = 0; i < expectedRhs.size(); ++i) {
+                ASSERT_DOUBLE_EQ(PetscRealPart(expectedRhs[i]), PetscRealPart(restoredRhs[i])) << "The rhs from the restored rays should match at index " << i;
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+TEST_P(RadiationSerializationTestFixture, ShouldTraceRaysWhenTheSavedMeshDoesNotMatch) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // ARRANGE
+            auto raysFile = MakeTemporaryPath("radiationRaysMismatch.h5", PETSC_COMM_WORLD);
+            auto original = CreateRadiationSerializationSetup({3, 20});
+            PetscViewer viewer;
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, raysFile.c_str(), FILE_MODE_WRITE, &viewer) >> testErrorChecker;
+            original.volumeRadiation->Save(viewer, 0, 0.0) >> testErrorChecker;
+            PetscViewerDestroy(&viewer) >> testErrorChecker;
+
+            auto traced = CreateRadiationSerializationSetup({3, 22});
+            auto expectedRhs = ComputeRadiationRhs(traced);
+            auto different = CreateRadiationSerializationSetup({3, 22});
+
+            // ACT
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, raysFile.c_str(), FILE_MODE_READ, &viewer) >> testErrorChecker;
+            different.volumeRadiation->Restore(viewer, 0, 0.0) >> testErrorChecker;
+            PetscViewerDestroy(&viewer) >> testErrorChecker;
+
+            // ASSERT
+            ASSERT_FALSE(different.radiation->RayDataReady()) << "The saved rays should not be used for a different mesh";
+            auto computedRhs = ComputeRadiationRhs(different);
+            ASSERT_TRUE(different.radiation->RayDataReady()) << "The rays should be traced again when needed";
+            ASSERT_EQ(expectedRhs.size(), computedRhs.size());
+            for (std::size_t i = 0; i < expectedRhs.size(); ++i) {
+                ASSERT_DOUBLE_EQ(PetscRealPart(expectedRhs[i]), PetscRealPart(computedRhs[i])) << "The rhs from the traced rays should match at index " << i;
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(RadiationTests, RadiationSerializationTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("ray serialization 1 proc", 1), testingResources::MpiTestParameter("ray serialization 2 proc", 2)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
+
+/**
+ * Returns the local ray segments as (cell, path length) lists sorted by ray so that rays can be compared independent of the order they were found on this rank
+ */
+static std::vector<std::vector<std::pair<PetscInt, PetscReal>>> GetSortedRaySegments(const RayAccessRadiation& radiation) {
+    const auto& offsets = radiation.GetRaySegmentOffsets();
+    std::vector<std::vector<std::pair<PetscInt, PetscReal>>> rays;
+    for (std::size_t r = 0; r + 1 < offsets.size(); ++r) {
+        auto& ray = rays.emplace_back();
+        for (PetscInt s = offsets[r]; s < offsets[r + 1]; ++s) {
+            ray.emplace_back(radiation.GetPropertyCells()[radiation.GetSegmentPropertyIndices()[s]], radiation.GetSegmentPathLengths()[s]);
+        }
+    }
+    std::sort(rays.begin(), rays.end());
+    return rays;
+}
+
+class RadiationMarchingTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(RadiationMarchingTestFixture, ShouldTraceTheSameRaysWhenMarchingLocally) {
+    StartWithMPI
+        // initialize petsc and mpi
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize();
+        {
+            // ARRANGE
+            // migrating after every particle step is how the rays were traced before the particles marched locally
+            auto migrateEveryStep = CreateRadiationSerializationSetup({3, 20}, false);
+            auto expectedRhs = ComputeRadiationRhs(migrateEveryStep);
+
+            auto marchLocally = CreateRadiationSerializationSetup({3, 20});
+
+            // ACT
+            auto computedRhs = ComputeRadiationRhs(marchLocally);
+
+            // ASSERT
+            // the rays must cross the partitions so that the particles are handed off with the AwaitingMigrationCell
+            PetscInt localRays = (PetscInt)marchLocally.radiation->GetRaySegmentOffsets().size() - 1;
+            PetscInt originRays = marchLocally.radiation->GetNumberOriginRays();
+            PetscInt globalRays, globalOriginRays;
+            MPI_Allreduce(&localRays, &globalRays, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD) >> testErrorChecker;
+            MPI_Allreduce(&originRays, &globalOriginRays, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD) >> testErrorChecker;
+            ASSERT_GT(globalRays, globalOriginRays) << "The rays should be split across ranks";
+
+            // each rank should hold the same ray segments
+            ASSERT_EQ(migrateEveryStep.radiation->GetPropertyCells(), marchLocally.radiation->GetPropertyCells());
+            ASSERT_EQ(migrateEveryStep.radiation->GetSegmentPathLengths().size(), marchLocally.radiation->GetSegmentPathLengths().size());
+            ASSERT_EQ(GetSortedRaySegments(*migrateEveryStep.radiation), GetSortedRaySegments(*marchLocally.radiation));
+
+            ASSERT_EQ(expectedRhs.size(), computedRhs.size());
+            for (std::size_t i = 0; i < expectedRhs.size(); ++i) {
+                ASSERT_NEAR(PetscRealPart(expectedRhs[i]), PetscRealPart(computedRhs[i]), 1E-10 * PetscAbsReal(PetscRealPart(expectedRhs[i])) + 1E-12)
+                    << "The rhs from the locally marched rays should match at index " << i;
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(RadiationTests, RadiationMarchingTestFixture,
+                         testing::Values(testingResources::MpiTestParameter("local marching 2 proc", 2), testingResources::MpiTestParameter("local marching 3 proc", 3)),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter>& info) { return info.param.getTestName(); });
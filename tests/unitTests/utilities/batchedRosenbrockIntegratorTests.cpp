@@ -0,0 +1,98 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "utilities/batchedRosenbrockIntegrator.hpp"
+
+using Integrator = ablate::utilities::BatchedRosenbrockIntegrator<2>;
+
+/**
+ * A linear system where each entry has its own stiffness k, y0' = -k*y0 and y1' = k*y0 - y1.  An entry with a negative stiffness returns a nan rhs.
+ */
+static PetscErrorCode ComputeStiffRhs(const std::vector<PetscReal>& stiffness, const std::vector<PetscInt>& entries, const std::vector<PetscReal>& values, std::vector<PetscReal>& rhs) {
+    const auto size = (PetscInt)stiffness.size();
+    for (const auto i : entries) {
+        const PetscReal k = stiffness[i];
+        const PetscReal y0 = values[0 * size + i];
+        const PetscReal y1 = values[1 * size + i];
+        rhs[0 * size + i] = k < 0 ? std::numeric_limits<PetscReal>::quiet_NaN() : -k * y0;
+        rhs[1 * size + i] = k * y0 - y1;
+    }
+    return 0;
+}
+
+/**
+ * Integrates each entry from y = {1, 0} at t = 0 to endTime and returns the failed entries
+ */
+static std::vector<PetscInt> IntegrateStiffBatch(Integrator& integrator, const std::vector<PetscReal>& stiffness, PetscReal endTime) {
+    integrator.Resize((PetscInt)stiffness.size());
+    for (PetscInt i = 0; i < integrator.GetSize(); ++i) {
+        integrator.Time(i) = 0.0;
+        integrator.TimeStep(i) = 1E-3;
+        integrator.Value(i, 0) = 1.0;
+        integrator.Value(i, 1) = 0.0;
+    }
+    std::vector<PetscInt> failedEntries;
+    auto computeRhs = [&stiffness](const auto& entries, const auto& values, auto& rhs) { return ComputeStiffRhs(stiffness, entries, values, rhs); };
+    EXPECT_EQ(integrator.Integrate(endTime, computeRhs, failedEntries), 0);
+    return failedEntries;
+}
+
+TEST(BatchedRosenbrockIntegratorTests, ShouldIntegrateEntriesWithDifferentStiffness) {
+    // arrange
+    const std::vector<PetscReal> stiffness = {2.0, 1E2, 1E4, 1E6};
+    const PetscReal endTime = 0.5;
+    Integrator integrator(1E-12, 1E-1, 1E-8, 1E-6);
+
+    // act
+    auto failedEntries = IntegrateStiffBatch(integrator, stiffness, endTime);
+
+    // assert
+    ASSERT_TRUE(failedEntries.empty());
+    for (PetscInt i = 0; i < integrator.GetSize(); ++i) {
+        const PetscReal k = stiffness[i];
+        const PetscReal expectedY0 = std::exp(-k * endTime);
+        const PetscReal expectedY1 = k / (k - 1.0) * (std::exp(-endTime) - std::exp(-k * endTime));
+        ASSERT_DOUBLE_EQ(integrator.Time(i), endTime) << "for stiffness " << k;
+        ASSERT_NEAR(integrator.Value(i, 0), expectedY0, 1E-5) << "for stiffness " << k;
+        ASSERT_NEAR(integrator.Value(i, 1), expectedY1, 1E-5) << "for stiffness " << k;
+    }
+}
+
+TEST(BatchedRosenbrockIntegratorTests, ShouldComputeTheSameResultIndependentOfTheBatch) {
+    // arrange
+    Integrator singleIntegrator(1E-12, 1E-1, 1E-8, 1E-6);
+    Integrator batchIntegrator(1E-12, 1E-1, 1E-8, 1E-6);
+
+    // act
+    IntegrateStiffBatch(singleIntegrator, {1E2}, 0.5);
+    IntegrateStiffBatch(batchIntegrator, {1E6, 2.0, 1E2, 1E4}, 0.5);
+
+    // assert
+    ASSERT_EQ(singleIntegrator.Value(0, 0), batchIntegrator.Value(2, 0));
+    ASSERT_EQ(singleIntegrator.Value(0, 1), batchIntegrator.Value(2, 1));
+}
+
+TEST(BatchedRosenbrockIntegratorTests, ShouldReportFailedEntriesAndKeepTheirValues) {
+    // arrange
+    const std::vector<PetscReal> stiffness = {1E2, -1.0, 1E4};
+    const PetscReal endTime = 0.5;
+    Integrator integrator(1E-12, 1E-1, 1E-8, 1E-6);
+
+    // act
+    auto failedEntries = IntegrateStiffBatch(integrator, stiffness, endTime);
+
+    // assert
+    ASSERT_EQ(failedEntries, std::vector<PetscInt>{1});
+    ASSERT_DOUBLE_EQ(integrator.Time(1), 0.0);
+    ASSERT_DOUBLE_EQ(integrator.Value(1, 0), 1.0);
+    ASSERT_DOUBLE_EQ(integrator.Value(1, 1), 0.0);
+
+    // the other entries are still integrated
+    for (const PetscInt i : {0, 2}) {
+        const PetscReal k = stiffness[i];
+        ASSERT_DOUBLE_EQ(integrator.Time(i), endTime);
+        ASSERT_NEAR(integrator.Value(i, 0), std::exp(-k * endTime), 1E-5) << "for stiffness " << k;
+        ASSERT_NEAR(integrator.Value(i, 1), k / (k - 1.0) * (std::exp(-endTime) - std::exp(-k * endTime)), 1E-5) << "for stiffness " << k;
+    }
+}
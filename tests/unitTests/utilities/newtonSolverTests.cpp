@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+#include "utilities/newtonSolver.hpp"
+
+TEST(NewtonSolverTests, ShouldSolveLinearSystemRequiringPivoting) {
+    // arrange
+    ablate::utilities::NewtonSolver<4>::Matrix A = {{{0.0, 2.0, 1.0, 0.0}, {1.0, 0.0, 0.0, 3.0}, {0.0, 0.0, 4.0, 1.0}, {2.0, 1.0, 0.0, 0.0}}};
+    const ablate::utilities::NewtonSolver<4>::Vector expected = {1.0, -2.0, 3.0, 0.5};
+    ablate::utilities::NewtonSolver<4>::Vector b = {0.0, 0.0, 0.0, 0.0};
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            b[i] += A[i][j] * expected[j];
+        }
+    }
+
+    // act
+    bool solved = ablate::utilities::NewtonSolver<4>::SolveLinear(A, b);
+
+    // assert
+    ASSERT_TRUE(solved);
+    for (std::size_t i = 0; i < 4; ++i) {
+        ASSERT_NEAR(expected[i], b[i], 1E-12);
+    }
+}
+
+TEST(NewtonSolverTests, ShouldSolveNonlinearSystem) {
+    // arrange
+    // intersection of the circle x^2 + y^2 = 4 with the line y = x
+    auto function = [](const ablate::utilities::NewtonSolver<2>::Vector& x, ablate::utilities::NewtonSolver<2>::Vector& F, ablate::utilities::NewtonSolver<2>::Matrix& J) {
+        F[0] = x[0] * x[0] + x[1] * x[1] - 4.0;
+        F[1] = x[1] - x[0];
+        J[0] = {2.0 * x[0], 2.0 * x[1]};
+        J[1] = {-1.0, 1.0};
+    };
+    ablate::utilities::NewtonSolver<2>::Vector x = {1.0, 2.0};
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<2>::Solve(function, x);
+
+    // assert
+    ASSERT_TRUE(result.converged);
+    ASSERT_LT(result.iterations, 10);
+    ASSERT_NEAR(PetscSqrtReal(2.0), x[0], 1E-10);
+    ASSERT_NEAR(PetscSqrtReal(2.0), x[1], 1E-10);
+}
+
+TEST(NewtonSolverTests, ShouldReportNonConvergenceForSingularJacobian) {
+    // arrange
+    // x^2 + 1 = 0 has no real root and a singular jacobian at zero
+    auto function = [](const ablate::utilities::NewtonSolver<1>::Vector& x, ablate::utilities::NewtonSolver<1>::Vector& F, ablate::utilities::NewtonSolver<1>::Matrix& J) {
+        F[0] = x[0] * x[0] + 1.0;
+        J[0][0] = 2.0 * x[0];
+    };
+    ablate::utilities::NewtonSolver<1>::Vector x = {0.0};
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<1>::Solve(function, x);
+
+    // assert
+    ASSERT_FALSE(result.converged);
+    ASSERT_EQ(0, result.iterations);
+}
+
+TEST(NewtonSolverTests, ShouldReportNonConvergenceAfterMaximumIterations) {
+    // arrange
+    // the triple root at zero only converges linearly, x is reduced by 2/3 each iteration
+    auto function = [](const ablate::utilities::NewtonSolver<1>::Vector& x, ablate::utilities::NewtonSolver<1>::Vector& F, ablate::utilities::NewtonSolver<1>::Matrix& J) {
+        F[0] = x[0] * x[0] * x[0];
+        J[0][0] = 3.0 * x[0] * x[0];
+    };
+    ablate::utilities::NewtonSolver<1>::Vector x = {1.0};
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<1>::Solve(function, x, 1E-8, 1E-12, 0.0, 5);
+
+    // assert
+    ASSERT_FALSE(result.converged);
+    ASSERT_EQ(5, result.iterations);
+    ASSERT_NEAR(PetscPowReal(2.0 / 3.0, 5), x[0], 1E-12);
+}
+
+TEST(NewtonSolverTests, ShouldReportNonConvergenceWhenTheLineSearchFails) {
+    // arrange
+    // x^2 + 1 = 0 has no real root, so the line search stops once the residual can no longer be reduced
+    auto function = [](const ablate::utilities::NewtonSolver<1>::Vector& x, ablate::utilities::NewtonSolver<1>::Vector& F, ablate::utilities::NewtonSolver<1>::Matrix& J) {
+        F[0] = x[0] * x[0] + 1.0;
+        J[0][0] = 2.0 * x[0];
+    };
+    ablate::utilities::NewtonSolver<1>::Vector x = {0.5};
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<1>::Solve(function, x, 1E-8, 1E-12, 0.0, 25);
+
+    // assert
+    ASSERT_FALSE(result.converged);
+    ASSERT_LT(result.iterations, 25);
+    ASSERT_LT(PetscAbsReal(x[0]), 0.5) << "Every accepted step should reduce the residual";
+}
+
+TEST(NewtonSolverTests, ShouldConvergeWhenFullNewtonStepsDiverge) {
+    // arrange
+    // full Newton steps on atan(x) diverge for |x0| > 1.39
+    auto function = [](const ablate::utilities::NewtonSolver<1>::Vector& x, ablate::utilities::NewtonSolver<1>::Vector& F, ablate::utilities::NewtonSolver<1>::Matrix& J) {
+        F[0] = PetscAtanReal(x[0]);
+        J[0][0] = 1.0 / (1.0 + x[0] * x[0]);
+    };
+    ablate::utilities::NewtonSolver<1>::Vector x = {2.0};
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<1>::Solve(function, x);
+
+    // assert
+    ASSERT_TRUE(result.converged);
+    ASSERT_NEAR(0.0, x[0], 1E-8);
+}
+
+TEST(NewtonSolverTests, ShouldOnlyAcceptAdmissibleSteps) {
+    // arrange
+    // the first full Newton step on log(x) from x = 3 lands at a negative x
+    auto function = [](const ablate::utilities::NewtonSolver<1>::Vector& x, ablate::utilities::NewtonSolver<1>::Vector& F, ablate::utilities::NewtonSolver<1>::Matrix& J) {
+        F[0] = PetscLogReal(x[0]);
+        J[0][0] = 1.0 / x[0];
+    };
+    ablate::utilities::NewtonSolver<1>::Vector x = {3.0};
+    PetscReal minimumX = x[0];
+    auto positive = [&minimumX](const ablate::utilities::NewtonSolver<1>::Vector& x) {
+        minimumX = PetscMin(minimumX, x[0]);
+        return x[0] > 0.0;
+    };
+
+    // act
+    auto result = ablate::utilities::NewtonSolver<1>::Solve(function, x, 1E-8, 1E-12, 1E-8, 100, positive);
+
+    // assert
+    ASSERT_TRUE(result.converged);
+    ASSERT_LT(minimumX, 0.0) << "The full Newton step should have been checked";
+    ASSERT_NEAR(1.0, x[0], 1E-8);
+}